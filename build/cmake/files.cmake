@@ -409,6 +409,7 @@ set(BASE_CMN_SRC
     src/common/arcfind.cpp
     src/common/archive.cpp
     src/common/arrstr.cpp
+    src/common/atom.cpp
     src/common/base64.cpp
     src/common/clntdata.cpp
     src/common/cmdline.cpp
@@ -455,12 +456,14 @@ set(BASE_CMN_SRC
     src/common/secretstore.cpp
     src/common/stdpbase.cpp
     src/common/sstream.cpp
+    src/common/staticformat.cpp
     src/common/stdstream.cpp
     src/common/stopwatch.cpp
     src/common/strconv.cpp
     src/common/stream.cpp
     src/common/string.cpp
     src/common/stringops.cpp
+    src/common/strpool.cpp
     src/common/strvararg.cpp
     src/common/sysopt.cpp
     src/common/tarstrm.cpp
@@ -507,6 +510,7 @@ set(BASE_CMN_HDR
     wx/archive.h
     wx/arrimpl.cpp
     wx/arrstr.h
+    wx/atom.h
     wx/atomic.h
     wx/base64.h
     wx/beforestd.h
@@ -602,6 +606,7 @@ set(BASE_CMN_HDR
     wx/sstream.h
     wx/stack.h
     wx/stackwalk.h
+    wx/staticformat.h
     wx/stdpaths.h
     wx/stdstream.h
     wx/stockitem.h
@@ -610,6 +615,7 @@ set(BASE_CMN_HDR
     wx/stream.h
     wx/string.h
     wx/stringops.h
+    wx/strpool.h
     wx/strvararg.h
     wx/sysopt.h
     wx/tarstrm.h
@@ -787,6 +793,7 @@ set(GUI_CMN_SRC
     src/common/helpbase.cpp
     src/common/iconbndl.cpp
     src/common/imagall.cpp
+    src/common/imagbatch.cpp
     src/common/imagbmp.cpp
     src/common/image.cpp
     src/common/imagfill.cpp
@@ -1103,6 +1110,7 @@ set(GUI_CMN_HDR
     wx/helpbase.h
     wx/helpwin.h
     wx/iconbndl.h
+    wx/imagbatch.h
     wx/imagbmp.h
     wx/image.h
     wx/imaggif.h
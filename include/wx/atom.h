@@ -0,0 +1,74 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        wx/atom.h
+// Purpose:     wxAtom: interned strings with fast comparison and hashing
+// Author:      wxWidgets team
+// Created:     2026-10-17
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_ATOM_H_
+#define _WX_ATOM_H_
+
+#include "wx/string.h"
+
+#include <functional>
+
+// ----------------------------------------------------------------------------
+// wxAtom: unique representation of a string
+// ----------------------------------------------------------------------------
+
+// All atoms with the same string share the same pointer to the single copy of
+// this string stored in a global table, so they can be compared and hashed by
+// just using this pointer. Strings are never removed from the table, so this
+// class should be only used for identifiers, and not arbitrary strings.
+class WXDLLIMPEXP_BASE wxAtom
+{
+public:
+    // Default constructor creates the atom for the empty string.
+    wxAtom();
+
+    // Find the atom for the given string, creating it if necessary.
+    //
+    // This function is thread-safe.
+    explicit wxAtom(const wxString& s);
+
+    const wxString& GetString() const { return *m_str; }
+
+    bool IsEmpty() const { return m_str->empty(); }
+
+    size_t GetHash() const { return std::hash<const wxString*>()(m_str); }
+
+    bool operator==(const wxAtom& other) const { return m_str == other.m_str; }
+    bool operator!=(const wxAtom& other) const { return m_str != other.m_str; }
+
+    // Comparing with a string doesn't require interning it.
+    bool operator==(const wxString& s) const { return *m_str == s; }
+    bool operator!=(const wxString& s) const { return *m_str != s; }
+
+    // The order of atoms is arbitrary, but fixed during the program lifetime,
+    // this allows using them as keys in ordered containers.
+    bool operator<(const wxAtom& other) const
+        { return std::less<const wxString*>()(m_str, other.m_str); }
+
+private:
+    // Points to the string in the global table, never null.
+    const wxString* m_str;
+};
+
+// Allow using wxAtom as keys in std::unordered_map and similar containers.
+namespace std
+{
+
+template <>
+struct hash<wxAtom>
+{
+    size_t operator()(const wxAtom& atom) const noexcept
+    {
+        return atom.GetHash();
+    }
+};
+
+} // namespace std
+
+#endif // _WX_ATOM_H_
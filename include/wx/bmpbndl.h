@@ -15,6 +15,7 @@
 #include "wx/vector.h"
 
 class wxBitmapBundleImpl;
+class WXDLLIMPEXP_FWD_BASE wxEvtHandler;
 class WXDLLIMPEXP_FWD_CORE wxIconBundle;
 class WXDLLIMPEXP_FWD_CORE wxImageList;
 class WXDLLIMPEXP_FWD_BASE wxVariant;
@@ -98,6 +99,37 @@ public:
     // On MacOS, name must be a file with an extension "svg" placed in the
     // "Resources" subdirectory of the application bundle.
     wxNODISCARD static wxBitmapBundle FromSVGResource(const wxString& name, const wxSize& sizeDef);
+
+    // The bitmaps rasterized from SVG images are cached for all bundles
+    // created by the functions above and the total amount of memory used by
+    // them is limited by the given number of bytes (16MiB by default).
+    static void SetSVGCacheLimit(size_t maxBytes);
+    static size_t GetSVGCacheLimit();
+
+    // Return the number of bytes currently used by the cached bitmaps.
+    static size_t GetSVGCacheSize();
+
+    // Discard the least recently used bitmaps from the cache until it uses
+    // at most the given number of bytes.
+    static void TrimSVGCache(size_t maxBytes = 0);
+
+#if wxUSE_THREADS
+    // Create the bundle from SVG data or file, as above, and start
+    // rasterizing the bitmap of the given size in a background thread. Until
+    // it is done, GetBitmap() returns a transparent bitmap for this size and
+    // wxEVT_THREAD event with the given id is sent to the handler, if any,
+    // when the real bitmap becomes available.
+    wxNODISCARD static wxBitmapBundle FromSVGAsync(const char* data,
+                                                   const wxSize& sizeDef,
+                                                   const wxSize& size,
+                                                   wxEvtHandler* handler = nullptr,
+                                                   int id = wxID_ANY);
+    wxNODISCARD static wxBitmapBundle FromSVGFileAsync(const wxString& path,
+                                                       const wxSize& sizeDef,
+                                                       const wxSize& size,
+                                                       wxEvtHandler* handler = nullptr,
+                                                       int id = wxID_ANY);
+#endif // wxUSE_THREADS
 #endif // wxHAS_SVG
 
     // Create from the resources: all existing versions of the bitmap of the
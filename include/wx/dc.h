@@ -375,6 +375,10 @@ public:
                                         wxCoord *heightLine = nullptr,
                                         const wxFont *font = nullptr) const;
     virtual bool DoGetPartialTextExtents(const wxString& text, wxArrayInt& widths) const;
+    virtual void DoGetTextExtents(size_t n,
+                                  const wxString* strings,
+                                  wxSize* extents,
+                                  const wxFont* font = nullptr) const;
 
     // clearing
 
@@ -873,6 +877,21 @@ public:
     bool GetPartialTextExtents(const wxString& text, wxArrayInt& widths) const
         { return m_pimpl->DoGetPartialTextExtents(text, widths); }
 
+    // Measure all the given strings at once, more efficiently than by calling
+    // GetTextExtent() for each of them.
+    void GetTextExtents(size_t n,
+                        const wxString* strings,
+                        wxSize* extents,
+                        const wxFont* font = nullptr) const
+        { m_pimpl->DoGetTextExtents(n, strings, extents, font); }
+
+    // Global cache of the text extents measured using the native API, it's
+    // disabled by default and can be enabled by specifying a non-zero maximal
+    // number of entries in it.
+    static void EnableTextExtentCache(size_t maxEntries = 4096);
+    static void ClearTextExtentCache();
+    static void GetTextExtentCacheStats(size_t* hits, size_t* misses);
+
     // coordinates conversions and transforms
 
     wxCoord DeviceToLogicalX(wxCoord x) const
@@ -35,6 +35,10 @@
 // is private style and not returned by GetStyle.
 #define wxBUFFER_USES_SHARED_BUFFER 0x04
 
+// Only for wxBufferedPaintDC: keep a persistent per-window backing store and
+// redraw and copy to the window only the invalidated part of it
+#define wxBUFFER_PERSISTENT         0x08
+
 class WXDLLIMPEXP_CORE wxBufferedDC : public wxMemoryDC
 {
 public:
@@ -102,6 +106,11 @@ public:
     void SetStyle(int style) { m_style = style; }
     int GetStyle() const { return m_style & ~wxBUFFER_USES_SHARED_BUFFER; }
 
+protected:
+    // If the region is not empty, only its rectangles (in device coordinates)
+    // are blitted by UnMask() instead of the entire buffer.
+    void SetBlitRegion(const wxRegion& region) { m_blitRegion = region; }
+
 private:
     // common part of Init()s
     void InitCommon(wxDC *dc, int style)
@@ -130,6 +139,9 @@ private:
 
     wxSize m_area;
 
+    // the part of the buffer to blit, entire buffer if empty
+    wxRegion m_blitRegion;
+
     wxDECLARE_DYNAMIC_CLASS(wxBufferedDC);
     wxDECLARE_NO_COPY_CLASS(wxBufferedDC);
 };
@@ -185,7 +197,9 @@ private:
         if (style & wxBUFFER_VIRTUAL_AREA)
             window->PrepareDC( m_paintdc );
 
-        if ( buffer && buffer->IsOk() )
+        if ( style & wxBUFFER_PERSISTENT )
+            InitPersistent(window, style);
+        else if ( buffer && buffer->IsOk() )
             Init(&m_paintdc, *buffer, style);
         else
             Init(&m_paintdc, GetBufferedSize(window, style), style);
@@ -195,6 +209,9 @@ private:
         GetImpl()->InheritAttributes(window);
     }
 
+    // Use the window backing store, used with wxBUFFER_PERSISTENT style.
+    void InitPersistent(wxWindow *window, int style);
+
     wxPaintDC m_paintdc;
 
     wxDECLARE_ABSTRACT_CLASS(wxBufferedPaintDC);
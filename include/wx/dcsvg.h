@@ -33,6 +33,7 @@ enum wxSVGShapeRenderingMode
 };
 
 class WXDLLIMPEXP_FWD_BASE wxFileOutputStream;
+class WXDLLIMPEXP_FWD_BASE wxOutputStream;
 
 class WXDLLIMPEXP_FWD_CORE wxSVGFileDC;
 
@@ -143,6 +144,8 @@ public:
 
     void SetShapeRenderingMode(wxSVGShapeRenderingMode renderingMode);
 
+    void EnableLineCoalescing(bool enable);
+
 private:
     virtual bool DoGetPixel(wxCoord WXUNUSED(x), wxCoord WXUNUSED(y),
                             wxColour* WXUNUSED(col)) const override
@@ -261,19 +264,65 @@ private:
 
 private:
     // If m_graphics_changed is true, close the current <g> element and start a
-    // new one for the last pen/brush change.
+    // new one for the last pen/brush change. This also closes the path being
+    // built from several lines, if any.
     void NewGraphicsIfNeeded();
 
     // Open a new graphics group setting up all the attributes according to
     // their current values in wxDC.
     void DoStartNewGraphics();
 
+    // Helpers appending the data to m_buffer without any conversions. Unlike
+    // write(), they don't close the pending path.
+    void WriteRaw(const char* s, size_t len);
+    void WriteRaw(const char* s) { WriteRaw(s, strlen(s)); }
+    void WriteRaw(const std::string& s) { WriteRaw(s.data(), s.length()); }
+    void WriteInt(int n);
+    void WriteNum(double f);
+
+    // Write the contents of m_buffer to the output stream.
+    void FlushBuffer();
+
+    // Close the path element started by DoDrawLine() if it's still open.
+    void ClosePendingPath();
+
+    // Return the attributes common to all shapes and the ones used for the
+    // filled shapes, these strings are cached as they're needed for every
+    // drawing operation but only change when the pen, brush or the rendering
+    // mode do. The brush attributes start with a space separating them from
+    // the shape ones.
+    const std::string& GetShapeAttrs();
+    const std::string& GetBrushAttrs();
+
     wxString            m_filename;
     bool                m_OK;
     bool                m_graphics_changed;  // set by Set{Brush,Pen}()
     int                 m_width, m_height;
     double              m_dpi;
     std::unique_ptr<wxFileOutputStream> m_outfile;
+
+    // Either m_outfile or, when writing compressed SVG, the stream wrapping
+    // it. This is null if there is no output file.
+    wxOutputStream*     m_output;
+    std::unique_ptr<wxOutputStream> m_zlibStream;
+
+    // Output is accumulated in this buffer and written to m_output in big
+    // chunks.
+    std::string         m_buffer;
+
+    // Cached results of GetShapeAttrs() and GetBrushAttrs(), empty if they
+    // need to be recomputed.
+    std::string         m_shapeAttrs;
+    std::string         m_brushAttrs;
+
+    // If true, consecutive lines are drawn as a single path element.
+    bool                m_coalesceLines;
+
+    // When coalescing lines, this is true if a path element is open and
+    // m_pathAttrs contains the attributes to use when closing it.
+    bool                m_pathPending;
+    std::string         m_pathAttrs;
+
     std::unique_ptr<wxSVGBitmapHandler> m_bmp_handler; // class to handle bitmaps
     wxSVGShapeRenderingMode m_renderingMode;
 
@@ -312,6 +361,9 @@ public:
 
     void SetShapeRenderingMode(wxSVGShapeRenderingMode renderingMode);
 
+    // Draw consecutive lines with the same attributes as a single path.
+    void EnableLineCoalescing(bool enable = true);
+
 private:
     wxDECLARE_ABSTRACT_CLASS(wxSVGFileDC);
 };
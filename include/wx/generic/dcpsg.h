@@ -20,6 +20,8 @@
 #include "wx/cmndata.h"
 #include "wx/strvararg.h"
 
+#include <string>
+
 //-----------------------------------------------------------------------------
 // wxPostScriptDC
 //-----------------------------------------------------------------------------
@@ -93,6 +95,11 @@ public:
 
     void PsPrint( const wxString& psdata );
 
+    // Append the given data, which must be already in UTF-8, to the output.
+    // The output is buffered and only written to the file or stream when the
+    // buffer becomes full, at the end of each page or when EndDoc() is called.
+    void PsWrite( const char* psdata, size_t len );
+
     // Overridden for wxPrinterDC Impl
 
     virtual int GetResolution() const override;
@@ -149,7 +156,13 @@ protected:
     // Set PostScript color
     void SetPSColour(const wxColour& col);
 
+    // Write the contents of the output buffer to the file or stream.
+    void PsFlush();
+    // Write the data to the file or stream without buffering it.
+    void PsWriteUnbuffered(const char* psdata, size_t len);
+
     FILE*             m_pstream;    // PostScript output stream
+    std::string       m_psBuffer;   // Data not written to m_pstream yet
     unsigned char     m_currentRed;
     unsigned char     m_currentGreen;
     unsigned char     m_currentBlue;
@@ -18,6 +18,8 @@
 #include "wx/image.h"
 #include "wx/animdecod.h"
 #include "wx/dynarray.h"
+#include "wx/buffer.h"
+#include "wx/vector.h"
 
 // internal utility used to store a frame in 8bit-per-pixel format
 class GIFImage;
@@ -52,7 +54,28 @@ public:
     wxGIFDecoder();
     ~wxGIFDecoder();
 
+    // Enable lazy decoding of the frames: if maxCachedFrames is non-zero,
+    // LoadGIF() only indexes the frames and keeps the compressed data in
+    // memory, the frames are decoded when they're accessed and at most the
+    // given number of the most recently used decoded frames is kept.
+    //
+    // This must be called before LoadGIF() to have any effect.
+    void SetLazyDecoding(unsigned int maxCachedFrames)
+        { m_maxCachedFrames = maxCachedFrames; }
+
+    // Set the value used by SetLazyDecoding() for all the new decoders,
+    // including the ones created by wxAnimation and wxGIFHandler. By default
+    // lazy decoding is not used.
+    static void SetDefaultLazyDecoding(unsigned int maxCachedFrames)
+        { ms_defaultMaxCachedFrames = maxCachedFrames; }
+
     // get data of current frame
+    //
+    // notice that when using lazy decoding, the frame is decoded by this
+    // function, which returns nullptr if decoding it fails, and the returned
+    // pointer is only valid until the next call to GetData() (or to any
+    // function calling it, such as ConvertToImage()) for a different frame,
+    // as the data of this frame may be discarded then
     unsigned char* GetData(unsigned int frame) const;
     unsigned char* GetPalette(unsigned int frame) const;
     unsigned int GetNcolours(unsigned int frame) const;
@@ -91,20 +114,37 @@ protected:
         // modifies current stream position (see wxAnimationDecoder::CanRead)
 
 private:
-    int getcode(wxInputStream& stream, int bits, int abfin);
+    int getcode(wxInputStream& stream, int bits, int abfin) const;
     wxGIFErrorCode dgif(wxInputStream& stream,
-                        GIFImage *img, int interl, int bits);
+                        GIFImage *img, int interl, int bits) const;
+
+    // implementation of LoadGIF() reading the frames from the given stream
+    wxGIFErrorCode DoLoadGIF(wxInputStream& stream, bool lazy);
+
+    // decode the frame data from m_data when using lazy decoding, return
+    // nullptr if this fails
+    unsigned char* DecodeFrame(unsigned int frame) const;
 
 
     // array of all frames
     wxArrayPtrVoid m_frames;
 
-    // decoder state vars
-    int           m_restbits;       // remaining valid bits
-    unsigned int  m_restbyte;       // remaining bytes in this block
-    unsigned int  m_lastbyte;       // last byte read
-    unsigned char m_buffer[256];    // buffer for reading
-    unsigned char *m_bufp;          // pointer to next byte in buffer
+    // lazy decoding data: the maximal number of decoded frames to keep, the
+    // entire GIF data and the indices of the currently decoded frames, from
+    // the least to the most recently used
+    unsigned int m_maxCachedFrames;
+    wxMemoryBuffer m_data;
+    mutable wxVector<unsigned int> m_cachedFrames;
+
+    static unsigned int ms_defaultMaxCachedFrames;
+
+    // decoder state vars, these are mutable as frames can be decoded from
+    // const GetData() when using lazy decoding
+    mutable int           m_restbits;       // remaining valid bits
+    mutable unsigned int  m_restbyte;       // remaining bytes in this block
+    mutable unsigned int  m_lastbyte;       // last byte read
+    mutable unsigned char m_buffer[256];    // buffer for reading
+    mutable unsigned char *m_bufp;          // pointer to next byte in buffer
 
     wxDECLARE_NO_COPY_CLASS(wxGIFDecoder);
 };
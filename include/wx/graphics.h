@@ -863,6 +863,12 @@ public:
     // draws a path by first filling and then stroking
     virtual void DrawPath( const wxGraphicsPath& path, wxPolygonFillMode fillStyle = wxODDEVEN_RULE );
 
+    // draws copies of the path translated by each of the given offsets as a
+    // single compound path
+    virtual void DrawPathInstances( const wxGraphicsPath& path,
+                                    size_t n, const wxPoint2DDouble *offsets,
+                                    wxPolygonFillMode fillStyle = wxWINDING_RULE );
+
     // paints a transparent rectangle (only useful for bitmaps or windows)
     virtual void ClearRectangle(wxDouble x, wxDouble y, wxDouble w, wxDouble h);
 
@@ -892,6 +898,10 @@ public:
                    wxDouble angle, const wxGraphicsBrush& backgroundBrush )
         { DoDrawRotatedFilledText(str, x, y, angle, backgroundBrush); }
 
+    // draws each of the n strings at the corresponding position
+    void DrawTexts( size_t n, const wxString *strings, const wxPoint2DDouble *positions )
+        { DoDrawTexts(n, strings, positions); }
+
 
     virtual void GetTextExtent( const wxString &text, wxDouble *width, wxDouble *height,
         wxDouble *descent = nullptr, wxDouble *externalLeading = nullptr ) const  = 0;
@@ -911,6 +921,11 @@ public:
 
     virtual void DrawBitmap( const wxBitmap &bmp, wxDouble x, wxDouble y, wxDouble w, wxDouble h ) = 0;
 
+    // draws the bitmap in the given rectangle n times, each time transformed
+    // by the corresponding matrix in addition to the current transform
+    virtual void DrawBitmaps( const wxGraphicsBitmap &bmp, const wxRect2DDouble& rect,
+                              size_t n, const wxGraphicsMatrix *transforms );
+
     virtual void DrawIcon( const wxIcon &icon, wxDouble x, wxDouble y, wxDouble w, wxDouble h ) = 0;
 
     void DrawIcon(const wxIcon& icon, const wxRect2DDouble& rect)
@@ -947,6 +962,9 @@ public:
         DrawRectangle(rect.m_x, rect.m_y, rect.m_width, rect.m_height);
     }
 
+    // draws all the rectangles as a single path
+    virtual void DrawRectangles( size_t n, const wxRect2DDouble *rects );
+
     // draws an ellipse
     virtual void DrawEllipse( wxDouble x, wxDouble y, wxDouble w, wxDouble h);
 
@@ -955,6 +973,9 @@ public:
         DrawEllipse(rect.m_x, rect.m_y, rect.m_width, rect.m_height);
     }
 
+    // draws all the ellipses as a single path
+    virtual void DrawEllipses( size_t n, const wxRect2DDouble *rects );
+
     // draws a rounded rectangle
     virtual void DrawRoundedRectangle( wxDouble x, wxDouble y, wxDouble w, wxDouble h, wxDouble radius);
 
@@ -1001,6 +1022,9 @@ protected:
     virtual wxGraphicsPen DoCreatePen(const wxGraphicsPenInfo& info) const;
 
     virtual void DoDrawText(const wxString& str, wxDouble x, wxDouble y) = 0;
+    virtual void DoDrawTexts(size_t n,
+                             const wxString* strings,
+                             const wxPoint2DDouble* positions);
     virtual void DoDrawRotatedText(const wxString& str, wxDouble x, wxDouble y,
                                    wxDouble angle);
     virtual void DoDrawFilledText(const wxString& str, wxDouble x, wxDouble y,
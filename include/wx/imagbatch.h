@@ -0,0 +1,148 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        wx/imagbatch.h
+// Purpose:     wxImageBatchLoader: loading many images using worker threads
+// Author:      wxWidgets team
+// Created:     2026-10-17
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_IMAGBATCH_H_
+#define _WX_IMAGBATCH_H_
+
+#include "wx/defs.h"
+
+#if wxUSE_IMAGE && wxUSE_STREAMS && wxUSE_THREADS
+
+#include "wx/event.h"
+#include "wx/image.h"
+
+#include <memory>
+
+class WXDLLIMPEXP_FWD_BASE wxInputStream;
+
+class wxImageBatchLoaderImpl;
+
+// ----------------------------------------------------------------------------
+// wxImageBatchLoader: loads images in the background using several threads
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_CORE wxImageBatchLoader
+{
+public:
+    // The loaded images are sent to the given handler, if any, as
+    // wxEVT_IMAGE_BATCH_LOADED events. Otherwise they can be retrieved using
+    // GetImage() after Wait() returns.
+    //
+    // Up to maxThreads threads are used, with 0 meaning to use as many of
+    // them as there are CPUs.
+    explicit wxImageBatchLoader(wxEvtHandler* handler = nullptr,
+                                unsigned int maxThreads = 0);
+
+    // Cancels loading and waits until all the threads terminate.
+    ~wxImageBatchLoader();
+
+    // Add an image to load, these functions can't be called while loading
+    // is in progress and return the index of the image in this batch.
+    size_t AddFile(const wxString& filename,
+                   wxBitmapType type = wxBITMAP_TYPE_ANY);
+
+    // Takes ownership of the stream, which is deleted after loading it.
+    size_t AddStream(wxInputStream* stream,
+                     wxBitmapType type = wxBITMAP_TYPE_ANY);
+
+    size_t GetCount() const;
+
+    // Set the option to use for all the images loaded by this object, e.g.
+    // wxIMAGE_OPTION_MAX_WIDTH.
+    void SetOption(const wxString& name, const wxString& value);
+    void SetOption(const wxString& name, int value);
+
+    // Start loading all the images added since the last call to this
+    // function in the background, return false if no threads could be
+    // launched.
+    bool Start();
+
+    // Don't start loading any more images. The images being currently loaded
+    // are still loaded and sent to the handler, use Wait() to wait for them.
+    void Cancel();
+
+    // Wait until all the images are loaded or loading is cancelled.
+    void Wait();
+
+    bool IsRunning() const;
+
+    // Only for the loaders without associated handler: get the image loaded
+    // from the file or stream with the given index, which is invalid if it
+    // couldn't be loaded (or loading was cancelled). Can only be called after
+    // Wait() returns.
+    const wxImage& GetImage(size_t n) const;
+
+private:
+    std::unique_ptr<wxImageBatchLoaderImpl> m_impl;
+
+    wxDECLARE_NO_COPY_CLASS(wxImageBatchLoader);
+};
+
+// ----------------------------------------------------------------------------
+// wxImageBatchEvent: sent by wxImageBatchLoader
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_CORE wxImageBatchEvent : public wxEvent
+{
+public:
+    wxImageBatchEvent(wxEventType type = wxEVT_NULL,
+                      size_t index = 0,
+                      const wxString& filename = wxString(),
+                      const wxImage& image = wxImage(),
+                      bool cancelled = false)
+        : wxEvent(wxID_ANY, type),
+          m_index(index),
+          m_filename(filename),
+          m_image(image),
+          m_cancelled(cancelled)
+    {
+    }
+
+    // Index of the image in the batch, as returned by AddFile() or
+    // AddStream().
+    size_t GetIndex() const { return m_index; }
+
+    // Name of the file the image was loaded from, empty for the streams.
+    const wxString& GetFileName() const { return m_filename; }
+
+    // The loaded image, invalid if loading it failed.
+    const wxImage& GetImage() const { return m_image; }
+
+    // For wxEVT_IMAGE_BATCH_DONE only: true if loading was cancelled.
+    bool IsCancelled() const { return m_cancelled; }
+
+    wxNODISCARD virtual wxEvent *Clone() const override
+        { return new wxImageBatchEvent(*this); }
+
+    virtual wxEventCategory GetEventCategory() const override
+        { return wxEVT_CATEGORY_THREAD; }
+
+private:
+    size_t m_index;
+    wxString m_filename;
+    wxImage m_image;
+    bool m_cancelled;
+};
+
+wxDECLARE_EXPORTED_EVENT(WXDLLIMPEXP_CORE, wxEVT_IMAGE_BATCH_LOADED, wxImageBatchEvent);
+wxDECLARE_EXPORTED_EVENT(WXDLLIMPEXP_CORE, wxEVT_IMAGE_BATCH_DONE, wxImageBatchEvent);
+
+typedef void (wxEvtHandler::*wxImageBatchEventFunction)(wxImageBatchEvent&);
+
+#define wxImageBatchEventHandler(func) \
+    wxEVENT_HANDLER_CAST(wxImageBatchEventFunction, func)
+
+#define EVT_IMAGE_BATCH_LOADED(func) \
+    wx__DECLARE_EVT0(wxEVT_IMAGE_BATCH_LOADED, wxImageBatchEventHandler(func))
+#define EVT_IMAGE_BATCH_DONE(func) \
+    wx__DECLARE_EVT0(wxEVT_IMAGE_BATCH_DONE, wxImageBatchEventHandler(func))
+
+#endif // wxUSE_IMAGE && wxUSE_STREAMS && wxUSE_THREADS
+
+#endif // _WX_IMAGBATCH_H_
@@ -58,6 +58,16 @@ enum wxImageResolution
     wxIMAGE_RESOLUTION_CM = 2
 };
 
+// Constants for wxImage::Blur() specifying the kind of blur to apply
+enum wxImageBlurMode
+{
+    // average of all pixels in the square around the pixel
+    wxIMAGE_BLUR_BOX,
+
+    // fast approximation of the Gaussian blur
+    wxIMAGE_BLUR_GAUSSIAN
+};
+
 // Constants for wxImage::Scale() for determining the level of quality
 enum wxImageResizeQuality
 {
@@ -74,7 +84,11 @@ enum wxImageResizeQuality
     wxIMAGE_QUALITY_HIGH = 4,
 
     // fastest algorithm, possibly at the expense of quality
-    wxIMAGE_QUALITY_FAST = 6
+    wxIMAGE_QUALITY_FAST = 6,
+
+    // filters suitable for both enlarging and reducing photographic images
+    wxIMAGE_QUALITY_LANCZOS3 = 7,
+    wxIMAGE_QUALITY_MITCHELL = 8
 };
 
 // Constants for wxImage::Paste() for specifying alpha blending option.
@@ -101,6 +115,7 @@ const unsigned char wxIMAGE_ALPHA_OPAQUE = 0xff;
 class WXDLLIMPEXP_FWD_CORE wxImageHandler;
 class WXDLLIMPEXP_FWD_CORE wxImage;
 class WXDLLIMPEXP_FWD_CORE wxPalette;
+class WXDLLIMPEXP_FWD_CORE wxImageIncrementalDecoder;
 
 //-----------------------------------------------------------------------------
 // wxImageHandler
@@ -130,6 +145,11 @@ public:
     bool CanRead( const wxString& name );
 #endif // wxUSE_STREAMS
 
+    // create a decoder for loading the image incrementally, returns nullptr
+    // if this format doesn't support it, otherwise the caller must delete it
+    virtual wxImageIncrementalDecoder* CreateIncrementalDecoder() const
+        { return nullptr; }
+
     void SetName(const wxString& name) { m_name = name; }
     void SetExtension(const wxString& ext) { m_extension = ext; }
     void SetAltExtensions(const wxArrayString& exts) { m_altExtensions = exts; }
@@ -361,9 +381,11 @@ public:
     wxImage ResampleBox(int width, int height) const;
     wxImage ResampleBilinear(int width, int height) const;
     wxImage ResampleBicubic(int width, int height) const;
+    wxImage ResampleLanczos3(int width, int height) const;
+    wxImage ResampleMitchell(int width, int height) const;
 
     // blur the image according to the specified pixel radius
-    wxImage Blur(int radius) const;
+    wxImage Blur(int radius, wxImageBlurMode mode = wxIMAGE_BLUR_BOX) const;
     wxImage BlurHorizontal(int radius) const;
     wxImage BlurVertical(int radius) const;
 
@@ -461,6 +483,12 @@ public:
     static void SetDefaultLoadFlags(int flags);
     static int GetDefaultLoadFlags();
 
+    // Maximal number of threads used by the functions processing the images,
+    // such as Scale() and Blur(), with 0 meaning to use all CPUs. By default
+    // only the current thread is used.
+    static void SetMaxThreads(unsigned int count);
+    static unsigned int GetMaxThreads();
+
     void SetLoadFlags(int flags);
     int GetLoadFlags() const;
 
@@ -619,6 +647,12 @@ private:
     template <typename F>
     void ApplyToAllPixels(const F& func);
 
+    // Another helper applying the functor, taking the pointer to the pixel
+    // data and the number of pixels, to bands of consecutive rows, possibly
+    // in parallel.
+    template <typename F>
+    void ApplyToAllRows(const F& func);
+
     // Possible values for MakeEmptyClone() flags.
     enum
     {
@@ -651,6 +685,213 @@ private:
 };
 
 
+//-----------------------------------------------------------------------------
+// wxImagePixelView: non-owning view of pixels stored in an external buffer
+//-----------------------------------------------------------------------------
+
+// Possible layouts of the pixels in wxImagePixelView.
+enum wxImagePixelLayout
+{
+    wxIMAGE_PIXEL_RGB,
+    wxIMAGE_PIXEL_BGR,
+    wxIMAGE_PIXEL_RGBA,
+    wxIMAGE_PIXEL_BGRA
+};
+
+class WXDLLIMPEXP_CORE wxImagePixelView
+{
+public:
+    // Default ctor creates an invalid view.
+    wxImagePixelView() = default;
+
+    // Create a view of the given buffer which must remain valid for as long
+    // as the view is used. Stride is the offset between the rows in bytes and
+    // is computed from the width and the layout if it is 0.
+    wxImagePixelView(unsigned char* data,
+                     int width,
+                     int height,
+                     wxImagePixelLayout layout = wxIMAGE_PIXEL_RGB,
+                     int stride = 0);
+
+    // Create a view of the RGB data of the image, without copying it. Note
+    // that the image alpha, if any, is not part of the view.
+    explicit wxImagePixelView(wxImage& image);
+
+    bool IsOk() const { return m_data != nullptr; }
+
+    unsigned char* GetData() const { return m_data; }
+    int GetWidth() const { return m_width; }
+    int GetHeight() const { return m_height; }
+    int GetStride() const { return m_stride; }
+    wxImagePixelLayout GetLayout() const { return m_layout; }
+
+    bool HasAlpha() const
+    {
+        return m_layout == wxIMAGE_PIXEL_RGBA || m_layout == wxIMAGE_PIXEL_BGRA;
+    }
+
+    int GetBytesPerPixel() const { return HasAlpha() ? 4 : 3; }
+
+    unsigned char* GetRowData(int y) const { return m_data + y*m_stride; }
+
+    unsigned char* GetPixelData(int x, int y) const
+    {
+        return GetRowData(y) + x*GetBytesPerPixel();
+    }
+
+    unsigned char GetRed(int x, int y) const
+        { return GetPixelData(x, y)[GetRedOffset()]; }
+    unsigned char GetGreen(int x, int y) const
+        { return GetPixelData(x, y)[1]; }
+    unsigned char GetBlue(int x, int y) const
+        { return GetPixelData(x, y)[2 - GetRedOffset()]; }
+    unsigned char GetAlpha(int x, int y) const
+        { return HasAlpha() ? GetPixelData(x, y)[3] : wxIMAGE_ALPHA_OPAQUE; }
+
+    void SetRGB(int x, int y, unsigned char r, unsigned char g, unsigned char b);
+    void SetAlpha(int x, int y, unsigned char alpha);
+
+    // Return a view of the given part of this one, sharing the same data.
+    wxImagePixelView GetSubView(const wxRect& rect) const;
+
+    // Create a new image with a copy of the pixels of this view.
+    wxImage ToImage() const;
+
+    // Copy the pixels of the image, which must have the same size, into this
+    // view. If the view has alpha but the image doesn't, it is set to opaque.
+    bool CopyFrom(const wxImage& image);
+
+    // Mirror the pixels of this view in place.
+    void Mirror(bool horizontally = true);
+
+    // Rotate the pixels of this view into another one, which must have the
+    // same layout and swapped width and height, and must not overlap it.
+    bool Rotate90(const wxImagePixelView& dst, bool clockwise = true) const;
+
+private:
+    int GetRedOffset() const
+    {
+        return m_layout == wxIMAGE_PIXEL_BGR || m_layout == wxIMAGE_PIXEL_BGRA
+                ? 2 : 0;
+    }
+
+    unsigned char* m_data = nullptr;
+    int m_width = 0,
+        m_height = 0,
+        m_stride = 0;
+    wxImagePixelLayout m_layout = wxIMAGE_PIXEL_RGB;
+};
+
+//-----------------------------------------------------------------------------
+// wxImageIncrementalDecoder: decodes the image data as it becomes available
+//-----------------------------------------------------------------------------
+
+// Interface for the objects notified about the progress of decoding.
+class wxImageDecodeListener
+{
+public:
+    virtual ~wxImageDecodeListener() = default;
+
+    // Called once the image size is known and the image has been allocated,
+    // but before any rows are decoded. Return false to cancel decoding.
+    virtual bool OnImageStarted(const wxImage& WXUNUSED(image)) { return true; }
+
+    // Called when the rows in [firstRow, firstRow + numRows) range have been
+    // decoded during the given pass, with passes numbered from 0 and images
+    // not using interlacing or progressive encoding having only one pass.
+    // Return false to cancel decoding.
+    virtual bool OnRowsDecoded(const wxImage& image,
+                               int firstRow,
+                               int numRows,
+                               int pass) = 0;
+};
+
+class WXDLLIMPEXP_CORE wxImageIncrementalDecoder
+{
+public:
+    enum State
+    {
+        State_Header,       // waiting for the image header
+        State_Decoding,     // image allocated, decoding its data
+        State_Done,         // the image has been fully decoded
+        State_Failed,       // decoding failed due to an error
+        State_Cancelled     // listener requested to stop decoding
+    };
+
+    // Return the decoder for the given format or nullptr if it is not
+    // available or doesn't support incremental decoding.
+    static wxImageIncrementalDecoder* Create(wxBitmapType type);
+
+    virtual ~wxImageIncrementalDecoder() = default;
+
+    // The listener is not owned by the decoder and may be null.
+    void SetListener(wxImageDecodeListener* listener) { m_listener = listener; }
+
+    // By default, errors are logged, this can be used to suppress them.
+    void SetVerbose(bool verbose) { m_verbose = verbose; }
+
+    // Decode the next chunk of the image data. Returns false if an error
+    // occurred or decoding was cancelled, i.e. if calling it again is useless.
+    bool Feed(const void* data, size_t len);
+
+    // Indicate that there is no more data. This allows decoding the images
+    // truncated in the middle for the formats supporting it and returns true
+    // if the image was fully decoded.
+    bool Finish();
+
+#if wxUSE_STREAMS
+    // Feed all the data from the stream to the decoder and call Finish().
+    bool Load(wxInputStream& stream);
+#endif // wxUSE_STREAMS
+
+    State GetState() const { return m_state; }
+    bool IsDone() const { return m_state == State_Done; }
+
+    // The image is invalid until the header is decoded and contains only the
+    // rows decoded so far until IsDone() returns true.
+    const wxImage& GetImage() const { return m_image; }
+
+protected:
+    wxImageIncrementalDecoder() = default;
+
+    // Process the given data, which is empty if finish is true. Must return
+    // false only if an error occurred.
+    virtual bool DoFeed(const unsigned char* data, size_t len, bool finish) = 0;
+
+    // Helpers for the derived classes DoFeed() implementation.
+    bool IsVerbose() const { return m_verbose; }
+
+    // Create the image, which must be done before calling AddDecodedRows().
+    bool StartImage(int width, int height, bool hasAlpha, bool clear = false);
+
+    // Notify about the rows decoded during this pass.
+    void AddDecodedRows(int firstRow, int numRows, int pass);
+
+    // Indicate that the image was fully decoded.
+    void SetDone() { m_state = State_Done; }
+
+    wxImage m_image;
+
+private:
+    // Call the listener, if any, and return false if it cancelled decoding.
+    bool NotifyListener();
+
+    // Change the state to failed and log an error if necessary.
+    void SetFailed();
+
+    wxImageDecodeListener* m_listener = nullptr;
+    State m_state = State_Header;
+    bool m_verbose = true;
+
+    // The range of rows decoded since the last notification, if any.
+    bool m_notifyStarted = false;
+    int m_firstRow = -1,
+        m_lastRow = -1,
+        m_pass = 0;
+
+    wxDECLARE_NO_COPY_CLASS(wxImageIncrementalDecoder);
+};
+
 extern void WXDLLIMPEXP_CORE wxInitAllImageHandlers();
 
 extern WXDLLIMPEXP_DATA_CORE(wxImage)    wxNullImage;
@@ -53,6 +53,8 @@ public:
 #if wxUSE_STREAMS
     virtual bool LoadFile( wxImage *image, wxInputStream& stream, bool verbose=true, int index=-1 ) override;
     virtual bool SaveFile( wxImage *image, wxOutputStream& stream, bool verbose=true ) override;
+
+    virtual wxImageIncrementalDecoder* CreateIncrementalDecoder() const override;
 protected:
     virtual bool DoCanRead( wxInputStream& stream ) override;
 #endif
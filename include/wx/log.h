@@ -999,6 +999,35 @@ public:
         DoCallOnLog(wxString::Format(format, args...));
     }
 
+#ifdef wxHAS_STATIC_FORMAT
+    // overloads for the format strings created by wxSTATIC_FORMAT(), which
+    // are parsed and checked at compile-time
+    template <typename F, typename... Targs>
+    typename std::enable_if<wxPrivate::IsStaticFormatString<F>::value>::type
+    Log(const F& format, const Targs&... args)
+    {
+        DoCallOnLog(wxString::Format(format, args...));
+    }
+
+    template <typename F, typename... Targs>
+    typename std::enable_if<wxPrivate::IsStaticFormatString<F>::value>::type
+    Log(long num, const F& format, const Targs&... args)
+    {
+        Store(m_optKey, num);
+
+        DoCallOnLog(wxString::Format(format, args...));
+    }
+
+    template <typename F, typename... Targs>
+    typename std::enable_if<wxPrivate::IsStaticFormatString<F>::value>::type
+    Log(wxObject* ptr, const F& format, const Targs&... args)
+    {
+        Store(m_optKey, wxPtrToUInt(ptr));
+
+        DoCallOnLog(wxString::Format(format, args...));
+    }
+#endif // wxHAS_STATIC_FORMAT
+
     // overload used when there are no format specifiers: we want to avoid
     // using wxString::Format() in this case both because this would be
     // needlessly inefficient and because it would misinterpret any "%"
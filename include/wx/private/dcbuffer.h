@@ -0,0 +1,48 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/private/dcbuffer.h
+// Purpose:     wxWindowBackingStore used by wxBUFFER_PERSISTENT
+// Author:      wxWidgets team
+// Created:     2026-10-17
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_PRIVATE_DCBUFFER_H_
+#define _WX_PRIVATE_DCBUFFER_H_
+
+#include "wx/bitmap.h"
+
+// Backing store of a single window used with wxBUFFER_PERSISTENT style.
+class WXDLLIMPEXP_CORE wxWindowBackingStore
+{
+public:
+    wxWindowBackingStore() = default;
+
+    // Prepare the store for repainting the window with the given client size
+    // and scale factor, scrolled to the given position (device origin).
+    //
+    // If the size and scale didn't change since the last call, the existing
+    // bitmap is reused and, if the window was scrolled, its contents are
+    // moved by the scroll offset, as the window itself does on screen.
+    //
+    // Returns true if the previous contents couldn't be reused at all and so
+    // the entire window must be redrawn.
+    bool Prepare(const wxSize& size, double scale, const wxPoint& origin);
+
+    // Get the bitmap with the current window contents.
+    wxBitmap& GetBitmap() { return m_bitmap; }
+
+private:
+    // the bitmap with the current window contents
+    wxBitmap m_bitmap;
+
+    // another bitmap of the same size, used for scrolling the contents
+    wxBitmap m_spare;
+
+    // the scroll position (device origin) used for the last repaint
+    wxPoint m_origin;
+
+    wxDECLARE_NO_COPY_CLASS(wxWindowBackingStore);
+};
+
+#endif // _WX_PRIVATE_DCBUFFER_H_
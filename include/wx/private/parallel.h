@@ -0,0 +1,139 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/private/parallel.h
+// Purpose:     Helpers for splitting work between several threads
+// Author:      wxWidgets team
+// Created:     2026-10-17
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_PRIVATE_PARALLEL_H_
+#define _WX_PRIVATE_PARALLEL_H_
+
+#include "wx/thread.h"
+
+#include <memory>
+#include <vector>
+
+// Return the number of threads to use for the given maximal number of them,
+// with 0 meaning to use as many threads as there are CPUs.
+inline unsigned int wxGetParallelThreadsCount(unsigned int maxThreads)
+{
+#if wxUSE_THREADS
+    if ( maxThreads == 0 )
+    {
+        const int numCPUs = wxThread::GetCPUCount();
+        maxThreads = numCPUs > 0 ? numCPUs : 1;
+    }
+
+    return maxThreads;
+#else // !wxUSE_THREADS
+    wxUnusedVar(maxThreads);
+
+    return 1;
+#endif // wxUSE_THREADS/!wxUSE_THREADS
+}
+
+#if wxUSE_THREADS
+
+namespace wxPrivate
+{
+
+// Thread calling the given function for a single band.
+template <typename F>
+class ParallelBandThread : public wxThread
+{
+public:
+    ParallelBandThread(const F& func, int start, int end)
+        : wxThread(wxTHREAD_JOINABLE),
+          m_func(func),
+          m_start(start),
+          m_end(end)
+    {
+    }
+
+protected:
+    virtual ExitCode Entry() override
+    {
+        m_func(m_start, m_end);
+
+        return nullptr;
+    }
+
+private:
+    const F& m_func;
+    const int m_start,
+              m_end;
+};
+
+} // namespace wxPrivate
+
+#endif // wxUSE_THREADS
+
+// Call the given function, taking (start, end) arguments, for consecutive
+// non-overlapping bands covering [0, count) range, using up to maxThreads
+// threads (including the current one, and with 0 meaning to use as many
+// threads as there are CPUs) to do it.
+//
+// Each band contains at least minBandSize items, so that no threads are used
+// if there is too little work to do to make it worth it.
+//
+// The function must be safe to call concurrently for different bands and the
+// results must not depend on how the range is split. This function returns
+// only when all the bands have been processed.
+template <typename F>
+void wxParallelForBands(int count,
+                        unsigned int maxThreads,
+                        int minBandSize,
+                        const F& func)
+{
+#if wxUSE_THREADS
+    int numBands = wxGetParallelThreadsCount(maxThreads);
+    if ( minBandSize > 0 && numBands > count / minBandSize )
+        numBands = count / minBandSize;
+
+    if ( numBands > 1 )
+    {
+        typedef wxPrivate::ParallelBandThread<F> BandThread;
+        std::vector< std::unique_ptr<BandThread> > threads;
+
+        // Distribute the remainder of the division among the first bands.
+        const int bandSize = count / numBands;
+        const int extra = count % numBands;
+
+        int start = bandSize + (extra > 0 ? 1 : 0);
+        for ( int n = 1; n < numBands; n++ )
+        {
+            const int end = start + bandSize + (n < extra ? 1 : 0);
+
+            std::unique_ptr<BandThread> thread(new BandThread(func, start, end));
+            if ( thread->Create() == wxTHREAD_NO_ERROR &&
+                    thread->Run() == wxTHREAD_NO_ERROR )
+            {
+                threads.push_back(std::move(thread));
+            }
+            else // Failed to launch the thread, process this band ourselves.
+            {
+                func(start, end);
+            }
+
+            start = end;
+        }
+
+        // Process the first band in this thread while the others are running.
+        func(0, bandSize + (extra > 0 ? 1 : 0));
+
+        for ( const auto& thread : threads )
+            thread->Wait();
+
+        return;
+    }
+#else // !wxUSE_THREADS
+    wxUnusedVar(maxThreads);
+    wxUnusedVar(minBandSize);
+#endif // wxUSE_THREADS/!wxUSE_THREADS
+
+    func(0, count);
+}
+
+#endif // _WX_PRIVATE_PARALLEL_H_
@@ -0,0 +1,40 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        wx/private/simd.h
+// Purpose:     Detection of the SIMD instruction sets usable by wx code
+// Author:      wxWidgets team
+// Created:     2026-10-17
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_PRIVATE_SIMD_H_
+#define _WX_PRIVATE_SIMD_H_
+
+// This header defines wxHAS_SSE2 or wxHAS_NEON if the corresponding
+// instruction set can be used unconditionally, i.e. without checking for its
+// availability at run-time, and includes the header declaring its intrinsics.
+//
+// Note that only the instruction sets which are part of the baseline of the
+// target architecture (SSE2 for x86-64, Advanced SIMD for AArch64) are
+// detected here, so that no run-time dispatch is ever needed: the code using
+// them must always provide a scalar fallback for the other architectures.
+//
+// Defining wxNO_SIMD disables the use of any of them, which can be useful for
+// testing the fallback code.
+
+#ifndef wxNO_SIMD
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define wxHAS_SSE2
+
+    #include <emmintrin.h>
+#elif (defined(__aarch64__) && defined(__ARM_NEON)) || defined(_M_ARM64)
+    #define wxHAS_NEON
+
+    #include <arm_neon.h>
+#endif
+
+#endif // !wxNO_SIMD
+
+#endif // _WX_PRIVATE_SIMD_H_
@@ -45,6 +45,11 @@ public:
                                 wxCoord *height,
                                 wxCoord *heightOneLine = nullptr);
 
+    // Measure all the given single line strings, filling the extents array,
+    // which must have n elements. This is more efficient than calling
+    // GetTextExtent() for each of them.
+    void GetTextExtents(size_t n, const wxString* strings, wxSize* extents);
+
     // Find the dimensions of the largest string.
     wxSize GetLargestStringExtent(size_t n, const wxString* strings);
     wxSize GetLargestStringExtent(const wxArrayString& strings)
@@ -65,6 +70,14 @@ public:
     // This is another method which is only used by MeasuringGuard.
     bool IsUsingDCImpl() const { return m_useDCImpl; }
 
+
+    // Global cache of the extents of the strings measured by DoGetTextExtent()
+    // and DoGetPartialTextExtents(), see wxReadOnlyDC::EnableTextExtentCache().
+    // These functions must be only called from the main thread.
+    static void EnableExtentCache(size_t maxEntries);
+    static void ClearExtentCache();
+    static void GetExtentCacheStats(size_t* hits, size_t* misses);
+
 protected:
     // RAII wrapper for the two methods above.
     class MeasuringGuard
@@ -128,6 +141,25 @@ protected:
                            wxCoord *descent = nullptr,
                            wxCoord *externalLeading = nullptr);
 
+    // Call DoGetTextExtent() or return the cached result of a previous call
+    // to it for the same string in the same context: only used if the cache
+    // is enabled and the string is not empty.
+    void GetTextExtentCached(const wxString& string,
+                             wxCoord *width,
+                             wxCoord *height,
+                             wxCoord *descent,
+                             wxCoord *externalLeading);
+
+    // Same as GetTextExtentCached() but for DoGetPartialTextExtents().
+    bool GetPartialTextExtentsCached(const wxString& text,
+                                     wxArrayInt& widths,
+                                     double scaleX);
+
+    // Return the part of the cache key identifying the font and everything
+    // else affecting the measurement results, or empty string if the cache
+    // can't be used because the font is unknown.
+    const wxString& GetCacheContext();
+
     // Get line height: used when the line is empty because CallGetTextExtent()
     // would just return (0, 0) in this case.
     int GetEmptyLineHeight();
@@ -155,6 +187,11 @@ protected:
     // This one can be null or not.
     const wxFont* const m_font;
 
+    // The part of the extent cache key identifying the font and everything
+    // else affecting the results of DoGetTextExtent() and
+    // DoGetPartialTextExtents(), computed on demand by GetCacheContext().
+    wxString m_cacheContext;
+
     wxDECLARE_NO_COPY_CLASS(wxTextMeasureBase);
 };
 
@@ -10,7 +10,42 @@
 #ifndef _WX_PRIVATE_UNICODEH__
 #define _WX_PRIVATE_UNICODEH__
 
+#include "wx/private/simd.h"
+
 // this table gives the length of the UTF-8 encoding from its first character:
 extern const unsigned char tableUtf8Lengths[256];
 
+// Return the number of ASCII characters, i.e. bytes less than 0x80, at the
+// beginning of the given buffer of the given length.
+//
+// This is used to skip the runs of ASCII characters, which are very common
+// even in non-English texts, in bulk instead of decoding them one by one.
+inline size_t wxGetASCIIPrefixLength(const char* s, size_t len)
+{
+    size_t n = 0;
+
+#if defined(wxHAS_SSE2)
+    for ( ; n + 16 <= len; n += 16 )
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + n));
+        if ( _mm_movemask_epi8(v) )
+            break;
+    }
+#elif defined(wxHAS_NEON)
+    for ( ; n + 16 <= len; n += 16 )
+    {
+        const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(s + n));
+        if ( vmaxvq_u8(v) & 0x80 )
+            break;
+    }
+#endif
+
+    // Find the exact position of the first non-ASCII character in the last
+    // block, or handle the entire string if no SIMD instructions are used.
+    while ( n < len && !(s[n] & 0x80) )
+        n++;
+
+    return n;
+}
+
 #endif // _WX_PRIVATE_UNICODEH__
@@ -0,0 +1,749 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        wx/staticformat.h
+// Purpose:     Format strings parsed and checked at compile-time
+// Author:      wxWidgets team
+// Created:     2026-10-17
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_STATICFORMAT_H_
+#define _WX_STATICFORMAT_H_
+
+#include "wx/string.h"
+
+#include <type_traits>
+
+// ----------------------------------------------------------------------------
+// Types shared by the compile-time parser and the run-time formatting code
+// ----------------------------------------------------------------------------
+
+// Notice that these types are used by the library itself, which may be
+// compiled in C++11 mode, so they can't use any C++17 features, unlike the
+// parser below, which is only available when using C++17.
+namespace wxPrivate
+{
+
+// Flags of a conversion specification.
+enum
+{
+    StaticFormat_Minus = 1,     // '-'
+    StaticFormat_Plus  = 2,     // '+'
+    StaticFormat_Space = 4,     // ' '
+    StaticFormat_Zero  = 8,     // '0'
+    StaticFormat_Alt   = 16     // '#'
+};
+
+// A single element of the parsed format string: the literal text followed by
+// a conversion specification.
+struct StaticFormatItem
+{
+    // Position and length of the literal text in the format string.
+    unsigned textStart;
+    unsigned textLen;
+
+    // Conversion character, '%' for "%%" or 0 for the text at the end of the
+    // format string which is not followed by any conversion.
+    char conv;
+
+    // Combination of StaticFormat_XXX flags.
+    unsigned char flags;
+
+    // Index of the argument used by this conversion.
+    unsigned char arg;
+
+    // Width and precision or -1 if not specified.
+    int width;
+    int precision;
+
+    // Size of the type to which the integer argument is converted because of
+    // "h" or "hh" size modifier or 0 if none of them is used.
+    unsigned char intSize;
+};
+
+// Kinds of the arguments, determined by their type at compile-time.
+enum StaticFormatArgKind
+{
+    StaticFormatArg_Int,        // signed integer in "i" of the given size
+    StaticFormatArg_UInt,       // unsigned integer in "u" of the given size
+    StaticFormatArg_Double,     // floating point number in "d"
+    StaticFormatArg_NarrowStr,  // char string in "p" using the current locale
+    StaticFormatArg_WideStr,    // wchar_t string in "p"
+    StaticFormatArg_ImplStr,    // wxStringCharType string in "p"
+    StaticFormatArg_Pointer     // any other pointer in "p"
+};
+
+// Type-erased argument passed to the formatting function.
+struct StaticFormatArg
+{
+    StaticFormatArgKind kind;
+
+    // Size of the integer type for StaticFormatArg_[U]Int.
+    unsigned size;
+
+    union
+    {
+        long long i;
+        unsigned long long u;
+        double d;
+        const void* p;
+    };
+
+    // Length of the string or wxString::npos if it is NUL-terminated.
+    size_t len;
+};
+
+// Functions doing the formatting at run-time: they are only exported for use
+// by the templates below and shouldn't be used directly.
+WXDLLIMPEXP_BASE wxString
+DoStaticFormat(const char* format, bool isAscii,
+               const StaticFormatItem* items, size_t count,
+               const StaticFormatArg* args);
+WXDLLIMPEXP_BASE wxString
+DoStaticFormat(const wchar_t* format, bool isAscii,
+               const StaticFormatItem* items, size_t count,
+               const StaticFormatArg* args);
+
+} // namespace wxPrivate
+
+#ifdef wxHAS_STATIC_FORMAT
+
+// ----------------------------------------------------------------------------
+// wxSTATIC_FORMAT: create a format string parsed at compile-time
+// ----------------------------------------------------------------------------
+
+// The argument of this macro must be a string literal, which can be either
+// narrow or wide. The result can be passed to wxString::Format() and to the
+// wxLogXXX() functions instead of a normal format string.
+#define wxSTATIC_FORMAT(fmt)                                                  \
+    [] {                                                                      \
+        struct wxStaticFormatString : wxPrivate::StaticFormatStringBase       \
+        {                                                                     \
+            static constexpr auto& Get() { return fmt; }                      \
+        };                                                                    \
+        return wxStaticFormatString();                                        \
+    }()
+
+namespace wxPrivate
+{
+
+struct StaticFormatStringBase
+{
+};
+
+template <typename F>
+struct IsStaticFormatString
+    : std::is_base_of<StaticFormatStringBase, F>
+{
+};
+
+// Errors detected by the parser.
+enum StaticFormatError
+{
+    StaticFormatError_None,
+    StaticFormatError_Syntax,       // invalid or unsupported specification
+    StaticFormatError_Positional    // mixing positional and normal ones
+};
+
+// Classes of the conversions and the argument types compatible with them.
+enum
+{
+    StaticFormatClass_None    = 0,
+    StaticFormatClass_Int     = 1,
+    StaticFormatClass_Char    = 2,
+    StaticFormatClass_Float   = 4,
+    StaticFormatClass_String  = 8,
+    StaticFormatClass_Pointer = 16
+};
+
+constexpr int GetStaticFormatClass(char conv)
+{
+    switch ( conv )
+    {
+        case 'd': case 'i': case 'u': case 'o': case 'x': case 'X':
+            return StaticFormatClass_Int;
+
+        case 'c':
+            return StaticFormatClass_Char;
+
+        case 'f': case 'F': case 'e': case 'E':
+        case 'g': case 'G': case 'a': case 'A':
+            return StaticFormatClass_Float;
+
+        case 's':
+            return StaticFormatClass_String;
+
+        case 'p':
+            return StaticFormatClass_Pointer;
+    }
+
+    return StaticFormatClass_None;
+}
+
+template <size_t N>
+struct StaticFormatParseResult
+{
+    StaticFormatItem items[N];
+
+    StaticFormatError error;
+
+    // Number of arguments used by the format string.
+    unsigned numArgs;
+
+    // True if the format string contains only ASCII characters.
+    bool isAscii;
+};
+
+template <typename CharT>
+constexpr bool IsStaticFormatDigit(CharT ch)
+{
+    return ch >= '0' && ch <= '9';
+}
+
+// Return the number of items in the format string of the given length.
+template <typename CharT>
+constexpr size_t CountStaticFormatItems(const CharT* s, size_t len)
+{
+    size_t count = 1;
+    for ( size_t n = 0; n < len; n++ )
+    {
+        if ( s[n] == '%' )
+        {
+            count++;
+
+            // Skip the second '%' of "%%", as it doesn't start a new item.
+            if ( n + 1 < len && s[n + 1] == '%' )
+                n++;
+        }
+    }
+
+    return count;
+}
+
+template <size_t N, typename CharT>
+constexpr StaticFormatParseResult<N>
+ParseStaticFormat(const CharT* s, size_t len)
+{
+    StaticFormatParseResult<N> r{};
+    r.error = StaticFormatError_None;
+    r.numArgs = 0;
+    r.isAscii = true;
+
+    // Whether positional parameters are used: -1 if unknown yet, 0 or 1.
+    int positional = -1;
+
+    unsigned nextArg = 0;
+    size_t item = 0;
+    size_t textStart = 0;
+    size_t pos = 0;
+    while ( pos < len )
+    {
+        const CharT ch = s[pos];
+        if ( ch != '%' )
+        {
+            // Note that CharT may be signed, so use the cast to check for
+            // negative values too.
+            if ( static_cast<unsigned long>(ch) > 0x7f )
+                r.isAscii = false;
+
+            pos++;
+            continue;
+        }
+
+        StaticFormatItem& it = r.items[item++];
+        it.textStart = static_cast<unsigned>(textStart);
+        it.textLen = static_cast<unsigned>(pos - textStart);
+        it.width = -1;
+        it.precision = -1;
+
+        if ( ++pos == len )
+        {
+            r.error = StaticFormatError_Syntax;
+            return r;
+        }
+
+        if ( s[pos] == '%' )
+        {
+            it.conv = '%';
+            textStart = ++pos;
+            continue;
+        }
+
+        // Check for the positional parameter index followed by '$'.
+        int argIndex = -1;
+        size_t end = pos;
+        int value = 0;
+        while ( end < len && IsStaticFormatDigit(s[end]) && value < 1000 )
+            value = value*10 + (s[end++] - '0');
+
+        const bool isPositional = end < len && s[end] == '$';
+        if ( isPositional )
+        {
+            if ( value < 1 || value > 255 )
+            {
+                r.error = StaticFormatError_Syntax;
+                return r;
+            }
+
+            argIndex = value - 1;
+            pos = end + 1;
+        }
+
+        if ( positional == -1 )
+            positional = isPositional;
+        else if ( positional != isPositional )
+        {
+            r.error = StaticFormatError_Positional;
+            return r;
+        }
+
+        for ( ; pos < len; pos++ )
+        {
+            unsigned char flag = 0;
+            switch ( s[pos] )
+            {
+                case '-': flag = StaticFormat_Minus; break;
+                case '+': flag = StaticFormat_Plus;  break;
+                case ' ': flag = StaticFormat_Space; break;
+                case '0': flag = StaticFormat_Zero;  break;
+                case '#': flag = StaticFormat_Alt;   break;
+            }
+
+            if ( !flag )
+                break;
+
+            it.flags |= flag;
+        }
+
+        // Notice that '*' is not supported for width and precision, as they
+        // can be just specified directly in the compile-time format string.
+        if ( pos < len && IsStaticFormatDigit(s[pos]) )
+        {
+            it.width = 0;
+            while ( pos < len && IsStaticFormatDigit(s[pos]) )
+            {
+                it.width = it.width*10 + (s[pos++] - '0');
+                if ( it.width > 10000 )
+                {
+                    r.error = StaticFormatError_Syntax;
+                    return r;
+                }
+            }
+        }
+
+        if ( pos < len && s[pos] == '.' )
+        {
+            it.precision = 0;
+            while ( ++pos < len && IsStaticFormatDigit(s[pos]) )
+            {
+                it.precision = it.precision*10 + (s[pos] - '0');
+                if ( it.precision > 10000 )
+                {
+                    r.error = StaticFormatError_Syntax;
+                    return r;
+                }
+            }
+        }
+
+        // Skip the size modifiers: they are accepted for compatibility with
+        // the normal format strings, but not needed, as the actual types of
+        // the arguments are always used, except for "h" and "hh" which
+        // truncate the value to short or char, as printf() does.
+        while ( pos < len )
+        {
+            const CharT m = s[pos];
+            if ( m == 'h' )
+            {
+                it.intSize = it.intSize ? sizeof(char) : sizeof(short);
+                pos++;
+            }
+            else if ( m == 'l' || m == 'L' || m == 'q' ||
+                        m == 'j' || m == 'z' || m == 't' )
+            {
+                pos++;
+            }
+            else if ( m == 'I' )
+            {
+                // Microsoft-specific I, I32 and I64 modifiers.
+                pos++;
+                if ( pos + 1 < len &&
+                        ((s[pos] == '3' && s[pos + 1] == '2') ||
+                         (s[pos] == '6' && s[pos + 1] == '4')) )
+                    pos += 2;
+            }
+            else
+            {
+                break;
+            }
+        }
+
+        if ( pos == len )
+        {
+            r.error = StaticFormatError_Syntax;
+            return r;
+        }
+
+        const CharT conv = s[pos++];
+        if ( static_cast<unsigned long>(conv) > 0x7f ||
+                GetStaticFormatClass(static_cast<char>(conv)) == StaticFormatClass_None )
+        {
+            r.error = StaticFormatError_Syntax;
+            return r;
+        }
+
+        it.conv = static_cast<char>(conv);
+
+        if ( argIndex == -1 )
+        {
+            if ( nextArg > 255 )
+            {
+                r.error = StaticFormatError_Syntax;
+                return r;
+            }
+
+            argIndex = static_cast<int>(nextArg++);
+        }
+
+        it.arg = static_cast<unsigned char>(argIndex);
+        if ( static_cast<unsigned>(argIndex) + 1 > r.numArgs )
+            r.numArgs = static_cast<unsigned>(argIndex) + 1;
+
+        textStart = pos;
+    }
+
+    StaticFormatItem& last = r.items[item];
+    last.textStart = static_cast<unsigned>(textStart);
+    last.textLen = static_cast<unsigned>(len - textStart);
+    last.conv = 0;
+
+    return r;
+}
+
+// This struct contains the parse result for the given wxSTATIC_FORMAT() type.
+template <typename F>
+struct StaticFormatParsed
+{
+    using CharType =
+        typename std::remove_cv<
+            typename std::remove_reference<decltype(F::Get()[0])>::type
+        >::type;
+
+    // Exclude the trailing NUL.
+    static constexpr size_t length = sizeof(F::Get())/sizeof(CharType) - 1;
+
+    static constexpr size_t count = CountStaticFormatItems(F::Get(), length);
+
+    static constexpr StaticFormatParseResult<count>
+        result = ParseStaticFormat<count>(F::Get(), length);
+};
+
+// Check that the argument types are compatible with the conversions.
+template <size_t N>
+constexpr bool
+CheckStaticFormatArgs(const StaticFormatParseResult<N>& r,
+                      const int* classes, size_t numClasses)
+{
+    for ( size_t n = 0; n < N; n++ )
+    {
+        const StaticFormatItem& it = r.items[n];
+        if ( !it.conv || it.conv == '%' )
+            continue;
+
+        if ( it.arg >= numClasses ||
+                !(classes[it.arg] & GetStaticFormatClass(it.conv)) )
+            return false;
+    }
+
+    return true;
+}
+
+// Traits defining the conversions compatible with the given argument type
+// and how to convert it to StaticFormatArg.
+template <typename T, typename Enable = void>
+struct StaticFormatArgTraits
+{
+    static constexpr int classes = StaticFormatClass_None;
+};
+
+template <typename T>
+struct StaticFormatArgTraits<T,
+    typename std::enable_if<std::is_integral<T>::value>::type>
+{
+    static constexpr int classes = StaticFormatClass_Int |
+                                   StaticFormatClass_Char;
+
+    static StaticFormatArg Make(T value)
+    {
+        StaticFormatArg arg;
+        arg.size = sizeof(T);
+        arg.len = 0;
+
+        if ( std::is_signed<T>::value )
+        {
+            arg.kind = StaticFormatArg_Int;
+            arg.i = static_cast<long long>(value);
+        }
+        else
+        {
+            arg.kind = StaticFormatArg_UInt;
+            arg.u = static_cast<unsigned long long>(value);
+        }
+
+        return arg;
+    }
+};
+
+// Enums are formatted as their underlying integer type.
+template <typename T>
+struct StaticFormatArgTraits<T,
+    typename std::enable_if<std::is_enum<T>::value>::type>
+{
+    using Underlying = typename std::underlying_type<T>::type;
+
+    static constexpr int classes = StaticFormatClass_Int;
+
+    static StaticFormatArg Make(T value)
+    {
+        return StaticFormatArgTraits<Underlying>::Make(
+                    static_cast<Underlying>(value));
+    }
+};
+
+template <typename T>
+struct StaticFormatArgTraits<T,
+    typename std::enable_if<std::is_floating_point<T>::value>::type>
+{
+    static constexpr int classes = StaticFormatClass_Float;
+
+    static StaticFormatArg Make(T value)
+    {
+        StaticFormatArg arg;
+        arg.kind = StaticFormatArg_Double;
+        arg.size = sizeof(double);
+        arg.d = static_cast<double>(value);
+        arg.len = 0;
+        return arg;
+    }
+};
+
+template <>
+struct StaticFormatArgTraits<wxUniChar>
+{
+    static constexpr int classes = StaticFormatClass_Int |
+                                   StaticFormatClass_Char;
+
+    static StaticFormatArg Make(const wxUniChar& ch)
+    {
+        StaticFormatArg arg;
+        arg.kind = StaticFormatArg_UInt;
+        arg.size = sizeof(wxUniChar::value_type);
+        arg.u = ch.GetValue();
+        arg.len = 0;
+        return arg;
+    }
+};
+
+template <>
+struct StaticFormatArgTraits<wxUniCharRef>
+    : StaticFormatArgTraits<wxUniChar>
+{
+};
+
+// Helper for all string types.
+inline StaticFormatArg
+MakeStaticFormatStringArg(StaticFormatArgKind kind, const void* p, size_t len)
+{
+    StaticFormatArg arg;
+    arg.kind = kind;
+    arg.size = 0;
+    arg.p = p;
+    arg.len = len;
+    return arg;
+}
+
+template <typename T>
+struct StaticFormatArgTraits<T*>
+{
+    static constexpr int classes = StaticFormatClass_Pointer;
+
+    static StaticFormatArg Make(const T* p)
+    {
+        return MakeStaticFormatStringArg(StaticFormatArg_Pointer, p, 0);
+    }
+};
+
+template <>
+struct StaticFormatArgTraits<const char*>
+{
+    static constexpr int classes = StaticFormatClass_String |
+                                   StaticFormatClass_Pointer;
+
+    static StaticFormatArg Make(const char* s)
+    {
+        return MakeStaticFormatStringArg(StaticFormatArg_NarrowStr, s,
+                                         wxString::npos);
+    }
+};
+
+template <>
+struct StaticFormatArgTraits<char*> : StaticFormatArgTraits<const char*>
+{
+};
+
+template <>
+struct StaticFormatArgTraits<const wchar_t*>
+{
+    static constexpr int classes = StaticFormatClass_String |
+                                   StaticFormatClass_Pointer;
+
+    static StaticFormatArg Make(const wchar_t* s)
+    {
+        return MakeStaticFormatStringArg(StaticFormatArg_WideStr, s,
+                                         wxString::npos);
+    }
+};
+
+template <>
+struct StaticFormatArgTraits<wchar_t*> : StaticFormatArgTraits<const wchar_t*>
+{
+};
+
+template <>
+struct StaticFormatArgTraits<std::string>
+{
+    static constexpr int classes = StaticFormatClass_String;
+
+    static StaticFormatArg Make(const std::string& s)
+    {
+        return MakeStaticFormatStringArg(StaticFormatArg_NarrowStr,
+                                         s.data(), s.length());
+    }
+};
+
+template <>
+struct StaticFormatArgTraits<std::wstring>
+{
+    static constexpr int classes = StaticFormatClass_String;
+
+    static StaticFormatArg Make(const std::wstring& s)
+    {
+        return MakeStaticFormatStringArg(StaticFormatArg_WideStr,
+                                         s.data(), s.length());
+    }
+};
+
+template <>
+struct StaticFormatArgTraits<wxString>
+{
+    static constexpr int classes = StaticFormatClass_String;
+
+    static StaticFormatArg Make(const wxString& s)
+    {
+#if wxUSE_UNICODE_UTF8
+        const size_t len = s.utf8_length();
+#else
+        const size_t len = s.length();
+#endif
+        return MakeStaticFormatStringArg(StaticFormatArg_ImplStr,
+                                         s.wx_str(), len);
+    }
+};
+
+template <>
+struct StaticFormatArgTraits<wxCStrData>
+{
+    static constexpr int classes = StaticFormatClass_String;
+
+    static StaticFormatArg Make(const wxCStrData& s)
+    {
+        return MakeStaticFormatStringArg(StaticFormatArg_ImplStr,
+                                         s.AsInternal(), wxString::npos);
+    }
+};
+
+template <>
+struct StaticFormatArgTraits<wxScopedCharBuffer>
+{
+    static constexpr int classes = StaticFormatClass_String;
+
+    static StaticFormatArg Make(const wxScopedCharBuffer& buf)
+    {
+        return MakeStaticFormatStringArg(StaticFormatArg_NarrowStr,
+                                         buf.data(), buf.length());
+    }
+};
+
+template <>
+struct StaticFormatArgTraits<wxCharBuffer>
+    : StaticFormatArgTraits<wxScopedCharBuffer>
+{
+};
+
+template <>
+struct StaticFormatArgTraits<wxScopedWCharBuffer>
+{
+    static constexpr int classes = StaticFormatClass_String;
+
+    static StaticFormatArg Make(const wxScopedWCharBuffer& buf)
+    {
+        return MakeStaticFormatStringArg(StaticFormatArg_WideStr,
+                                         buf.data(), buf.length());
+    }
+};
+
+template <>
+struct StaticFormatArgTraits<wxWCharBuffer>
+    : StaticFormatArgTraits<wxScopedWCharBuffer>
+{
+};
+
+// Arrays, e.g. string literals, are handled as pointers.
+template <typename T>
+using StaticFormatArgTraitsFor = StaticFormatArgTraits<typename std::decay<T>::type>;
+
+} // namespace wxPrivate
+
+// ----------------------------------------------------------------------------
+// wxString::Format() overload for wxSTATIC_FORMAT()
+// ----------------------------------------------------------------------------
+
+template <typename F, typename... Targs>
+inline
+typename std::enable_if<wxPrivate::IsStaticFormatString<F>::value, wxString>::type
+wxString::Format(const F& WXUNUSED(format), const Targs&... args)
+{
+    using Parsed = wxPrivate::StaticFormatParsed<F>;
+
+    static_assert(Parsed::result.error != wxPrivate::StaticFormatError_Syntax,
+                  "Invalid or unsupported format specification.");
+    static_assert(Parsed::result.error != wxPrivate::StaticFormatError_Positional,
+                  "Positional and non-positional format specifications "
+                  "can't be mixed.");
+    static_assert(Parsed::result.numArgs == sizeof...(Targs),
+                  "Number of arguments doesn't match the format string.");
+
+    // Use an extra element to avoid zero-sized arrays.
+    static constexpr int classes[] =
+    {
+        wxPrivate::StaticFormatArgTraitsFor<Targs>::classes...,
+        wxPrivate::StaticFormatClass_None
+    };
+
+    static_assert(wxPrivate::CheckStaticFormatArgs(Parsed::result, classes,
+                                                     sizeof...(Targs)),
+                  "Argument type doesn't match the format specification.");
+
+    const wxPrivate::StaticFormatArg argsArray[] =
+    {
+        wxPrivate::StaticFormatArgTraitsFor<Targs>::Make(args)...,
+        wxPrivate::StaticFormatArg()
+    };
+
+    return wxPrivate::DoStaticFormat(F::Get(), Parsed::result.isAscii,
+                                     Parsed::result.items, Parsed::count,
+                                     argsArray);
+}
+
+#endif // wxHAS_STATIC_FORMAT
+
+#endif // _WX_STATICFORMAT_H_
@@ -111,9 +111,19 @@ class WXDLLIMPEXP_FWD_BASE wxString;
     #endif
 #endif // wxUSE_STD_STRING_CONV_IN_WXSTRING
 
+// Format strings parsed at compile-time, see wx/staticformat.h, can only be
+// used with C++17 compilers.
+#if wxCHECK_CXX_STD(201703L)
+    #define wxHAS_STATIC_FORMAT
+#endif
+
 namespace wxPrivate
 {
     template <typename T> struct wxStringAsBufHelper;
+
+#ifdef wxHAS_STATIC_FORMAT
+    template <typename F> struct IsStaticFormatString;
+#endif
 }
 
 // All the symbols here only exist for compatibility in case they're referenced
@@ -2482,6 +2492,8 @@ public:
   static wxString FromDouble(double val, int precision = -1);
     // in C locale
   static wxString FromCDouble(double val, int precision = -1);
+    // in C locale using the shortest representation preserving the value
+  static wxString FromCDoubleShortest(double val);
 
   // formatted input/output
     // as sprintf(), returns the number of characters written or < 0 on error
@@ -2513,6 +2525,14 @@ public:
       s.Printf(format, args...);
       return s;
   }
+#ifdef wxHAS_STATIC_FORMAT
+    // overload for the format strings created by wxSTATIC_FORMAT(), which are
+    // parsed and checked at compile-time; defined in wx/staticformat.h
+  template <typename F, typename... Targs>
+  static
+  typename std::enable_if<wxPrivate::IsStaticFormatString<F>::value, wxString>::type
+  Format(const F& format, const Targs&... args);
+#endif // wxHAS_STATIC_FORMAT
     // the same as above, but takes a va_list
   static wxString FormatV(const wxString& format, va_list argptr);
 
@@ -4418,4 +4438,8 @@ template<bool (T)(const wxUniChar& c)>
         return true;
     }
 
+#ifdef wxHAS_STATIC_FORMAT
+    #include "wx/staticformat.h"
+#endif
+
 #endif  // _WX_WXSTRING_H_
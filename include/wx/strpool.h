@@ -0,0 +1,183 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        wx/strpool.h
+// Purpose:     wxStringPool: compact storage for many short strings
+// Author:      wxWidgets team
+// Created:     2026-10-17
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef _WX_STRPOOL_H_
+#define _WX_STRPOOL_H_
+
+#include "wx/string.h"
+#include "wx/arrstr.h"
+
+#include <memory>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+// wxPooledString: non-owning view of a string stored in wxStringPool
+// ----------------------------------------------------------------------------
+
+class wxPooledString
+{
+public:
+    wxPooledString() : m_data(wxS("")), m_len(0) { }
+
+    wxPooledString(const wxStringCharType* data, size_t len)
+        : m_data(data), m_len(len)
+    {
+    }
+
+    // Return the NUL-terminated string data in the internal wxString
+    // representation.
+    const wxStringCharType* data() const { return m_data; }
+    const wxStringCharType* c_str() const { return m_data; }
+
+    // Return the length in units of wxStringCharType, i.e. the same as
+    // wxString::length() except in UTF-8 build.
+    size_t length() const { return m_len; }
+    bool empty() const { return m_len == 0; }
+
+    // Create a real, owning, string with the same contents.
+    wxString ToString() const
+    {
+#if wxUSE_UNICODE_UTF8
+        return wxString::FromUTF8Unchecked(m_data, m_len);
+#else
+        return wxString(m_data, m_len);
+#endif
+    }
+
+    operator wxString() const { return ToString(); }
+
+    bool IsSameAs(const wxStringCharType* data, size_t len) const
+    {
+        return m_len == len &&
+                std::char_traits<wxStringCharType>::compare(m_data, data, len) == 0;
+    }
+
+    bool operator==(const wxPooledString& other) const
+        { return IsSameAs(other.m_data, other.m_len); }
+    bool operator!=(const wxPooledString& other) const
+        { return !(*this == other); }
+
+    bool operator==(const wxString& s) const
+    {
+#if wxUSE_UNICODE_UTF8
+        return IsSameAs(s.wx_str(), s.utf8_length());
+#else
+        return IsSameAs(s.wx_str(), s.length());
+#endif
+    }
+    bool operator!=(const wxString& s) const
+        { return !(*this == s); }
+
+private:
+    const wxStringCharType* m_data;
+    size_t m_len;
+};
+
+// ----------------------------------------------------------------------------
+// wxStringPool: stores many strings contiguously in big memory chunks
+// ----------------------------------------------------------------------------
+
+class WXDLLIMPEXP_BASE wxStringPool
+{
+public:
+    typedef std::vector<wxPooledString>::const_iterator const_iterator;
+
+    // The strings are stored in chunks big enough to hold at least the given
+    // number of characters, including the trailing NULs.
+    explicit wxStringPool(size_t chunkSize = 16384);
+
+    // Add a copy of the string to the pool and return its index.
+    size_t Add(const wxString& s)
+        { return Add(s.wx_str(), GetImplLength(s)); }
+    size_t Add(const wxStringCharType* s, size_t len);
+
+    // Add all strings in the given range in bulk, allocating the memory for
+    // all of them at once.
+    template <typename Iterator>
+    void Append(Iterator first, Iterator last)
+    {
+        size_t count = 0,
+               total = 0;
+        for ( Iterator it = first; it != last; ++it )
+        {
+            count++;
+            total += GetImplLength(*it);
+        }
+
+        Reserve(count, total);
+
+        for ( Iterator it = first; it != last; ++it )
+            Add(*it);
+    }
+
+    void Append(const wxArrayString& strings)
+        { Append(strings.begin(), strings.end()); }
+
+    // Preallocate memory for the given number of strings of the given total
+    // length, not including the trailing NULs.
+    void Reserve(size_t count, size_t totalLength);
+
+    // Remove all strings but keep the allocated memory for reusing it.
+    void Empty();
+
+    // Remove all strings and free all memory.
+    void Clear();
+
+    size_t GetCount() const { return m_strings.size(); }
+    bool IsEmpty() const { return m_strings.empty(); }
+
+    wxPooledString Item(size_t n) const
+    {
+        wxCHECK_MSG( n < m_strings.size(), wxPooledString(),
+                     "invalid index in wxStringPool" );
+
+        return m_strings[n];
+    }
+
+    wxPooledString operator[](size_t n) const { return Item(n); }
+
+    const_iterator begin() const { return m_strings.begin(); }
+    const_iterator end() const { return m_strings.end(); }
+
+    // Return the total size of the memory chunks used by the pool, in bytes.
+    size_t GetMemoryUsage() const;
+
+private:
+    static size_t GetImplLength(const wxString& s)
+    {
+#if wxUSE_UNICODE_UTF8
+        return s.utf8_length();
+#else
+        return s.length();
+#endif
+    }
+
+    // Return the pointer to the memory for n characters.
+    wxStringCharType* Allocate(size_t n);
+
+    struct Chunk
+    {
+        std::unique_ptr<wxStringCharType[]> data;
+        size_t size;
+        size_t used;
+    };
+
+    const size_t m_chunkSize;
+
+    std::vector<Chunk> m_chunks;
+
+    // Index of the chunk used for allocating memory.
+    size_t m_current;
+
+    std::vector<wxPooledString> m_strings;
+
+    wxDECLARE_NO_COPY_CLASS(wxStringPool);
+};
+
+#endif // _WX_STRPOOL_H_
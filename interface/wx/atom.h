@@ -0,0 +1,117 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        atom.h
+// Purpose:     interface of wxAtom
+// Author:      wxWidgets team
+// Created:     2026-10-17
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+    @class wxAtom
+
+    Interned string allowing fast comparison and hashing.
+
+    All wxAtom objects created from the same string refer to the single copy
+    of this string stored in a global table, so comparing two atoms or
+    computing the hash of an atom takes constant time, independently of the
+    length of the string. This makes atoms well-suited for use as keys in
+    hash maps which are looked up often, e.g. for caching some values
+    associated with string identifiers.
+
+    Creating an atom, on the other hand, requires looking up the string in
+    the global table, so it is as expensive as a hash map lookup using the
+    string itself. To benefit from using atoms, they should be created once,
+    e.g. stored in static variables, and reused afterwards.
+
+    Notice that the strings are never removed from the global table, so atoms
+    should only be used for a limited set of identifiers, such as wxArtID
+    values or XRC class names, and not for arbitrary user-defined strings.
+
+    Atoms can be created from multiple threads concurrently.
+
+    Example:
+    @code
+    std::unordered_map<wxAtom, wxBitmap> cache;
+
+    static const wxAtom idFolder(wxART_FOLDER);
+    cache[idFolder] = ...;
+    @endcode
+
+    @library{wxbase}
+    @category{data}
+
+    @see wxString
+
+    @since 3.3.2
+*/
+class wxAtom
+{
+public:
+    /**
+        Default constructor creates the atom for the empty string.
+
+        This constructor doesn't need to look up anything in the global
+        table and so is cheap.
+    */
+    wxAtom();
+
+    /**
+        Return the atom for the given string.
+
+        The atom is created if it didn't exist yet.
+    */
+    explicit wxAtom(const wxString& s);
+
+    /**
+        Return the string corresponding to this atom.
+
+        The returned reference remains valid until the end of the program.
+    */
+    const wxString& GetString() const;
+
+    /// Return @true if this is the atom for the empty string.
+    bool IsEmpty() const;
+
+    /**
+        Return the hash value of the atom.
+
+        The hash value is the same for all atoms with the same string, but,
+        unlike the string contents, may change from one program run to the
+        next one.
+
+        This is used by the specialization of @c std::hash for wxAtom.
+    */
+    size_t GetHash() const;
+
+    ///@{
+    /**
+        Compare two atoms.
+
+        This just compares the pointers to the strings and so is very fast.
+    */
+    bool operator==(const wxAtom& other) const;
+    bool operator!=(const wxAtom& other) const;
+    ///@}
+
+    ///@{
+    /**
+        Compare the atom with the given string.
+
+        This compares the string contents but doesn't require creating the
+        atom for the string.
+    */
+    bool operator==(const wxString& s) const;
+    bool operator!=(const wxString& s) const;
+    ///@}
+
+    /**
+        Order the atoms.
+
+        The order is arbitrary and doesn't correspond to the order of the
+        strings, but it is fixed during the program execution, so this
+        operator can be used to store atoms in ordered containers such as
+        @c std::map.
+    */
+    bool operator<(const wxAtom& other) const;
+};
@@ -275,6 +275,9 @@ public:
             this bundle. As SVG images usually don't have any natural
             default size, it should be provided when creating the bundle.
 
+        Big images are rasterized in horizontal bands using several threads
+        if allowed by wxImage::SetMaxThreads().
+
         @note Converting text objects to path objects will allow them to be
             rasterized as expected. This can be done in an SVG editor such as
             Inkscape. (In Inkscape, select a text object and choose
@@ -323,6 +326,116 @@ public:
      */
     static wxBitmapBundle FromSVGResource(const wxString& name, const wxSize& sizeDef);
 
+    /**
+        Set the maximal amount of memory used by the bitmaps rasterized from
+        SVG images.
+
+        The bitmaps created by the bundles returned by FromSVG() and the
+        related functions are cached, so that requesting a bitmap of the same
+        size again, from the same bundle or from another bundle created from
+        the same SVG data, doesn't rasterize the image again. Bundles created
+        from the same data also share the parsed SVG image, so creating them
+        is cheap.
+
+        When the total size of the cached bitmaps exceeds the limit set by
+        this function, the least recently used ones are discarded. Note that
+        the most recently used bitmap is always kept, even if it is bigger
+        than the limit.
+
+        By default the limit is 16MiB.
+
+        This function is only available if @c wxHAS_SVG is defined.
+
+        @see GetSVGCacheSize(), TrimSVGCache()
+
+        @since 3.3.2
+     */
+    static void SetSVGCacheLimit(size_t maxBytes);
+
+    /**
+        Return the limit set by SetSVGCacheLimit().
+
+        @since 3.3.2
+     */
+    static size_t GetSVGCacheLimit();
+
+    /**
+        Return the amount of memory, in bytes, used by the cached bitmaps
+        rasterized from SVG images.
+
+        @since 3.3.2
+     */
+    static size_t GetSVGCacheSize();
+
+    /**
+        Discard the cached bitmaps rasterized from SVG images.
+
+        The least recently used bitmaps are discarded until the total size of
+        the remaining ones is not greater than @a maxBytes, which means that
+        all of them are discarded by default.
+
+        This can be used to free memory when the application knows that it is
+        not going to use the bitmaps created from the SVG images any more, e.g.
+        after closing a window using many of them.
+
+        @since 3.3.2
+     */
+    static void TrimSVGCache(size_t maxBytes = 0);
+
+    /**
+        Create a bundle from the SVG data and rasterize it in background.
+
+        This function parses the SVG data in the same way as FromSVG() does,
+        but then starts rasterizing the bitmap of the given @a size in a
+        background thread and returns immediately. This is useful for big
+        images, e.g. backgrounds or splash screens, which may take a
+        noticeable time to rasterize and would block the GUI otherwise.
+
+        Until the bitmap is ready, GetBitmap() called with @a size returns a
+        fully transparent bitmap of this size. When it becomes ready, a
+        wxThreadEvent of type @c wxEVT_THREAD with the given @a id is sent to
+        the @a handler, if it is specified, and GetBitmap() starts returning
+        the real bitmap, so the handler typically just refreshes the window
+        showing it. Note that the handler must not be destroyed before it
+        gets this event.
+
+        The bitmaps of all the other sizes are rasterized synchronously, as
+        usual.
+
+        This function is only available if both @c wxHAS_SVG is defined and
+        @c wxUSE_THREADS is 1.
+
+        @param data NUL-terminated SVG data, see FromSVG().
+        @param sizeDef The default size to return from GetDefaultSize() for
+            this bundle.
+        @param size The size of the bitmap to rasterize in background.
+        @param handler Optional handler to notify when the bitmap is ready.
+        @param id The id of the event sent to the handler.
+
+        @see FromSVGFileAsync()
+
+        @since 3.3.2
+     */
+    static wxBitmapBundle FromSVGAsync(const char* data,
+                                       const wxSize& sizeDef,
+                                       const wxSize& size,
+                                       wxEvtHandler* handler = nullptr,
+                                       int id = wxID_ANY);
+
+    /**
+        Create a bundle from the SVG file and rasterize it in background.
+
+        This is the same as FromSVGAsync(), but loads the SVG data from the
+        given file, see FromSVGFile().
+
+        @since 3.3.2
+     */
+    static wxBitmapBundle FromSVGFileAsync(const wxString& path,
+                                           const wxSize& sizeDef,
+                                           const wxSize& size,
+                                           wxEvtHandler* handler = nullptr,
+                                           int id = wxID_ANY);
+
     /**
         Clear the existing bundle contents.
 
@@ -712,6 +712,90 @@ public:
 
     ///@}
 
+    /**
+        Gets the dimensions of several single-line strings at once.
+
+        This function fills the @a extents array, which must have @a n
+        elements, with the extents of the corresponding elements of @a strings
+        array. The result is the same as calling GetTextExtent() for each of
+        the strings, but more efficient, as the font only needs to be set up
+        for measuring once, and so this function should be preferred when
+        many strings need to be measured, e.g. to compute the layout of a
+        control showing them.
+
+        If the optional parameter @a font is specified and valid, then it is
+        used for measuring all the strings. Otherwise the currently selected
+        font is.
+
+        @since 3.3.2
+    */
+    void GetTextExtents(size_t n,
+                        const wxString* strings,
+                        wxSize* extents,
+                        const wxFont* font = nullptr) const;
+
+    /**
+        Enables the global cache of the text extents.
+
+        Measuring text is relatively expensive and some controls, such as
+        wxGrid or wxDataViewCtrl, may measure the same strings many times,
+        e.g. whenever their layout is recomputed. If this is a bottleneck in
+        your application, the cache of the text extents can be enabled by
+        calling this function with non-zero @a maxEntries. When it is enabled,
+        the extents of the strings measured by GetTextExtent(),
+        GetMultiLineTextExtent() and GetTextExtents() of the DCs using the
+        native API for measuring text, as well as by wxWindow::GetTextExtent(),
+        are kept in the cache and reused when the same string is measured
+        again using the same font, at the same DPI and scale. The same applies
+        to the widths returned by GetPartialTextExtents(), which are cached
+        separately, but limited to the same maximal number of entries.
+
+        When the cache contains @a maxEntries strings, the least recently used
+        ones are discarded from it.
+
+        Note that the cache is global and must only be used from the main
+        thread.
+
+        @param maxEntries The maximal number of strings in the cache, 0
+            disables the cache, which is the default.
+
+        @see ClearTextExtentCache(), GetTextExtentCacheStats()
+
+        @since 3.3.2
+    */
+    static void EnableTextExtentCache(size_t maxEntries = 4096);
+
+    /**
+        Discards all the entries of the text extents cache.
+
+        As the cache key includes the font and the DPI, it's not necessary to
+        call this function when they change, but it may be useful to call it
+        if the system font settings, e.g. anti-aliasing or hinting options,
+        change.
+
+        @see EnableTextExtentCache()
+
+        @since 3.3.2
+    */
+    static void ClearTextExtentCache();
+
+    /**
+        Returns the number of hits and misses of the text extents cache.
+
+        The statistics are accumulated since the program start and can be
+        used to check how useful the cache is.
+
+        @param hits Receives the number of the times the cached extent was
+            used, if non-null.
+        @param misses Receives the number of the times the string had to be
+            measured because it wasn't in the cache, if non-null.
+
+        @see EnableTextExtentCache()
+
+        @since 3.3.2
+    */
+    static void GetTextExtentCacheStats(size_t* hits, size_t* misses);
+
     /**
         Gets the current font.
 
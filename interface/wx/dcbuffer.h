@@ -17,6 +17,10 @@
 // is private style and not returned by GetStyle.
 #define wxBUFFER_USES_SHARED_BUFFER 0x04
 
+// Only for wxBufferedPaintDC: keep a persistent per-window backing store and
+// redraw and copy to the window only the invalidated part of it
+#define wxBUFFER_PERSISTENT         0x08
+
 
 /**
     @class wxBufferedDC
@@ -195,6 +199,21 @@ wxDC* wxAutoBufferedPaintDCFactory(wxWindow* window);
     wxScrolled::PrepareDC() on it as it already does this internally for the
     real underlying wxPaintDC.
 
+    By default, the entire client area of the window is copied to the screen
+    every time the window is repainted, even if only a small part of it was
+    invalidated. If @c wxBUFFER_PERSISTENT is combined with
+    wxBUFFER_CLIENT_AREA in the @a style argument of the constructor, a
+    backing store bitmap is kept for the window between the paint events
+    instead. In this case all drawing is clipped to the update region returned
+    by wxWindow::GetUpdateRegion(), so that only the invalidated part of the
+    window is really redrawn, and only this part is copied to the screen.
+    When the window is scrolled, the contents of the backing store are moved
+    together with the window contents, so that only the newly exposed part of
+    it needs to be redrawn. The backing store is recreated, and the whole
+    window is redrawn, whenever its size changes, and freed when the window
+    is destroyed. This style can't be used with wxBUFFER_VIRTUAL_AREA and is
+    only available in wxWidgets 3.3.2 and later.
+
     @library{wxcore}
     @category{dc}
 
@@ -212,7 +231,10 @@ public:
         Pass wxBUFFER_CLIENT_AREA for the @a style parameter to indicate that
         just the client area of the window is buffered, or
         wxBUFFER_VIRTUAL_AREA to indicate that the buffer bitmap covers the
-        virtual area.
+        virtual area. Additionally, wxBUFFER_PERSISTENT can be combined with
+        wxBUFFER_CLIENT_AREA to use a persistent backing store and repaint
+        only the invalidated part of the window, in which case the @a buffer
+        argument is ignored.
     */
     wxBufferedPaintDC(wxWindow* window, wxBitmap& buffer,
                       int style = wxBUFFER_CLIENT_AREA);
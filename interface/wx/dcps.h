@@ -19,6 +19,17 @@
     However, some functions, like SetFont(), may be legitimately called even
     before StartDoc().
 
+    @section ps_output Generated output
+
+    The output is buffered and written to the file or stream specified in
+    wxPrintData at the end of every page and when the document is finished.
+
+    Bitmaps are embedded in the output using ASCII85 encoding and, if
+    @c wxUSE_ZLIB is enabled, which is the case by default, compressed, which
+    requires a PostScript Level 3 interpreter. Before wxWidgets 3.3.2, bitmaps
+    were embedded uncompressed in hexadecimal format compatible with
+    PostScript Level 1 interpreters.
+
     @library{wxbase}
     @category{dc}
 */
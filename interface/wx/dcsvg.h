@@ -60,6 +60,13 @@ public:
         Initializes a wxSVGFileDC with the given @a filename, @a width and
         @a height at @a dpi resolution, and an optional @a title.
         The title provides a readable name for the SVG document.
+
+        If @a filename has @c .svgz extension, the output is compressed using
+        gzip, as expected for the files with this extension. This requires
+        @c wxUSE_ZLIB to be enabled, which is the case by default.
+
+        Note that the output is buffered and is only guaranteed to be fully
+        written to the file when this object is destroyed.
     */
     wxSVGFileDC(const wxString& filename, int width = 320, int height = 240,
                 double dpi = 72, const wxString& title = wxString());
@@ -102,6 +109,25 @@ public:
     */
     void SetShapeRenderingMode(wxSVGShapeRenderingMode renderingMode);
 
+    /**
+        Draw consecutive lines with the same attributes as a single path.
+
+        By default, every call to DrawLine() creates a separate SVG @c path
+        element. When drawing many lines, e.g. a grid or a plot made of line
+        segments, this results in big files that are slow to load. When this
+        option is enabled, consecutive DrawLine() calls using the same pen are
+        combined into a single path element instead, which is terminated by
+        any other drawing operation or change of the pen.
+
+        Notice that combining the lines into a single path changes how the
+        overlapping semi-transparent lines are drawn: their intersections are
+        only drawn once instead of being drawn darker, as they're drawn by
+        default.
+
+        @since 3.3.2
+    */
+    void EnableLineCoalescing(bool enable = true);
+
     /**
         Destroys the current clipping region so that none of the DC is clipped.
         Since intersections arising from sequential calls to SetClippingRegion are represented
@@ -28,6 +28,39 @@ public:
     virtual long GetDelay(unsigned int frame) const;
     virtual wxColour GetTransparentColour(unsigned int frame) const;
 
+    /**
+        Enable lazy decoding of the frames.
+
+        By default, all frames are decoded when the animation is loaded, which
+        may use a lot of memory for long animations. If @a maxCachedFrames is
+        non-zero, only the compressed data is kept in memory when loading it
+        and the frames are decoded on demand, with at most the given number of
+        the most recently used decoded frames being kept.
+
+        This function must be called before loading the animation.
+
+        Notice that when using lazy decoding, errors in the frame data may be
+        only detected when the frame is decoded, in which case
+        ConvertToImage() returns @false for it. And the frame data pointer
+        returned by GetData() is only valid until it is called for a different
+        frame, as the data of the previously accessed frames may be discarded.
+
+        @since 3.3.2
+    */
+    void SetLazyDecoding(unsigned int maxCachedFrames);
+
+    /**
+        Set the lazy decoding parameter used by all the new decoders.
+
+        This affects the decoders created by wxAnimation and wxGIFHandler too.
+        The default value is 0, i.e. lazy decoding is not used.
+
+        @see SetLazyDecoding()
+
+        @since 3.3.2
+    */
+    static void SetDefaultLazyDecoding(unsigned int maxCachedFrames);
+
 protected:
     virtual bool DoCanRead(wxInputStream& stream) const;
 };
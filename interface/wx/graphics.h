@@ -900,6 +900,21 @@ public:
     */
     void DrawBitmap(const wxGraphicsBitmap& bmp, const wxRect2DDouble& rect);
 
+    /**
+        Draws the same bitmap several times using different transformations.
+
+        This is equivalent to calling DrawBitmap() with the given @a rect
+        for each of the @a n elements of @a transforms after temporarily
+        concatenating it with the current transformation matrix, but can be
+        more efficient, e.g. the Cairo implementation doesn't need to save and
+        restore the context state for each bitmap.
+
+        @since 3.3.2
+    */
+    virtual void DrawBitmaps(const wxGraphicsBitmap& bmp,
+                             const wxRect2DDouble& rect,
+                             size_t n, const wxGraphicsMatrix* transforms);
+
     /**
         Draws an ellipse.
     */
@@ -912,6 +927,17 @@ public:
     */
     void DrawEllipse(const wxRect2DDouble& rect);
 
+    /**
+        Draws several ellipses at once.
+
+        Each ellipse fits the corresponding rectangle in the @a rects array
+        of size @a n. All of them are drawn as a single path, see
+        DrawRectangles() for the consequences of this.
+
+        @since 3.3.2
+    */
+    virtual void DrawEllipses(size_t n, const wxRect2DDouble* rects);
+
     /**
         Draws the icon.
     */
@@ -937,6 +963,28 @@ public:
     virtual void DrawPath(const wxGraphicsPath& path,
                           wxPolygonFillMode fillStyle = wxODDEVEN_RULE);
 
+    /**
+        Draws several copies of the same path translated by the given offsets.
+
+        This function is equivalent to creating a single path containing all
+        the copies of the given @a path translated by each of the @a n
+        elements of @a offsets and calling DrawPath() with it, but can be much
+        faster, e.g. it only needs to set up the pen and brush once under all
+        platforms and doesn't need to copy the path data when using Cairo.
+        This makes it useful for drawing many identical markers on a plot.
+
+        Notice that, as all the copies are parts of a single path, all of them
+        are filled before any of them is stroked and the areas where they
+        overlap are only painted once, which is why the default fill mode is
+        different from DrawPath(): with wxODDEVEN_RULE, the overlapping parts
+        of the copies would be left unfilled.
+
+        @since 3.3.2
+    */
+    virtual void DrawPathInstances(const wxGraphicsPath& path,
+                                   size_t n, const wxPoint2DDouble* offsets,
+                                   wxPolygonFillMode fillStyle = wxWINDING_RULE);
+
     /**
         Draws a rectangle.
     */
@@ -949,6 +997,20 @@ public:
     */
     void DrawRectangle(const wxRect2DDouble& rect);
 
+    /**
+        Draws several rectangles at once.
+
+        This is faster than calling DrawRectangle() for each of them, as the
+        pen and brush only need to be applied once, but note that all the
+        rectangles are drawn as a single path: all of them are filled before
+        any of them is stroked and the areas where they overlap are painted
+        only once. The result is the same as calling DrawRectangle() for each
+        of them if they don't overlap, e.g. for the bars of a histogram.
+
+        @since 3.3.2
+    */
+    virtual void DrawRectangles(size_t n, const wxRect2DDouble* rects);
+
     /**
         Draws a rounded rectangle.
     */
@@ -1021,6 +1083,19 @@ public:
     void DrawText(const wxString& str, wxDouble x, wxDouble y,
                   wxDouble angle, const wxGraphicsBrush& backgroundBrush);
 
+    /**
+        Draws several strings at once.
+
+        This is equivalent to calling DrawText() for each of the @a n
+        elements of the @a strings array with the corresponding element of
+        @a positions, but more efficient, e.g. the Cairo implementation
+        applies the font only once.
+
+        @since 3.3.2
+    */
+    void DrawTexts(size_t n, const wxString* strings,
+                   const wxPoint2DDouble* positions);
+
     /**
         Paints a transparent rectangle (only useful for bitmaps or windows).
     */
@@ -0,0 +1,212 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        imagbatch.h
+// Purpose:     interface of wxImageBatchLoader and wxImageBatchEvent
+// Author:      wxWidgets team
+// Created:     2026-10-17
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+    @class wxImageBatchLoader
+
+    Loads many images in the background using several worker threads.
+
+    This class is useful when a lot of images, e.g. thumbnails, need to be
+    loaded at once: instead of calling wxImage::LoadFile() for all of them
+    sequentially in the main thread, add them to the batch using AddFile() or
+    AddStream() and call Start() to decode them in parallel using the usual
+    image handlers.
+
+    If an event handler is specified when creating the loader, every image is
+    sent to it as soon as it is loaded as wxEVT_IMAGE_BATCH_LOADED event
+    and wxEVT_IMAGE_BATCH_DONE event is sent when there are no more images to
+    load. These events are queued, i.e. they are processed in the main thread
+    as usual, so it is safe to use the GUI from their handlers. Example:
+
+    @code
+    MyFrame::MyFrame()
+        : m_loader(this)
+    {
+        Bind(wxEVT_IMAGE_BATCH_LOADED, [this](wxImageBatchEvent& event) {
+            if ( event.GetImage().IsOk() )
+                m_thumbnails->Add(event.GetImage());
+            else
+                wxLogWarning("Failed to load \"%s\".", event.GetFileName());
+        });
+
+        m_loader.SetOption(wxIMAGE_OPTION_MAX_WIDTH, 128);
+        for ( const auto& file : files )
+            m_loader.AddFile(file);
+        m_loader.Start();
+    }
+    @endcode
+
+    Otherwise, i.e. if no event handler is specified, the loaded images are
+    stored by the loader itself and can be retrieved using GetImage() after
+    Wait() returns.
+
+    Note that the image handlers must not be added or removed while the
+    loader is running.
+
+    @beginEventEmissionTable{wxImageBatchEvent}
+    @event{EVT_IMAGE_BATCH_LOADED(func)}
+        An image was loaded, or failed to load.
+    @event{EVT_IMAGE_BATCH_DONE(func)}
+        All images were loaded, or loading was cancelled.
+    @endEventTable
+
+    @library{wxcore}
+    @category{gdi}
+
+    @see wxImage, wxImageBatchEvent
+
+    @since 3.3.2
+*/
+class wxImageBatchLoader
+{
+public:
+    /**
+        Create the loader sending the images to the given handler.
+
+        @param handler The handler to send the events to or @NULL to keep the
+            loaded images in this object.
+        @param maxThreads Maximal number of threads to use, with 0 meaning to
+            use as many threads as there are CPUs.
+    */
+    explicit wxImageBatchLoader(wxEvtHandler* handler = nullptr,
+                                unsigned int maxThreads = 0);
+
+    /**
+        Destructor cancels loading and waits until the threads terminate.
+    */
+    ~wxImageBatchLoader();
+
+    /**
+        Add a file to load.
+
+        This function can't be called while the loader is running.
+
+        @return The index of the image in this batch.
+    */
+    size_t AddFile(const wxString& filename,
+                   wxBitmapType type = wxBITMAP_TYPE_ANY);
+
+    /**
+        Add a stream to load the image from.
+
+        The loader takes ownership of the stream and deletes it after loading
+        the image. If @a type is wxBITMAP_TYPE_ANY, the stream must be
+        seekable.
+
+        This function can't be called while the loader is running.
+
+        @return The index of the image in this batch.
+    */
+    size_t AddStream(wxInputStream* stream,
+                     wxBitmapType type = wxBITMAP_TYPE_ANY);
+
+    /**
+        Return the total number of images added to this batch.
+    */
+    size_t GetCount() const;
+
+    /**
+        Set the option used when loading all the images.
+
+        See wxImage::SetOption() for the possible options, e.g.
+        @c wxIMAGE_OPTION_MAX_WIDTH and @c wxIMAGE_OPTION_MAX_HEIGHT are
+        especially useful for loading thumbnails.
+    */
+    void SetOption(const wxString& name, const wxString& value);
+
+    /// @overload
+    void SetOption(const wxString& name, int value);
+
+    /**
+        Start loading the images in the background.
+
+        This function returns immediately. It can be called again after
+        loading finishes to load the images added since the previous call.
+
+        @return @false if no worker threads could be launched.
+    */
+    bool Start();
+
+    /**
+        Stop loading the images.
+
+        The images which are being loaded when this function is called are
+        still loaded, but no new ones are.
+    */
+    void Cancel();
+
+    /**
+        Wait until all the images are loaded or loading is cancelled.
+    */
+    void Wait();
+
+    /**
+        Return @true if the images are still being loaded.
+    */
+    bool IsRunning() const;
+
+    /**
+        Return the image with the given index.
+
+        This can only be used for the loaders created without an event
+        handler and only after Wait() returns.
+
+        The returned image is invalid if it couldn't be loaded or if loading
+        was cancelled before loading it.
+    */
+    const wxImage& GetImage(size_t n) const;
+};
+
+/**
+    @class wxImageBatchEvent
+
+    Event sent by wxImageBatchLoader.
+
+    @library{wxcore}
+    @category{events}
+
+    @see wxImageBatchLoader
+
+    @since 3.3.2
+*/
+class wxImageBatchEvent : public wxEvent
+{
+public:
+    /**
+        Return the index of the image in the batch.
+
+        This is the value returned by wxImageBatchLoader::AddFile() or
+        AddStream().
+    */
+    size_t GetIndex() const;
+
+    /**
+        Return the name of the file the image was loaded from.
+
+        This is empty for the images loaded from streams.
+    */
+    const wxString& GetFileName() const;
+
+    /**
+        Return the loaded image.
+
+        The image is invalid if loading it failed.
+    */
+    const wxImage& GetImage() const;
+
+    /**
+        Return @true if loading was cancelled.
+
+        Only used with wxEVT_IMAGE_BATCH_DONE events.
+    */
+    bool IsCancelled() const;
+};
+
+wxEventType wxEVT_IMAGE_BATCH_LOADED;
+wxEventType wxEVT_IMAGE_BATCH_DONE;
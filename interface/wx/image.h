@@ -22,6 +22,25 @@ enum wxImageResolution
     wxIMAGE_RESOLUTION_CM = 2
 };
 
+/**
+    Kind of blur applied by wxImage::Blur().
+
+    @since 3.3.2
+ */
+enum wxImageBlurMode
+{
+    /// Each pixel becomes the average of the pixels in the square around it.
+    wxIMAGE_BLUR_BOX,
+
+    /**
+        Approximation of the Gaussian blur.
+
+        This uses several successive box blurs and so is slower than
+        wxIMAGE_BLUR_BOX, but gives much smoother results.
+     */
+    wxIMAGE_BLUR_GAUSSIAN
+};
+
 /**
     Image resize algorithm.
 
@@ -86,7 +105,27 @@ enum wxImageResizeQuality
     This algorithm is the slowest, but may produce better results, especially
     for photogenic images.
     */
-    wxIMAGE_QUALITY_HIGH
+    wxIMAGE_QUALITY_HIGH,
+
+    /**
+        Lanczos filter with 3 lobes.
+
+        This filter produces sharp results both when enlarging and reducing
+        the image, but may introduce some ringing artefacts near sharp edges.
+
+        @since 3.3.2
+     */
+    wxIMAGE_QUALITY_LANCZOS3,
+
+    /**
+        Mitchell-Netravali cubic filter.
+
+        This filter is a good compromise between sharpness and absence of
+        artefacts, both when enlarging and reducing the image.
+
+        @since 3.3.2
+     */
+    wxIMAGE_QUALITY_MITCHELL
 };
 
 
@@ -243,6 +282,22 @@ public:
     */
     bool CanRead( const wxString& filename );
 
+    /**
+        Creates a decoder for loading images in this format incrementally.
+
+        The default implementation returns @NULL, meaning that incremental
+        decoding is not supported. Currently only wxPNGHandler and
+        wxJPEGHandler override it.
+
+        @return
+            New decoder object which must be deleted by the caller, or @NULL.
+
+        @see wxImageIncrementalDecoder::Create()
+
+        @since 3.3.2
+    */
+    virtual wxImageIncrementalDecoder* CreateIncrementalDecoder() const;
+
     /**
         Gets the preferred file extension associated with this handler.
 
@@ -829,9 +884,19 @@ public:
         specified pixel @a blurRadius. This should not be used when using
         a single mask colour for transparency.
 
+        The time taken by this function doesn't depend on @a blurRadius, so
+        it can be used with large values, e.g. for drop shadows.
+
+        @param blurRadius
+            The radius of the blur. For wxIMAGE_BLUR_GAUSSIAN, the standard
+            deviation of the Gaussian is half of this value.
+        @param mode
+            The kind of blur to apply. This parameter is new since
+            wxWidgets 3.3.2, the default box blur was always used before.
+
         @see BlurHorizontal(), BlurVertical()
     */
-    wxImage Blur(int blurRadius) const;
+    wxImage Blur(int blurRadius, wxImageBlurMode mode = wxIMAGE_BLUR_BOX) const;
 
     /**
         Blurs the image in the horizontal direction only. This should not be used
@@ -979,6 +1044,12 @@ public:
         [-1.0..+1.0], where -1.0 corresponds to -100 percent and +1.0 corresponds
         to +100 percent.
 
+        Calling this function is more efficient than calling RotateHue(),
+        ChangeSaturation() and ChangeBrightness() one after another, as all
+        the changes are applied in a single pass over the image. Since wx
+        3.3.2, the results of doing it may also slightly differ, as the image
+        colours are not rounded after each of the changes.
+
         @since 3.1.6
     */
     void ChangeHSV(double angleH, double factorS, double factorV);
@@ -1037,6 +1108,43 @@ public:
     wxImage Scale(const wxSize& size,
                   wxImageResizeQuality quality = wxIMAGE_QUALITY_NORMAL) const;
 
+    /**
+        Sets the maximal number of threads used for processing images.
+
+        By default, all image processing functions run in the calling thread
+        only. Calling this function with @a count greater than 1 allows
+        Scale(), Rescale(), Blur(), BlurHorizontal() and BlurVertical(), as
+        well as rasterizing SVG images by wxBitmapBundle::FromSVG(), to
+        split the image into bands of rows and process them concurrently,
+        using up to the given number of threads, including the current one.
+        Passing 0 means to use as many threads as there are CPUs in the
+        system.
+
+        The results of these functions don't depend on the number of threads
+        used, i.e. they are exactly the same as when using a single thread,
+        with the exception of SVG rasterization, where the colours of the
+        anti-aliased pixels may differ by 1 due to rounding. Note that small
+        images are always processed in the current thread, as the overhead of
+        using threads would outweigh any gains for them.
+
+        This setting is global and should be changed from the main thread
+        only, typically during the application initialization.
+
+        @see GetMaxThreads()
+
+        @since 3.3.2
+    */
+    static void SetMaxThreads(unsigned int count);
+
+    /**
+        Returns the maximal number of threads used for processing images.
+
+        The default value is 1, see SetMaxThreads() for more details.
+
+        @since 3.3.2
+    */
+    static unsigned int GetMaxThreads();
+
     /**
         Returns a resized version of this image without scaling it by adding either a
         border with the given colour or cropping as necessary.
@@ -1357,12 +1465,15 @@ public:
             max width given if it is not 0 @em and its height is less than the
             max height given if it is not 0. This is typically used for loading
             thumbnails and the advantage of using these options compared to
-            calling Rescale() after loading is that some handlers (only JPEG
-            one right now) support rescaling the image during loading which is
-            vastly more efficient than loading the entire huge image and
-            rescaling it later (if these options are not supported by the
-            handler, this is still what happens however). These options must be
-            set before calling LoadFile() to have any effect.
+            calling Rescale() after loading is that some handlers support
+            rescaling the image during loading which is vastly more efficient
+            than loading the entire huge image and rescaling it later (if these
+            options are not supported by the handler, this is still what
+            happens however). Currently this is the case for JPEG and WebP
+            handlers and for the PNG one when loading interlaced images, which
+            are reduced by only decoding their first interlacing passes (since
+            wxWidgets 3.3.2). These options must be set before calling
+            LoadFile() to have any effect.
 
         @li @c wxIMAGE_OPTION_ORIGINAL_WIDTH and @c wxIMAGE_OPTION_ORIGINAL_HEIGHT:
             These options will return the original size of the image if either
@@ -2207,6 +2318,393 @@ public:
                                unsigned char startB = 0 ) const;
 };
 
+/**
+    Layout of the pixels in the buffer used by wxImagePixelView.
+
+    @since 3.3.2
+ */
+enum wxImagePixelLayout
+{
+    /// 3 bytes per pixel, in red, green, blue order, as used by wxImage.
+    wxIMAGE_PIXEL_RGB,
+
+    /// 3 bytes per pixel, in blue, green, red order.
+    wxIMAGE_PIXEL_BGR,
+
+    /// 4 bytes per pixel, in red, green, blue, alpha order.
+    wxIMAGE_PIXEL_RGBA,
+
+    /// 4 bytes per pixel, in blue, green, red, alpha order.
+    wxIMAGE_PIXEL_BGRA
+};
+
+/**
+    @class wxImagePixelView
+
+    Non-owning view of the pixels stored in an external buffer.
+
+    Unlike wxImage, which always stores its pixels as tightly packed RGB
+    triplets with an optional separate alpha channel, this class can be used
+    with buffers containing rows with padding at their end and using any of
+    wxImagePixelLayout layouts, as produced by many decoders and video capture
+    APIs, without copying them.
+
+    The view doesn't manage the lifetime of the buffer, which must remain
+    valid for as long as the view is used. Copying the view is cheap and
+    results in another view of the same pixels.
+
+    Note that none of the accessor functions check their arguments for
+    performance reasons, so they must be valid.
+
+    @library{wxcore}
+    @category{gdi}
+
+    @see wxImage
+
+    @since 3.3.2
+*/
+class wxImagePixelView
+{
+public:
+    /**
+        Default constructor creates an invalid view.
+     */
+    wxImagePixelView();
+
+    /**
+        Creates a view of the given buffer.
+
+        @param data
+            Pointer to the first pixel of the first row, must be non-null.
+        @param width
+            Width of the view in pixels, must be positive.
+        @param height
+            Height of the view in pixels, must be positive.
+        @param layout
+            Layout of the pixels in the buffer.
+        @param stride
+            Offset between the starts of the consecutive rows in bytes. If 0,
+            the rows are assumed to be tightly packed, i.e. stride is taken to
+            be @a width multiplied by the number of bytes per pixel.
+     */
+    wxImagePixelView(unsigned char* data,
+                     int width,
+                     int height,
+                     wxImagePixelLayout layout = wxIMAGE_PIXEL_RGB,
+                     int stride = 0);
+
+    /**
+        Creates a view of the RGB data of the given image.
+
+        The image data is not copied, but the image is unshared first if
+        necessary, so that modifying the pixels through the view doesn't
+        affect any other images. Note that the alpha channel of the image,
+        if any, is not accessible through the view.
+     */
+    explicit wxImagePixelView(wxImage& image);
+
+    /// Returns true if the view was successfully created.
+    bool IsOk() const;
+
+    /// Returns the pointer to the first pixel of the view.
+    unsigned char* GetData() const;
+
+    /// Returns the width of the view.
+    int GetWidth() const;
+
+    /// Returns the height of the view.
+    int GetHeight() const;
+
+    /// Returns the offset between the rows in bytes.
+    int GetStride() const;
+
+    /// Returns the layout of the pixels.
+    wxImagePixelLayout GetLayout() const;
+
+    /// Returns true if the layout includes an alpha component.
+    bool HasAlpha() const;
+
+    /// Returns 4 for the layouts with alpha and 3 otherwise.
+    int GetBytesPerPixel() const;
+
+    /// Returns the pointer to the first pixel of the given row.
+    unsigned char* GetRowData(int y) const;
+
+    /// Returns the pointer to the given pixel.
+    unsigned char* GetPixelData(int x, int y) const;
+
+    /// Returns the red component of the given pixel.
+    unsigned char GetRed(int x, int y) const;
+
+    /// Returns the green component of the given pixel.
+    unsigned char GetGreen(int x, int y) const;
+
+    /// Returns the blue component of the given pixel.
+    unsigned char GetBlue(int x, int y) const;
+
+    /**
+        Returns the alpha component of the given pixel.
+
+        Returns ::wxIMAGE_ALPHA_OPAQUE if the view has no alpha.
+     */
+    unsigned char GetAlpha(int x, int y) const;
+
+    /// Sets the colour of the given pixel.
+    void SetRGB(int x, int y, unsigned char r, unsigned char g, unsigned char b);
+
+    /**
+        Sets the alpha of the given pixel.
+
+        This function can only be called if HasAlpha() returns true.
+     */
+    void SetAlpha(int x, int y, unsigned char alpha);
+
+    /**
+        Returns a view of the given part of this view.
+
+        The returned view uses the same buffer and the same stride as this
+        one, i.e. no pixels are copied. The rectangle must be non-empty and
+        lie entirely inside this view.
+     */
+    wxImagePixelView GetSubView(const wxRect& rect) const;
+
+    /**
+        Creates a new image with a copy of the pixels of this view.
+
+        The returned image has alpha if the layout of the view has it.
+     */
+    wxImage ToImage() const;
+
+    /**
+        Copies the pixels of the given image into the view.
+
+        The image must have the same size as the view. If the view has alpha
+        but the image doesn't, alpha of all view pixels is set to
+        ::wxIMAGE_ALPHA_OPAQUE, while if the image has alpha but the view
+        doesn't, it is ignored.
+     */
+    bool CopyFrom(const wxImage& image);
+
+    /**
+        Mirrors the pixels of the view in place.
+
+        Unlike wxImage::Mirror(), this doesn't allocate a new buffer.
+     */
+    void Mirror(bool horizontally = true);
+
+    /**
+        Rotates the pixels of this view by 90 degrees into another one.
+
+        The destination view must have the same layout as this one, its
+        width must be equal to the height of this view and vice versa, and
+        it must not overlap this view. It may use a different stride.
+
+        Returns false if the destination view is not appropriate.
+     */
+    bool Rotate90(const wxImagePixelView& dst, bool clockwise = true) const;
+};
+
+/**
+    @class wxImageDecodeListener
+
+    Interface for the objects notified about the progress of
+    wxImageIncrementalDecoder.
+
+    Both functions of this class are called from wxImageIncrementalDecoder::Feed()
+    or wxImageIncrementalDecoder::Finish() after the decoder has processed
+    the data passed to it and may cancel decoding by returning @false.
+
+    @library{wxcore}
+    @category{gdi}
+
+    @since 3.3.2
+*/
+class wxImageDecodeListener
+{
+public:
+    /// Trivial but virtual destructor.
+    virtual ~wxImageDecodeListener();
+
+    /**
+        Called once the size of the image is known.
+
+        At this moment, the image has been allocated but its contents is
+        undefined, unless this is an interlaced or progressive image, in which
+        case it is cleared to transparent black.
+
+        The default implementation just returns @true.
+    */
+    virtual bool OnImageStarted(const wxImage& image);
+
+    /**
+        Called when some rows of the image have been decoded.
+
+        This function is called at most once for each call to
+        wxImageIncrementalDecoder::Feed().
+
+        @param image
+            The image being decoded.
+        @param firstRow
+            The first row which was decoded.
+        @param numRows
+            The number of rows decoded, always positive.
+        @param pass
+            The index, starting from 0, of the last pass during which the rows
+            were decoded. Images using interlacing (PNG) or progressive
+            encoding (JPEG) are decoded in several passes, each of which
+            updates the entire image with more details. Other images are
+            always decoded in a single pass.
+    */
+    virtual bool OnRowsDecoded(const wxImage& image,
+                               int firstRow,
+                               int numRows,
+                               int pass) = 0;
+};
+
+/**
+    @class wxImageIncrementalDecoder
+
+    Decodes an image as its data becomes available.
+
+    Unlike wxImage::LoadFile(), which returns only after reading and decoding
+    the entire image, this class can be fed the data in arbitrary chunks, e.g.
+    as they are received from the network, and allows showing the part of the
+    image decoded so far. It can also be used to stop decoding early.
+
+    Example of using this class:
+    @code
+    class MyListener : public wxImageDecodeListener
+    {
+    public:
+        virtual bool OnRowsDecoded(const wxImage& image,
+                                   int firstRow, int numRows,
+                                   int pass) override
+        {
+            // Update the display using the newly decoded rows...
+
+            return !m_cancelled;
+        }
+    };
+
+    std::unique_ptr<wxImageIncrementalDecoder>
+        decoder(wxImageIncrementalDecoder::Create(wxBITMAP_TYPE_PNG));
+
+    MyListener listener;
+    decoder->SetListener(&listener);
+
+    while ( ...more data is available... )
+    {
+        if ( !decoder->Feed(data, len) )
+            break;
+    }
+
+    if ( decoder->Finish() )
+        ... use decoder->GetImage() ...
+    @endcode
+
+    Currently incremental decoding is only supported for PNG and JPEG images.
+
+    @library{wxcore}
+    @category{gdi}
+
+    @see wxImageDecodeListener
+
+    @since 3.3.2
+*/
+class wxImageIncrementalDecoder
+{
+public:
+    /// Possible states of the decoder.
+    enum State
+    {
+        State_Header,       ///< Waiting for the image header.
+        State_Decoding,     ///< Image allocated, decoding its data.
+        State_Done,         ///< The image has been fully decoded.
+        State_Failed,       ///< Decoding failed due to an error.
+        State_Cancelled     ///< Listener requested to stop decoding.
+    };
+
+    /**
+        Creates the decoder for the given format.
+
+        The handler for this format must have been added with
+        wxImage::AddHandler().
+
+        @return
+            New decoder object which must be deleted by the caller, or @NULL
+            if there is no handler for this format or it doesn't support
+            incremental decoding.
+    */
+    static wxImageIncrementalDecoder* Create(wxBitmapType type);
+
+    /// Destructor frees all resources used by the decoder.
+    virtual ~wxImageIncrementalDecoder();
+
+    /**
+        Sets the object to notify about the progress of decoding.
+
+        The listener is not owned by the decoder and must remain valid while
+        it is used. It can be @NULL to stop notifying the previous listener.
+    */
+    void SetListener(wxImageDecodeListener* listener);
+
+    /**
+        Sets whether errors should be logged.
+
+        By default errors are logged using wxLogError().
+    */
+    void SetVerbose(bool verbose);
+
+    /**
+        Decodes the next chunk of the image data.
+
+        The data is copied by the decoder if necessary, so it doesn't need to
+        remain valid after this function returns.
+
+        @return
+            @false if an error occurred or the listener cancelled decoding,
+            in which case calling this function again is useless. Notice that
+            @true is returned after the image is fully decoded and any extra
+            data is ignored.
+    */
+    bool Feed(const void* data, size_t len);
+
+    /**
+        Indicates that there is no more data.
+
+        For the JPEG images, this allows decoding truncated data, with the
+        missing part of the image filled with grey, as wxImage::LoadFile()
+        does.
+
+        @return
+            @true if the image was fully decoded.
+    */
+    bool Finish();
+
+    /**
+        Feeds all the data from the stream to the decoder and calls Finish().
+
+        This function is mostly useful for testing, as it is equivalent to
+        wxImage::LoadFile() if no listener is used.
+    */
+    bool Load(wxInputStream& stream);
+
+    /// Returns the current state of the decoder.
+    State GetState() const;
+
+    /// Returns @true if the image was fully decoded.
+    bool IsDone() const;
+
+    /**
+        Returns the image being decoded.
+
+        The image is invalid until the image header is decoded and contains
+        only the rows which have been already decoded until IsDone() returns
+        @true.
+    */
+    const wxImage& GetImage() const;
+};
+
 /**
     An instance of an empty image without an alpha channel.
 */
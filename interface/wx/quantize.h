@@ -42,6 +42,14 @@ public:
 
         Specify an optional palette pointer to receive the resulting palette.
         This palette may be passed to ConvertImageToBitmap, for example.
+
+        @a flags is a combination of @c wxQUANTIZE_INCLUDE_WINDOWS_COLOURS,
+        @c wxQUANTIZE_RETURN_8BIT_DATA, @c wxQUANTIZE_FILL_DESTINATION_IMAGE
+        and @c wxQUANTIZE_OCTREE. The last one selects the octree quantizer
+        instead of the default median cut one: it is faster, can use several
+        threads (see wxImage::SetMaxThreads()) and doesn't use dithering,
+        mapping each pixel to the nearest palette colour instead. This flag
+        is available since wxWidgets 3.3.2.
     */
     static bool Quantize(const wxImage& src, wxImage& dest,
                          wxPalette** pPalette, int desiredNoColours = 236,
@@ -0,0 +1,63 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        staticformat.h
+// Purpose:     interface of wxSTATIC_FORMAT
+// Author:      wxWidgets team
+// Created:     2026-10-17
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+/** @addtogroup group_funcmacro_string */
+///@{
+
+/**
+    Create a format string parsed and checked at compile-time.
+
+    The argument of this macro must be a narrow or wide string literal
+    containing a printf()-like format string. The result of this macro can be
+    passed to wxString::Format() and the wxLogXXX() functions, such as
+    wxLogMessage() or wxLogError(), instead of the format string, e.g.
+
+    @code
+    wxString s = wxString::Format(wxSTATIC_FORMAT("%d of %d files copied"),
+                                  copied, total);
+
+    wxLogWarning(wxSTATIC_FORMAT("Couldn't open \"%s\"."), filename);
+    @endcode
+
+    Compared to using the normal format string, this has two advantages:
+
+    - The format string is checked at compile-time and any errors, such as
+      passing a wrong number of arguments or an argument of a type which
+      can't be used with the corresponding format specification, e.g. a
+      string for @c %d, result in compilation errors.
+    - Formatting is faster, as the format string doesn't need to be parsed
+      at run-time and the arguments are formatted directly by wxWidgets
+      without using the system @c vsnprintf().
+
+    The format string can use all the usual format specifications, including
+    the positional ones, such as @c %1$s, with the following exceptions:
+
+    - Specifying the width or precision using @c * is not supported.
+    - @c %n is not supported.
+    - The size modifiers, e.g. @c l in @c %ld, are accepted but ignored, as
+      the actual type of the argument is always used, except for @c h and
+      @c hh, which convert the value to @c short or @c char, as usual.
+    - @c %p outputs non-null pointers as @c 0x followed by the hexadecimal
+      digits, while null pointers are formatted by the system @c printf().
+
+    Note that the format string itself can't be translated, as it's not
+    known at run-time, so this macro should be mostly used for the messages
+    not shown to the user, such as debug or trace messages, or the strings
+    which don't need to be translated, such as numbers formatting.
+
+    This macro is only available when using C++17 or later, which can be
+    checked by testing whether @c wxHAS_STATIC_FORMAT is defined.
+
+    @header{wx/string.h}
+
+    @since 3.3.2
+*/
+#define wxSTATIC_FORMAT(fmt)
+
+///@}
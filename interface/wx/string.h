@@ -1940,6 +1940,21 @@ public:
     */
     static wxString Format(const wxString& format, ...);
 
+    /**
+        Format the string using a format string checked at compile-time.
+
+        This overload is used when the format string is created using
+        wxSTATIC_FORMAT() macro. It produces the same result as the overload
+        taking a normal format string, but is faster and checks that the
+        arguments match the format string at compile-time.
+
+        It is only available when using C++17 or later.
+
+        @since 3.3.2
+    */
+    template <typename F, typename... Targs>
+    static wxString Format(const F& format, const Targs&... args);
+
     /**
         This static function returns the string containing the result of calling
         PrintfV() with the passed parameters on it.
@@ -2006,6 +2021,29 @@ public:
      */
     static wxString FromCDouble(double val, int precision = -1);
 
+    /**
+        Returns the shortest string allowing to recover the exact number.
+
+        This function returns the string representation of the number in the
+        "C" locale containing the minimal number of significant digits such
+        that calling ToCDouble() on it returns exactly @a val. Fixed notation
+        is used if it results in a string not longer than the one using the
+        scientific notation, e.g. @c "0.1", @c "123.456" or @c "1e+22" are
+        returned for the corresponding numbers.
+
+        Unlike FromCDouble() with the default precision, which only preserves
+        6 significant digits, this function doesn't lose any information and
+        so is appropriate for saving numbers in text files, e.g. CSV ones.
+
+        @param val
+            The value to format.
+
+        @since 3.3.2
+
+        @see FromCDouble(), ToCDouble()
+     */
+    static wxString FromCDoubleShortest(double val);
+
     /**
         Returns a string with the textual representation of the number.
 
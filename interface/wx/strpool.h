@@ -0,0 +1,220 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        strpool.h
+// Purpose:     interface of wxStringPool and wxPooledString
+// Author:      wxWidgets team
+// Created:     2026-10-17
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+/**
+    @class wxPooledString
+
+    Non-owning view of a string stored in wxStringPool.
+
+    Objects of this class are small and cheap to copy, but they are only
+    valid as long as the pool containing the string is not emptied, cleared or
+    destroyed.
+
+    They can be implicitly converted to wxString, which creates a copy of the
+    string, so they can be passed to any function taking a wxString.
+
+    @library{wxbase}
+    @category{data}
+
+    @see wxStringPool
+
+    @since 3.3.2
+*/
+class wxPooledString
+{
+public:
+    /**
+        Default constructor creates a view of an empty string.
+    */
+    wxPooledString();
+
+    /**
+        Return the pointer to the NUL-terminated string data.
+
+        The data uses the same representation as wxString::wx_str(), i.e.
+        it's a wide string in the default build.
+    */
+    const wxStringCharType* data() const;
+
+    /// Same as data().
+    const wxStringCharType* c_str() const;
+
+    /**
+        Return the length of the string data.
+
+        The length is in units of wxStringCharType, so it is the same as the
+        length of the corresponding wxString in the default build, but not
+        in the UTF-8 one.
+    */
+    size_t length() const;
+
+    /// Return @true if the string is empty.
+    bool empty() const;
+
+    /// Return a new wxString with the same contents.
+    wxString ToString() const;
+
+    /// Same as ToString().
+    operator wxString() const;
+
+    ///@{
+    /**
+        Compare the string contents with another string.
+    */
+    bool operator==(const wxPooledString& other) const;
+    bool operator!=(const wxPooledString& other) const;
+    bool operator==(const wxString& s) const;
+    bool operator!=(const wxString& s) const;
+    ///@}
+};
+
+/**
+    @class wxStringPool
+
+    Compact storage for a big number of strings.
+
+    This class can be used instead of wxArrayString or @c std::vector<wxString>
+    for storing many, e.g. millions of, short strings, such as the labels of
+    the items of a big list or tree control. Instead of allocating memory
+    separately for each of the strings, which takes a lot of time and has a
+    significant per-string memory overhead, it copies all of them into big
+    memory chunks and only keeps lightweight wxPooledString views pointing
+    to them.
+
+    The strings can only be added to the pool and not modified or removed
+    individually, but all of them can be removed at once using Empty(), which
+    keeps the allocated memory for reuse, or Clear(), which frees it.
+
+    Example:
+    @code
+    wxStringPool pool;
+    pool.Reserve(items.size(), totalLength);
+    for ( const auto& item : items )
+        pool.Add(item.GetLabel());
+
+    ...
+
+    // Use the strings, e.g. in wxDataViewVirtualListModel::GetValueByRow().
+    variant = pool[row].ToString();
+    @endcode
+
+    @library{wxbase}
+    @category{containers}
+
+    @see wxPooledString, wxArrayString
+
+    @since 3.3.2
+*/
+class wxStringPool
+{
+public:
+    /**
+        Iterator type returned by begin() and end().
+
+        Dereferencing it yields a const reference to wxPooledString.
+    */
+    typedef std::vector<wxPooledString>::const_iterator const_iterator;
+
+    /**
+        Create an empty pool.
+
+        @param chunkSize The minimal size of the memory chunks allocated by
+            the pool, in characters. Strings longer than a quarter of this size
+            get chunks of their own.
+    */
+    explicit wxStringPool(size_t chunkSize = 16384);
+
+    ///@{
+    /**
+        Add a copy of the given string to the pool.
+
+        The second overload takes the string data in the same internal
+        representation as used by wxPooledString::data().
+
+        @return The index of the new string in the pool.
+    */
+    size_t Add(const wxString& s);
+    size_t Add(const wxStringCharType* s, size_t len);
+    ///@}
+
+    ///@{
+    /**
+        Add all the strings from the given range or array.
+
+        This is more efficient than calling Add() for all of them because the
+        memory for all the strings is allocated at once.
+
+        The iterators must refer to wxString objects.
+    */
+    template <typename Iterator>
+    void Append(Iterator first, Iterator last);
+
+    void Append(const wxArrayString& strings);
+    ///@}
+
+    /**
+        Preallocate memory for adding more strings.
+
+        @param count The number of strings which will be added.
+        @param totalLength Their total length, not counting the trailing NUL
+            characters.
+    */
+    void Reserve(size_t count, size_t totalLength);
+
+    /**
+        Remove all strings from the pool but keep the allocated memory.
+
+        This is useful when the pool is filled with strings again later, as
+        it avoids allocating memory again.
+
+        All wxPooledString objects previously returned by this pool become
+        invalid after calling this function.
+    */
+    void Empty();
+
+    /**
+        Remove all strings from the pool and free all memory.
+
+        All wxPooledString objects previously returned by this pool become
+        invalid after calling this function.
+    */
+    void Clear();
+
+    /// Return the number of strings in the pool.
+    size_t GetCount() const;
+
+    /// Return @true if the pool doesn't contain any strings.
+    bool IsEmpty() const;
+
+    ///@{
+    /**
+        Return the string with the given index.
+
+        The index must be less than GetCount().
+    */
+    wxPooledString Item(size_t n) const;
+    wxPooledString operator[](size_t n) const;
+    ///@}
+
+    ///@{
+    /**
+        Iterate over all strings in the pool.
+    */
+    const_iterator begin() const;
+    const_iterator end() const;
+    ///@}
+
+    /**
+        Return the total size of the memory used for storing the strings.
+
+        The returned size is in bytes. It doesn't include the memory used for
+        the wxPooledString objects themselves.
+    */
+    size_t GetMemoryUsage() const;
+};
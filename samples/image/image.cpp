@@ -139,6 +139,8 @@ enum
     ID_ZOOM_BILINEAR,
     ID_ZOOM_BICUBIC,
     ID_ZOOM_BOX_AVERAGE,
+    ID_ZOOM_LANCZOS3,
+    ID_ZOOM_MITCHELL,
     ID_PAINT_BG
 };
 
@@ -222,6 +224,8 @@ private:
         menu->AppendRadioItem(ID_ZOOM_BILINEAR, "Use rescale bilinear\tShift-Ctrl-L");
         menu->AppendRadioItem(ID_ZOOM_BICUBIC, "Use rescale bicubic\tShift-Ctrl-C");
         menu->AppendRadioItem(ID_ZOOM_BOX_AVERAGE, "Use rescale box average\tShift-Ctrl-B");
+        menu->AppendRadioItem(ID_ZOOM_LANCZOS3, "Use rescale Lanczos\tShift-Ctrl-Z");
+        menu->AppendRadioItem(ID_ZOOM_MITCHELL, "Use rescale Mitchell\tShift-Ctrl-M");
         menu->AppendSeparator();
         menu->Append(ID_ROTATE_LEFT, "Rotate &left\tCtrl-L");
         menu->Append(ID_ROTATE_RIGHT, "Rotate &right\tCtrl-R");
@@ -564,6 +568,14 @@ private:
                 m_resizeQuality = wxIMAGE_QUALITY_BOX_AVERAGE;
                 break;
 
+            case ID_ZOOM_LANCZOS3:
+                m_resizeQuality = wxIMAGE_QUALITY_LANCZOS3;
+                break;
+
+            case ID_ZOOM_MITCHELL:
+                m_resizeQuality = wxIMAGE_QUALITY_MITCHELL;
+                break;
+
             default:
                 wxFAIL_MSG("unknown use for zoom command");
                 return;
@@ -1100,6 +1112,8 @@ wxBEGIN_EVENT_TABLE(MyImageFrame, wxFrame)
     EVT_MENU(ID_ZOOM_BILINEAR, MyImageFrame::OnUseZoom)
     EVT_MENU(ID_ZOOM_BICUBIC, MyImageFrame::OnUseZoom)
     EVT_MENU(ID_ZOOM_BOX_AVERAGE, MyImageFrame::OnUseZoom)
+    EVT_MENU(ID_ZOOM_LANCZOS3, MyImageFrame::OnUseZoom)
+    EVT_MENU(ID_ZOOM_MITCHELL, MyImageFrame::OnUseZoom)
 wxEND_EVENT_TABLE()
 
 //-----------------------------------------------------------------------------
@@ -24,6 +24,8 @@
     #include "wx/window.h"
 #endif
 
+#include "wx/atom.h"
+
 #include <list>
 #include <memory>
 #include <unordered_map>
@@ -39,43 +41,73 @@ public:
 // Cache class - stores already requested bitmaps
 // ----------------------------------------------------------------------------
 
-using wxArtProviderBitmapsHash = std::unordered_map<wxString, wxBitmap>;
-using wxArtProviderBitmapBundlesHash = std::unordered_map<wxString, wxBitmapBundle>;
-using wxArtProviderIconBundlesHash = std::unordered_map<wxString, wxIconBundle>;
+// The key used for the cache: notice that using atoms for the IDs and clients,
+// which are almost always the same few strings, avoids both constructing a
+// new string for each lookup and hashing and comparing the strings.
+struct wxArtProviderCacheKey
+{
+    wxArtProviderCacheKey(const wxArtID& id_,
+                          const wxArtClient& client_,
+                          const wxSize& size_ = wxDefaultSize)
+        : id(id_), client(client_), size(size_)
+    {
+    }
+
+    bool operator==(const wxArtProviderCacheKey& other) const
+    {
+        return id == other.id && client == other.client && size == other.size;
+    }
+
+    wxAtom id;
+    wxAtom client;
+    wxSize size;
+};
+
+struct wxArtProviderCacheKeyHash
+{
+    size_t operator()(const wxArtProviderCacheKey& key) const
+    {
+        size_t hash = key.id.GetHash();
+        hash = hash*31 + key.client.GetHash();
+        hash = hash*31 + static_cast<size_t>(key.size.x);
+        hash = hash*31 + static_cast<size_t>(key.size.y);
+        return hash;
+    }
+};
+
+using wxArtProviderBitmapsHash =
+    std::unordered_map<wxArtProviderCacheKey, wxBitmap, wxArtProviderCacheKeyHash>;
+using wxArtProviderBitmapBundlesHash =
+    std::unordered_map<wxArtProviderCacheKey, wxBitmapBundle, wxArtProviderCacheKeyHash>;
+using wxArtProviderIconBundlesHash =
+    std::unordered_map<wxArtProviderCacheKey, wxIconBundle, wxArtProviderCacheKeyHash>;
 
 class wxArtProviderCache
 {
 public:
-    bool GetBitmap(const wxString& full_id, wxBitmap* bmp);
-    void PutBitmap(const wxString& full_id, const wxBitmap& bmp)
-        { m_bitmapsHash[full_id] = bmp; }
+    bool GetBitmap(const wxArtProviderCacheKey& key, wxBitmap* bmp);
+    void PutBitmap(const wxArtProviderCacheKey& key, const wxBitmap& bmp)
+        { m_bitmapsHash[key] = bmp; }
 
-    bool GetBitmapBundle(const wxString& full_id, wxBitmapBundle* bmpbndl);
-    void PutBitmapBundle(const wxString& full_id, const wxBitmapBundle& bmpbndl)
-        { m_bitmapsBundlesHash[full_id] = bmpbndl; }
+    bool GetBitmapBundle(const wxArtProviderCacheKey& key, wxBitmapBundle* bmpbndl);
+    void PutBitmapBundle(const wxArtProviderCacheKey& key, const wxBitmapBundle& bmpbndl)
+        { m_bitmapsBundlesHash[key] = bmpbndl; }
 
-    bool GetIconBundle(const wxString& full_id, wxIconBundle* bmp);
-    void PutIconBundle(const wxString& full_id, const wxIconBundle& iconbundle)
-        { m_iconBundlesHash[full_id] = iconbundle; }
+    bool GetIconBundle(const wxArtProviderCacheKey& key, wxIconBundle* bmp);
+    void PutIconBundle(const wxArtProviderCacheKey& key, const wxIconBundle& iconbundle)
+        { m_iconBundlesHash[key] = iconbundle; }
 
     void Clear();
 
-    static wxString ConstructHashID(const wxArtID& id,
-                                    const wxArtClient& client,
-                                    const wxSize& size);
-
-    static wxString ConstructHashID(const wxArtID& id,
-                                    const wxArtClient& client);
-
 private:
     wxArtProviderBitmapsHash m_bitmapsHash;                 // cache of wxBitmaps
     wxArtProviderBitmapBundlesHash m_bitmapsBundlesHash;    // cache of wxBitmaps
     wxArtProviderIconBundlesHash m_iconBundlesHash;         // cache of wxIconBundles
 };
 
-bool wxArtProviderCache::GetBitmap(const wxString& full_id, wxBitmap* bmp)
+bool wxArtProviderCache::GetBitmap(const wxArtProviderCacheKey& key, wxBitmap* bmp)
 {
-    wxArtProviderBitmapsHash::iterator entry = m_bitmapsHash.find(full_id);
+    wxArtProviderBitmapsHash::iterator entry = m_bitmapsHash.find(key);
     if ( entry == m_bitmapsHash.end() )
     {
         return false;
@@ -87,9 +119,9 @@ bool wxArtProviderCache::GetBitmap(const wxString& full_id, wxBitmap* bmp)
     }
 }
 
-bool wxArtProviderCache::GetBitmapBundle(const wxString& full_id, wxBitmapBundle* bmpbndl)
+bool wxArtProviderCache::GetBitmapBundle(const wxArtProviderCacheKey& key, wxBitmapBundle* bmpbndl)
 {
-    wxArtProviderBitmapBundlesHash::iterator entry = m_bitmapsBundlesHash.find(full_id);
+    wxArtProviderBitmapBundlesHash::iterator entry = m_bitmapsBundlesHash.find(key);
     if ( entry == m_bitmapsBundlesHash.end() )
     {
         return false;
@@ -102,9 +134,9 @@ bool wxArtProviderCache::GetBitmapBundle(const wxString& full_id, wxBitmapBundle
 }
 
 
-bool wxArtProviderCache::GetIconBundle(const wxString& full_id, wxIconBundle* bmp)
+bool wxArtProviderCache::GetIconBundle(const wxArtProviderCacheKey& key, wxIconBundle* bmp)
 {
-    wxArtProviderIconBundlesHash::iterator entry = m_iconBundlesHash.find(full_id);
+    wxArtProviderIconBundlesHash::iterator entry = m_iconBundlesHash.find(key);
     if ( entry == m_iconBundlesHash.end() )
     {
         return false;
@@ -122,23 +154,6 @@ void wxArtProviderCache::Clear()
     m_iconBundlesHash.clear();
 }
 
-/* static */ wxString
-wxArtProviderCache::ConstructHashID(const wxArtID& id,
-                                    const wxArtClient& client)
-{
-    return id + wxT('-') + client;
-}
-
-
-/* static */ wxString
-wxArtProviderCache::ConstructHashID(const wxArtID& id,
-                                    const wxArtClient& client,
-                                    const wxSize& size)
-{
-    return ConstructHashID(id, client) + wxT('-') +
-            wxString::Format(wxT("%d-%d"), size.x, size.y);
-}
-
 // ----------------------------------------------------------------------------
 // wxBitmapBundleImplArt: uses art provider to get the bitmaps
 // ----------------------------------------------------------------------------
@@ -428,7 +443,7 @@ wxArtProvider::RescaleOrResizeIfNeeded(wxBitmap& bmp, const wxSize& sizeNeeded)
 
     wxCHECK_MSG( sm_providers, wxNullBitmap, wxT("no wxArtProvider exists") );
 
-    wxString hashId = wxArtProviderCache::ConstructHashID(id, client, size);
+    const wxArtProviderCacheKey hashId(id, client, size);
 
     wxBitmap bmp;
     if ( !sm_cache->GetBitmap(hashId, &bmp) )
@@ -490,7 +505,7 @@ wxBitmapBundle wxArtProvider::GetBitmapBundle(const wxArtID& id,
 
     wxCHECK_MSG( sm_providers, wxNullBitmap, wxT("no wxArtProvider exists") );
 
-    wxString hashId = wxArtProviderCache::ConstructHashID(id, client, size);
+    const wxArtProviderCacheKey hashId(id, client, size);
 
     wxBitmapBundle bitmapbundle; // (DoGetIconBundle(id, client));
 
@@ -554,7 +569,7 @@ wxIconBundle wxArtProvider::DoGetIconBundle(const wxArtID& id, const wxArtClient
 
     wxCHECK_MSG( sm_providers, wxNullIconBundle, wxT("no wxArtProvider exists") );
 
-    wxString hashId = wxArtProviderCache::ConstructHashID(id, client);
+    const wxArtProviderCacheKey hashId(id, client);
 
     wxIconBundle iconbundle;
     if ( !sm_cache->GetIconBundle(hashId, &iconbundle) )
@@ -0,0 +1,78 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        src/common/atom.cpp
+// Purpose:     wxAtom implementation
+// Author:      wxWidgets team
+// Created:     2026-10-17
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+// For compilers that support precompilation, includes "wx.h".
+#include "wx/wxprec.h"
+
+#include "wx/atom.h"
+
+#include "wx/thread.h"
+
+#include <unordered_set>
+
+namespace
+{
+
+// The global table of all atoms strings.
+//
+// Notice that the elements of std::unordered_set are never moved in memory,
+// even when it is rehashed, so we can keep pointers to them.
+class wxAtomTable
+{
+public:
+    static wxAtomTable& Get()
+    {
+        // This object is intentionally never destroyed, as atoms may be
+        // stored in global objects which could still be used after it would
+        // have been destroyed otherwise.
+        static wxAtomTable* const s_table = new wxAtomTable;
+
+        return *s_table;
+    }
+
+    const wxString* GetEmpty() const { return m_empty; }
+
+    const wxString* Intern(const wxString& s)
+    {
+        if ( s.empty() )
+            return m_empty;
+
+        wxCriticalSectionLocker lock(m_cs);
+
+        return &*m_strings.insert(s).first;
+    }
+
+private:
+    wxAtomTable()
+    {
+        m_empty = &*m_strings.insert(wxString()).first;
+    }
+
+    wxCriticalSection m_cs;
+
+    std::unordered_set<wxString> m_strings;
+
+    const wxString* m_empty;
+};
+
+} // anonymous namespace
+
+// ============================================================================
+// wxAtom implementation
+// ============================================================================
+
+wxAtom::wxAtom()
+    : m_str(wxAtomTable::Get().GetEmpty())
+{
+}
+
+wxAtom::wxAtom(const wxString& s)
+    : m_str(wxAtomTable::Get().Intern(s))
+{
+}
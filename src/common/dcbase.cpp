@@ -1102,6 +1102,37 @@ void wxDCImpl::DoGetFontMetrics(int *height,
         *internalLeading = 0;
 }
 
+void wxDCImpl::DoGetTextExtents(size_t n,
+                                const wxString* strings,
+                                wxSize* extents,
+                                const wxFont* font) const
+{
+    wxTextMeasure tm(GetOwner(), font && font->IsOk() ? font : &m_font);
+    tm.GetTextExtents(n, strings, extents);
+}
+
+//-----------------------------------------------------------------------------
+// wxReadOnlyDC
+//-----------------------------------------------------------------------------
+
+/* static */
+void wxReadOnlyDC::EnableTextExtentCache(size_t maxEntries)
+{
+    wxTextMeasure::EnableExtentCache(maxEntries);
+}
+
+/* static */
+void wxReadOnlyDC::ClearTextExtentCache()
+{
+    wxTextMeasure::ClearExtentCache();
+}
+
+/* static */
+void wxReadOnlyDC::GetTextExtentCacheStats(size_t* hits, size_t* misses)
+{
+    wxTextMeasure::GetExtentCacheStats(hits, misses);
+}
+
 //-----------------------------------------------------------------------------
 // wxDC
 //-----------------------------------------------------------------------------
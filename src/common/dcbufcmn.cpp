@@ -20,11 +20,15 @@
 
 
 #include "wx/dcbuffer.h"
+#include "wx/private/dcbuffer.h"
 
 #ifndef WX_PRECOMP
     #include "wx/module.h"
 #endif
 
+#include <unordered_map>
+#include <utility>
+
 // ============================================================================
 // implementation
 // ============================================================================
@@ -100,6 +104,92 @@ bool wxSharedDCBufferManager::ms_usingSharedBuffer = false;
 
 wxIMPLEMENT_DYNAMIC_CLASS(wxSharedDCBufferManager, wxModule);
 
+// ----------------------------------------------------------------------------
+// wxWindowBackingStoreManager: helper class maintaining per-window buffers
+// ----------------------------------------------------------------------------
+
+class wxWindowBackingStoreManager : public wxModule
+{
+public:
+    wxWindowBackingStoreManager() { }
+
+    virtual bool OnInit() override { return true; }
+    virtual void OnExit() override { ms_stores.clear(); }
+
+    static wxWindowBackingStore& Get(wxWindow* window)
+    {
+        const auto it = ms_stores.find(window);
+        if ( it != ms_stores.end() )
+            return it->second;
+
+        // Free the bitmaps when the window is destroyed: notice that destroy
+        // events don't propagate upwards, so we only get the ones for this
+        // window itself here.
+        window->Bind(wxEVT_DESTROY, [window](wxWindowDestroyEvent& event)
+            {
+                event.Skip();
+
+                ms_stores.erase(window);
+            });
+
+        return ms_stores[window];
+    }
+
+private:
+    static std::unordered_map<wxWindow*, wxWindowBackingStore> ms_stores;
+
+    wxDECLARE_DYNAMIC_CLASS(wxWindowBackingStoreManager);
+};
+
+std::unordered_map<wxWindow*, wxWindowBackingStore>
+    wxWindowBackingStoreManager::ms_stores;
+
+wxIMPLEMENT_DYNAMIC_CLASS(wxWindowBackingStoreManager, wxModule);
+
+// ============================================================================
+// wxWindowBackingStore
+// ============================================================================
+
+bool wxWindowBackingStore::Prepare(const wxSize& size,
+                                   double scale,
+                                   const wxPoint& origin)
+{
+    bool redrawAll = false;
+    if ( !m_bitmap.IsOk() ||
+            m_bitmap.GetLogicalSize() != size ||
+                m_bitmap.GetScaleFactor() != scale )
+    {
+        // The previous contents can't be reused, so everything needs to be
+        // redrawn, whatever the update region is.
+        m_bitmap = wxBitmap();
+        m_spare = wxBitmap();
+        m_bitmap.CreateWithLogicalSize(wxMax(size.x, 1), wxMax(size.y, 1),
+                                       scale);
+
+        redrawAll = true;
+    }
+    else if ( origin != m_origin )
+    {
+        // The window was scrolled: the pixels which remain visible have been
+        // already moved on screen, so move them in the backing store too, to
+        // keep it in sync with the window without redrawing them, while the
+        // newly exposed part is included in the update region.
+        if ( !m_spare.IsOk() )
+            m_spare.CreateWithLogicalSize(m_bitmap.GetLogicalSize(), scale);
+
+        {
+            wxMemoryDC dc(m_spare);
+            dc.DrawBitmap(m_bitmap, origin - m_origin);
+        }
+
+        std::swap(m_bitmap, m_spare);
+    }
+
+    m_origin = origin;
+
+    return redrawAll;
+}
+
 // ============================================================================
 // wxBufferedDC
 // ============================================================================
@@ -160,9 +250,66 @@ void wxBufferedDC::UnMask()
     }
 
     const wxPoint origin = GetLogicalOrigin();
-    m_dc->Blit(-origin.x, -origin.y, width, height, this, -x, -y);
+    if ( m_blitRegion.IsEmpty() )
+    {
+        m_dc->Blit(-origin.x, -origin.y, width, height, this, -x, -y);
+    }
+    else
+    {
+        // Only copy the parts of the buffer which were redrawn.
+        for ( wxRegionIterator it(m_blitRegion); it; ++it )
+        {
+            const wxRect r = it.GetRect().Intersect(wxRect(0, 0, width, height));
+            if ( r.IsEmpty() )
+                continue;
+
+            m_dc->Blit(r.x - origin.x, r.y - origin.y, r.width, r.height,
+                       this, r.x - x, r.y - y);
+        }
+    }
+
     m_dc = nullptr;
 
     if ( m_style & wxBUFFER_USES_SHARED_BUFFER )
         wxSharedDCBufferManager::ReleaseBuffer(m_buffer);
 }
+
+// ============================================================================
+// wxBufferedPaintDC
+// ============================================================================
+
+void wxBufferedPaintDC::InitPersistent(wxWindow *window, int style)
+{
+    if ( style & wxBUFFER_VIRTUAL_AREA )
+    {
+        wxFAIL_MSG( "wxBUFFER_PERSISTENT can't be used with wxBUFFER_VIRTUAL_AREA" );
+
+        Init(&m_paintdc, GetBufferedSize(window, style),
+             style & ~wxBUFFER_PERSISTENT);
+        return;
+    }
+
+    // Find the current scroll position, if any: the paint DC itself is not
+    // prepared when buffering the client area, so we can use it for this.
+    window->PrepareDC(m_paintdc);
+    const wxPoint origin = m_paintdc.GetDeviceOrigin();
+    m_paintdc.SetDeviceOrigin(0, 0);
+    m_paintdc.SetUserScale(1.0, 1.0);
+
+    wxWindowBackingStore& store = wxWindowBackingStoreManager::Get(window);
+
+    const bool redrawAll = store.Prepare(GetBufferedSize(window, style),
+                                         m_paintdc.GetContentScaleFactor(),
+                                         origin);
+
+    Init(&m_paintdc, store.GetBitmap(), style);
+
+    const wxRegion& region = window->GetUpdateRegion();
+    if ( !redrawAll && !region.IsEmpty() )
+    {
+        // Prevent the drawing code from touching anything outside of the
+        // update region and then copy just this region to the window.
+        SetDeviceClippingRegion(region);
+        SetBlitRegion(region);
+    }
+}
@@ -26,8 +26,11 @@
 #include "wx/mstream.h"
 #include "wx/scopedarray.h"
 #include "wx/display.h"
+#include "wx/zstream.h"
 #include "wx/private/rescale.h"
 
+#include <locale.h>
+
 #if wxUSE_MARKUP
     #include "wx/private/markupparser.h"
 #endif
@@ -61,6 +64,49 @@ inline wxString NumStr(float f)
     return NumStr(double(f));
 }
 
+// Faster version of NumStr() writing the number into the provided buffer,
+// which must be big enough to contain any number in the fixed format, and
+// returning the length of the string.
+size_t NumStrTo(char* buf, size_t size, double f)
+{
+    if ( f == 0 )
+    {
+        memcpy(buf, "0.00", 4);
+        return 4;
+    }
+
+    int len = snprintf(buf, size, "%.2f", f);
+    if ( len <= 0 || static_cast<size_t>(len) >= size )
+    {
+        // This is not supposed to happen, but if it does, fall back to the
+        // slow but safe version.
+        const wxScopedCharBuffer str = NumStr(f).utf8_str();
+        len = wxMin(str.length(), size - 1);
+        memcpy(buf, str.data(), len);
+        return len;
+    }
+
+    // Replace the locale-specific decimal separator, if any, with the dot.
+    const char* const point = localeconv()->decimal_point;
+    if ( point[0] != '.' || point[1] != '\0' )
+    {
+        char* const p = strstr(buf, point);
+        if ( p )
+        {
+            const size_t pointLen = strlen(point);
+            *p = '.';
+            memmove(p + 1, p + pointLen, buf + len + 1 - (p + pointLen));
+            len -= pointLen - 1;
+        }
+    }
+
+    return len;
+}
+
+// Size of the buffer used for the SVG output, it's flushed to the output
+// stream when its size exceeds this value.
+const size_t SVG_BUFFER_SIZE = 64*1024;
+
 // Return the colour representation as HTML-like "#rrggbb" string and also
 // returns its alpha as opacity number in 0..1 range.
 wxString Col2SVG(wxColour c, float* opacity = nullptr)
@@ -506,6 +552,11 @@ void wxSVGFileDC::SetShapeRenderingMode(wxSVGShapeRenderingMode renderingMode)
     ((wxSVGFileDCImpl*)GetImpl())->SetShapeRenderingMode(renderingMode);
 }
 
+void wxSVGFileDC::EnableLineCoalescing(bool enable)
+{
+    ((wxSVGFileDCImpl*)GetImpl())->EnableLineCoalescing(enable);
+}
+
 // ----------------------------------------------------------
 // wxSVGFileDCImpl
 // ----------------------------------------------------------
@@ -550,14 +601,44 @@ void wxSVGFileDCImpl::Init(const wxString& filename, int width, int height,
 
     m_renderingMode = wxSVG_SHAPE_RENDERING_AUTO;
 
+    m_coalesceLines = false;
+    m_pathPending = false;
+
     ////////////////////code here
 
     m_bmp_handler.reset();
 
+    m_output = nullptr;
+    m_zlibStream.reset();
+    m_buffer.reserve(SVG_BUFFER_SIZE);
+
     if ( m_filename.empty() )
+    {
         m_outfile.reset();
+    }
     else
+    {
         m_outfile.reset(new wxFileOutputStream(m_filename));
+        m_output = m_outfile.get();
+
+        // Produce compressed output if the file has the standard extension
+        // used for the compressed SVG files.
+        if ( wxFileName(m_filename).GetExt().IsSameAs(wxS("svgz"), false) )
+        {
+#if wxUSE_ZLIB
+            m_zlibStream.reset(new wxZlibOutputStream(*m_outfile,
+                                                      wxZ_DEFAULT_COMPRESSION,
+                                                      wxZLIB_GZIP));
+            m_output = m_zlibStream.get();
+#else // !wxUSE_ZLIB
+            wxFAIL_MSG("Writing compressed SVG requires wxUSE_ZLIB");
+#endif // wxUSE_ZLIB/!wxUSE_ZLIB
+        }
+    }
+
+    // As the output is buffered, check for errors, e.g. if the file couldn't
+    // be created, immediately instead of only doing it when flushing.
+    m_OK = m_output && m_output->IsOk();
 
     const wxSize dpiSize = FromDIP(wxSize(m_width, m_height));
 
@@ -583,6 +664,11 @@ wxSVGFileDCImpl::~wxSVGFileDCImpl()
 
     s += wxS("</g>\n</svg>\n");
     write(s);
+
+    FlushBuffer();
+
+    // Close the compressed stream before the file it writes to.
+    m_zlibStream.reset();
 }
 
 void wxSVGFileDCImpl::DoGetSizeMM(int* width, int* height) const
@@ -625,13 +711,42 @@ void wxSVGFileDCImpl::Clear()
 
 void wxSVGFileDCImpl::DoDrawLine(wxCoord x1, wxCoord y1, wxCoord x2, wxCoord y2)
 {
-    NewGraphicsIfNeeded();
+    // Continue the current path if the attributes haven't changed since it
+    // was started, notice that they're reset when they change.
+    if ( m_pathPending && !m_graphics_changed && !m_shapeAttrs.empty() )
+    {
+        WriteRaw(" M");
+    }
+    else
+    {
+        NewGraphicsIfNeeded();
 
-    wxString s;
-    s = wxString::Format(wxS("  <path d=\"M%d %d L%d %d\" %s %s/>\n"),
-        x1, y1, x2, y2, GetRenderMode(m_renderingMode), GetPenPattern(m_pen));
+        WriteRaw("  <path d=\"M");
+    }
 
-    write(s);
+    WriteInt(x1);
+    WriteRaw(" ");
+    WriteInt(y1);
+    WriteRaw(" L");
+    WriteInt(x2);
+    WriteRaw(" ");
+    WriteInt(y2);
+
+    if ( m_coalesceLines )
+    {
+        // Don't close the path yet, more lines may be added to it.
+        if ( !m_pathPending )
+        {
+            m_pathAttrs = GetShapeAttrs();
+            m_pathPending = true;
+        }
+    }
+    else
+    {
+        WriteRaw("\" ");
+        WriteRaw(GetShapeAttrs());
+        WriteRaw("/>\n");
+    }
 
     if ( AreAutomaticBoundingBoxUpdatesEnabled() )
         CalcBoundingBox(x1, y1, x2, y2);
@@ -642,25 +757,28 @@ void wxSVGFileDCImpl::DoDrawLines(int n, const wxPoint points[], wxCoord xoffset
     if (n > 1)
     {
         NewGraphicsIfNeeded();
-        wxString s;
 
-        s = wxString::Format(wxS("  <path d=\"M%d %d"),
-            (points[0].x + xoffset), (points[0].y + yoffset));
+        WriteRaw("  <path d=\"M");
+        WriteInt(points[0].x + xoffset);
+        WriteRaw(" ");
+        WriteInt(points[0].y + yoffset);
 
         if ( AreAutomaticBoundingBoxUpdatesEnabled() )
             CalcBoundingBox(points[0].x + xoffset, points[0].y + yoffset);
 
         for (int i = 1; i < n; ++i)
         {
-            s += wxString::Format(wxS(" L%d %d"), (points[i].x + xoffset), (points[i].y + yoffset));
+            WriteRaw(" L");
+            WriteInt(points[i].x + xoffset);
+            WriteRaw(" ");
+            WriteInt(points[i].y + yoffset);
             if ( AreAutomaticBoundingBoxUpdatesEnabled() )
                 CalcBoundingBox(points[i].x + xoffset, points[i].y + yoffset);
         }
 
-        s += wxString::Format(wxS("\" style=\"fill:none\" %s %s/>\n"),
-            GetRenderMode(m_renderingMode), GetPenPattern(m_pen));
-
-        write(s);
+        WriteRaw("\" style=\"fill:none\" ");
+        WriteRaw(GetShapeAttrs());
+        WriteRaw("/>\n");
     }
 }
 
@@ -868,13 +986,21 @@ void wxSVGFileDCImpl::DoDrawRectangle(wxCoord x, wxCoord y, wxCoord width, wxCoo
 void wxSVGFileDCImpl::DoDrawRoundedRectangle(wxCoord x, wxCoord y, wxCoord width, wxCoord height, double radius)
 {
     NewGraphicsIfNeeded();
-    wxString s;
 
-    s = wxString::Format(wxS("  <rect x=\"%d\" y=\"%d\" width=\"%d\" height=\"%d\" rx=\"%s\" %s %s %s/>\n"),
-        x, y, width, height, NumStr(radius),
-        GetRenderMode(m_renderingMode), GetPenPattern(m_pen), GetBrushPattern(m_brush));
-
-    write(s);
+    WriteRaw("  <rect x=\"");
+    WriteInt(x);
+    WriteRaw("\" y=\"");
+    WriteInt(y);
+    WriteRaw("\" width=\"");
+    WriteInt(width);
+    WriteRaw("\" height=\"");
+    WriteInt(height);
+    WriteRaw("\" rx=\"");
+    WriteNum(radius);
+    WriteRaw("\" ");
+    WriteRaw(GetShapeAttrs());
+    WriteRaw(GetBrushAttrs());
+    WriteRaw("/>\n");
 
     if ( AreAutomaticBoundingBoxUpdatesEnabled() )
         CalcBoundingBox(wxPoint(x, y), wxSize(width, height));
@@ -886,22 +1012,23 @@ void wxSVGFileDCImpl::DoDrawPolygon(int n, const wxPoint points[],
 {
     NewGraphicsIfNeeded();
 
-    wxString s;
-
-    s = wxS("  <polygon points=\"");
+    WriteRaw("  <polygon points=\"");
 
     for (int i = 0; i < n; i++)
     {
-        s += wxString::Format(wxS("%d %d "), points[i].x + xoffset, points[i].y + yoffset);
+        WriteInt(points[i].x + xoffset);
+        WriteRaw(" ");
+        WriteInt(points[i].y + yoffset);
+        WriteRaw(" ");
         if ( AreAutomaticBoundingBoxUpdatesEnabled() )
             CalcBoundingBox(points[i].x + xoffset, points[i].y + yoffset);
     }
 
-    s += wxString::Format(wxS("\" %s %s %s style=\"fill-rule:%s;\"/>\n"),
-        GetRenderMode(m_renderingMode), GetPenPattern(m_pen), GetBrushPattern(m_brush),
-        fillStyle == wxODDEVEN_RULE ? wxS("evenodd") : wxS("nonzero"));
-
-    write(s);
+    WriteRaw("\" ");
+    WriteRaw(GetShapeAttrs());
+    WriteRaw(GetBrushAttrs());
+    WriteRaw(fillStyle == wxODDEVEN_RULE ? " style=\"fill-rule:evenodd;\"/>\n"
+                                         : " style=\"fill-rule:nonzero;\"/>\n");
 }
 
 void wxSVGFileDCImpl::DoDrawPolyPolygon(int n, const int count[], const wxPoint points[],
@@ -953,13 +1080,17 @@ void wxSVGFileDCImpl::DoDrawEllipse(wxCoord x, wxCoord y, wxCoord width, wxCoord
     const double rh = height / 2.0;
     const double rw = width / 2.0;
 
-    wxString s;
-    s = wxString::Format(wxS("  <ellipse cx=\"%s\" cy=\"%s\" rx=\"%s\" ry=\"%s\" %s %s"),
-        NumStr(x + rw), NumStr(y + rh), NumStr(rw), NumStr(rh),
-        GetRenderMode(m_renderingMode), GetPenPattern(m_pen));
-    s += wxS("/>\n");
-
-    write(s);
+    WriteRaw("  <ellipse cx=\"");
+    WriteNum(x + rw);
+    WriteRaw("\" cy=\"");
+    WriteNum(y + rh);
+    WriteRaw("\" rx=\"");
+    WriteNum(rw);
+    WriteRaw("\" ry=\"");
+    WriteNum(rh);
+    WriteRaw("\" ");
+    WriteRaw(GetShapeAttrs());
+    WriteRaw("/>\n");
 
     if ( AreAutomaticBoundingBoxUpdatesEnabled() )
         CalcBoundingBox(wxPoint(x, y), wxSize(width, height));
@@ -1344,6 +1475,17 @@ void wxSVGFileDCImpl::SetBitmapHandler(wxSVGBitmapHandler* handler)
 void wxSVGFileDCImpl::SetShapeRenderingMode(wxSVGShapeRenderingMode renderingMode)
 {
     m_renderingMode = renderingMode;
+
+    m_shapeAttrs.clear();
+    m_brushAttrs.clear();
+}
+
+void wxSVGFileDCImpl::EnableLineCoalescing(bool enable)
+{
+    if ( !enable )
+        ClosePendingPath();
+
+    m_coalesceLines = enable;
 }
 
 void wxSVGFileDCImpl::SetBrush(const wxBrush& brush)
@@ -1351,6 +1493,7 @@ void wxSVGFileDCImpl::SetBrush(const wxBrush& brush)
     m_brush = brush;
 
     m_graphics_changed = true;
+    m_brushAttrs.clear();
 
     wxString pattern = CreateBrushFill(m_brush, m_renderingMode);
     if ( !pattern.empty() )
@@ -1366,10 +1509,14 @@ void wxSVGFileDCImpl::SetPen(const wxPen& pen)
     m_pen = pen;
 
     m_graphics_changed = true;
+    m_shapeAttrs.clear();
 }
 
 void wxSVGFileDCImpl::NewGraphicsIfNeeded()
 {
+    // Any output other than another line ends the current path.
+    ClosePendingPath();
+
     if ( !m_graphics_changed )
         return;
 
@@ -1447,23 +1594,114 @@ void wxSVGFileDCImpl::DoDrawBitmap(const wxBitmap& bmp, wxCoord x, wxCoord y,
     if ( !m_bmp_handler )
         m_bmp_handler.reset(new wxSVGBitmapFileHandler(m_filename));
 
-    m_OK = m_outfile && m_outfile->IsOk();
+    // The handler writes directly to the stream, so make sure everything
+    // before the bitmap is written first.
+    FlushBuffer();
+
+    m_OK = m_output && m_output->IsOk();
     if (!m_OK)
         return;
 
-    m_bmp_handler->ProcessBitmap(bmp, x, y, *m_outfile);
-    m_OK = m_outfile->IsOk();
+    m_bmp_handler->ProcessBitmap(bmp, x, y, *m_output);
+    m_OK = m_output->IsOk();
 }
 
 void wxSVGFileDCImpl::write(const wxString& s)
 {
-    m_OK = m_outfile && m_outfile->IsOk();
-    if (!m_OK)
+    ClosePendingPath();
+
+    const wxScopedCharBuffer buf = s.utf8_str();
+    WriteRaw(buf.data(), buf.length());
+}
+
+void wxSVGFileDCImpl::WriteRaw(const char* s, size_t len)
+{
+    if ( !m_output )
+    {
+        m_OK = false;
         return;
+    }
 
-    const wxCharBuffer buf = s.utf8_str();
-    m_outfile->Write(buf, strlen((const char*)buf));
-    m_OK = m_outfile->IsOk();
+    m_buffer.append(s, len);
+
+    if ( m_buffer.length() >= SVG_BUFFER_SIZE )
+        FlushBuffer();
+}
+
+void wxSVGFileDCImpl::WriteInt(int n)
+{
+    char buf[16];
+    char* const end = buf + WXSIZEOF(buf);
+    char* p = end;
+
+    // Use unsigned arithmetic to handle INT_MIN correctly.
+    unsigned u = n < 0 ? 0u - static_cast<unsigned>(n) : n;
+    do
+    {
+        *--p = static_cast<char>('0' + u % 10);
+        u /= 10;
+    } while ( u );
+
+    if ( n < 0 )
+        *--p = '-';
+
+    WriteRaw(p, end - p);
+}
+
+void wxSVGFileDCImpl::WriteNum(double f)
+{
+    // This is big enough for any double in fixed format with 2 decimals.
+    char buf[512];
+    WriteRaw(buf, NumStrTo(buf, sizeof(buf), f));
+}
+
+void wxSVGFileDCImpl::FlushBuffer()
+{
+    m_OK = m_output && m_output->IsOk();
+    if ( m_OK && !m_buffer.empty() )
+    {
+        m_output->Write(m_buffer.data(), m_buffer.length());
+        m_OK = m_output->IsOk();
+    }
+
+    m_buffer.clear();
+}
+
+void wxSVGFileDCImpl::ClosePendingPath()
+{
+    if ( !m_pathPending )
+        return;
+
+    m_pathPending = false;
+
+    WriteRaw("\" ");
+    WriteRaw(m_pathAttrs);
+    WriteRaw("/>\n");
+}
+
+const std::string& wxSVGFileDCImpl::GetShapeAttrs()
+{
+    if ( m_shapeAttrs.empty() )
+    {
+        const wxString
+            s = GetRenderMode(m_renderingMode) + wxS(" ") + GetPenPattern(m_pen);
+        m_shapeAttrs = s.utf8_string();
+    }
+
+    return m_shapeAttrs;
+}
+
+const std::string& wxSVGFileDCImpl::GetBrushAttrs()
+{
+    if ( m_brushAttrs.empty() )
+    {
+        // Include the separating space in the cached string, this also
+        // ensures that it's never empty, even if the pattern itself is.
+        m_brushAttrs = " ";
+        m_brushAttrs += GetBrushPattern(m_brush).utf8_string();
+    }
+
+    return m_brushAttrs;
 }
 
 #endif // wxUSE_SVG
@@ -22,6 +22,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "wx/gifdecod.h"
+#include "wx/mstream.h"
 #include "wx/scopedarray.h"
 #include "wx/scopeguard.h"
 
@@ -63,6 +64,11 @@ public:
     unsigned int ncolours;          // number of colours
     wxString comment;
 
+    // only used with lazy decoding, when p is allocated on demand
+    size_t offset;                  // offset of the image data
+    int interl;                     // interlaced image flag
+    int bits;                       // initial code size
+
     wxDECLARE_NO_COPY_CLASS(GIFImage);
 };
 
@@ -81,14 +87,20 @@ GIFImage::GIFImage()
     p = (unsigned char *) nullptr;
     pal = (unsigned char *) nullptr;
     ncolours = 0;
+    offset = 0;
+    interl = 0;
+    bits = 0;
 }
 
 //---------------------------------------------------------------------------
 // wxGIFDecoder constructor and destructor
 //---------------------------------------------------------------------------
 
+unsigned int wxGIFDecoder::ms_defaultMaxCachedFrames = 0;
+
 wxGIFDecoder::wxGIFDecoder()
 {
+    m_maxCachedFrames = ms_defaultMaxCachedFrames;
 }
 
 wxGIFDecoder::~wxGIFDecoder()
@@ -109,6 +121,9 @@ void wxGIFDecoder::Destroy()
 
     m_frames.Clear();
     m_nFrames = 0;
+
+    m_data = wxMemoryBuffer();
+    m_cachedFrames.clear();
 }
 
 
@@ -137,8 +152,15 @@ bool wxGIFDecoder::ConvertToImage(unsigned int frame, wxImage *image) const
     if (!image->IsOk())
         return false;
 
-    pal = GetPalette(frame);
+    // this may fail when using lazy decoding
     src = GetData(frame);
+    if (!src)
+    {
+        image->Destroy();
+        return false;
+    }
+
+    pal = GetPalette(frame);
     dst = image->GetData();
     transparent = GetTransparentColourIndex(frame);
 
@@ -270,7 +292,14 @@ wxColour wxGIFDecoder::GetTransparentColour(unsigned int frame) const
                     pal[n*3 + 2]);
 }
 
-unsigned char* wxGIFDecoder::GetData(unsigned int frame) const    { return (GetFrame(frame)->p); }
+unsigned char* wxGIFDecoder::GetData(unsigned int frame) const
+{
+    if ( m_data.IsEmpty() )
+        return GetFrame(frame)->p;
+
+    return DecodeFrame(frame);
+}
+
 unsigned char* wxGIFDecoder::GetPalette(unsigned int frame) const { return (GetFrame(frame)->pal); }
 unsigned int wxGIFDecoder::GetNcolours(unsigned int frame) const  { return (GetFrame(frame)->ncolours); }
 int wxGIFDecoder::GetTransparentColourIndex(unsigned int frame) const  { return (GetFrame(frame)->transparent); }
@@ -284,7 +313,7 @@ int wxGIFDecoder::GetTransparentColourIndex(unsigned int frame) const  { return
 // getcode:
 //  Reads the next code from the file stream, with size 'bits'
 //
-int wxGIFDecoder::getcode(wxInputStream& stream, int bits, int ab_fin)
+int wxGIFDecoder::getcode(wxInputStream& stream, int bits, int ab_fin) const
 {
     unsigned int mask;          // bit mask
     unsigned int code;          // code (result)
@@ -346,7 +375,7 @@ int wxGIFDecoder::getcode(wxInputStream& stream, int bits, int ab_fin)
 //  Returns wxGIF_OK (== 0) on success, or an error code if something
 // fails (see header file for details)
 wxGIFErrorCode
-wxGIFDecoder::dgif(wxInputStream& stream, GIFImage *img, int interl, int bits)
+wxGIFDecoder::dgif(wxInputStream& stream, GIFImage *img, int interl, int bits) const
 {
     static const int allocSize = 4096 + 1;
 
@@ -590,6 +619,62 @@ as an End of Information itself)
 }
 
 
+// DecodeFrame:
+//  Returns the data of the given frame when using lazy decoding, decoding it
+//  from the saved GIF data if necessary and possibly discarding the data of
+//  the least recently used frame.
+//
+unsigned char* wxGIFDecoder::DecodeFrame(unsigned int frame) const
+{
+    GIFImage* const img = GetFrame(frame);
+
+    for ( size_t n = 0; n < m_cachedFrames.size(); n++ )
+    {
+        if ( m_cachedFrames[n] == frame )
+        {
+            // the frame is already decoded, just make it most recently used
+            m_cachedFrames.erase(m_cachedFrames.begin() + n);
+            m_cachedFrames.push_back(frame);
+
+            return img->p;
+        }
+    }
+
+    const size_t maxCachedFrames = m_maxCachedFrames ? m_maxCachedFrames : 1;
+    while ( m_cachedFrames.size() >= maxCachedFrames )
+    {
+        GIFImage* const old = GetFrame(m_cachedFrames[0]);
+        free(old->p);
+        old->p = nullptr;
+
+        m_cachedFrames.erase(m_cachedFrames.begin());
+    }
+
+    const size_t size = img->w * img->h;
+    img->p = (unsigned char *) malloc(size);
+    if ( !img->p )
+        return nullptr;
+
+    // the part of the image not covered by truncated data remains blank
+    memset(img->p, 0, size);
+
+    wxMemoryInputStream stream(m_data.GetData(), m_data.GetDataLen());
+    if ( stream.SeekI(img->offset) == wxInvalidOffset ||
+            dgif(stream, img, img->interl, img->bits) != wxGIF_OK )
+    {
+        // don't keep the partially decoded data around
+        free(img->p);
+        img->p = nullptr;
+
+        return nullptr;
+    }
+
+    m_cachedFrames.push_back(frame);
+
+    return img->p;
+}
+
+
 // CanRead:
 //  Returns true if the file looks like a valid GIF, false otherwise.
 //
@@ -614,6 +699,29 @@ bool wxGIFDecoder::DoCanRead(wxInputStream &stream) const
 //  header file for details)
 //
 wxGIFErrorCode wxGIFDecoder::LoadGIF(wxInputStream& stream)
+{
+    if ( !m_maxCachedFrames )
+        return DoLoadGIF(stream, false);
+
+    // check GIF signature before reading all the data
+    if (!CanRead(stream))
+        return wxGIF_INVFORMAT;
+
+    // keep all the data in memory to be able to decode the frames later
+    wxMemoryBuffer data;
+    char buf[4096];
+    while ( stream.Read(buf, sizeof(buf)).LastRead() )
+        data.AppendData(buf, stream.LastRead());
+
+    wxMemoryInputStream memstream(data.GetData(), data.GetDataLen());
+    const wxGIFErrorCode result = DoLoadGIF(memstream, true);
+    if ( m_nFrames )
+        m_data = data;
+
+    return result;
+}
+
+wxGIFErrorCode wxGIFDecoder::DoLoadGIF(wxInputStream& stream, bool lazy)
 {
     unsigned int  global_ncolors = 0;
     int           bits, interl, i;
@@ -835,10 +943,15 @@ wxGIFErrorCode wxGIFDecoder::LoadGIF(wxInputStream& stream)
                 pimg->delay = delay;
 
                 // allocate memory for image and palette
-                pimg->p   = (unsigned char *) malloc((unsigned int)size);
-                pimg->pal = (unsigned char *) malloc(768);
+                if (!lazy)
+                {
+                    pimg->p = (unsigned char *) malloc((unsigned int)size);
+                    if (!pimg->p)
+                        return wxGIF_MEMERR;
+                }
 
-                if ((!pimg->p) || (!pimg->pal))
+                pimg->pal = (unsigned char *) malloc(768);
+                if (!pimg->pal)
                     return wxGIF_MEMERR;
 
                 // load local color map if available, else use global map
@@ -862,10 +975,33 @@ wxGIFErrorCode wxGIFDecoder::LoadGIF(wxInputStream& stream)
                 if (stream.Eof() || bits <= 0)
                     return wxGIF_INVFORMAT;
 
-                // decode image
-                wxGIFErrorCode result = dgif(stream, pimg.get(), interl, bits);
-                if (result != wxGIF_OK)
-                    return result;
+                if (lazy)
+                {
+                    // just remember where the image data is and skip it,
+                    // it will be decoded when it's needed
+                    pimg->offset = stream.TellI();
+                    pimg->interl = interl;
+                    pimg->bits = bits;
+
+                    while ((i = stream.GetC()) != 0)
+                    {
+                        if (stream.Eof() || (stream.LastRead() == 0) ||
+                            stream.SeekI(i, wxFromCurrent) == wxInvalidOffset)
+                        {
+                            // the data is truncated, but we still can decode
+                            // this frame as far as possible
+                            done = true;
+                            break;
+                        }
+                    }
+                }
+                else
+                {
+                    // decode image
+                    wxGIFErrorCode result = dgif(stream, pimg.get(), interl, bits);
+                    if (result != wxGIF_OK)
+                        return result;
+                }
 
                 guardDestroy.Dismiss();
 
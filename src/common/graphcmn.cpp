@@ -714,6 +714,46 @@ void wxGraphicsContext::DrawPath( const wxGraphicsPath& path, wxPolygonFillMode
     StrokePath( path );
 }
 
+void wxGraphicsContext::DrawPathInstances( const wxGraphicsPath& path,
+                                           size_t n,
+                                           const wxPoint2DDouble *offsets,
+                                           wxPolygonFillMode fillStyle )
+{
+    wxCHECK_RET( !n || offsets, wxS("Offsets must be specified") );
+
+    if ( !n )
+        return;
+
+    // Combine all the instances into a single path to have the same result as
+    // the specialized implementations in the derived classes.
+    wxGraphicsPath all = CreatePath();
+    for ( size_t i = 0; i < n; ++i )
+    {
+        wxGraphicsMatrix m = CreateMatrix();
+        m.Translate(offsets[i].m_x, offsets[i].m_y);
+
+        wxGraphicsPath instance = CreatePath();
+        instance.AddPath(path);
+        instance.Transform(m);
+
+        all.AddPath(instance);
+    }
+
+    DrawPath( all, fillStyle );
+}
+
+void
+wxGraphicsContext::DoDrawTexts(size_t n,
+                               const wxString* strings,
+                               const wxPoint2DDouble* positions)
+{
+    wxCHECK_RET( !n || (strings && positions),
+                 wxS("Strings and positions must be specified") );
+
+    for ( size_t i = 0; i < n; ++i )
+        DoDrawText(strings[i], positions[i].m_x, positions[i].m_y);
+}
+
 void
 wxGraphicsContext::DoDrawRotatedText(const wxString &str,
                                      wxDouble x,
@@ -797,6 +837,20 @@ void wxGraphicsContext::DrawRectangle( wxDouble x, wxDouble y, wxDouble w, wxDou
     DrawPath( path );
 }
 
+void wxGraphicsContext::DrawRectangles( size_t n, const wxRect2DDouble *rects )
+{
+    wxCHECK_RET( !n || rects, wxS("Rectangles must be specified") );
+
+    if ( !n )
+        return;
+
+    wxGraphicsPath path = CreatePath();
+    for ( size_t i = 0; i < n; ++i )
+        path.AddRectangle(rects[i].m_x, rects[i].m_y,
+                          rects[i].m_width, rects[i].m_height);
+    DrawPath( path, wxWINDING_RULE );
+}
+
 void wxGraphicsContext::ClearRectangle( wxDouble WXUNUSED(x), wxDouble WXUNUSED(y), wxDouble WXUNUSED(w), wxDouble WXUNUSED(h))
 {
 
@@ -809,6 +863,36 @@ void wxGraphicsContext::DrawEllipse( wxDouble x, wxDouble y, wxDouble w, wxDoubl
     DrawPath(path);
 }
 
+void wxGraphicsContext::DrawEllipses( size_t n, const wxRect2DDouble *rects )
+{
+    wxCHECK_RET( !n || rects, wxS("Rectangles must be specified") );
+
+    if ( !n )
+        return;
+
+    wxGraphicsPath path = CreatePath();
+    for ( size_t i = 0; i < n; ++i )
+        path.AddEllipse(rects[i].m_x, rects[i].m_y,
+                        rects[i].m_width, rects[i].m_height);
+    DrawPath( path, wxWINDING_RULE );
+}
+
+void wxGraphicsContext::DrawBitmaps( const wxGraphicsBitmap &bmp,
+                                     const wxRect2DDouble& rect,
+                                     size_t n,
+                                     const wxGraphicsMatrix *transforms )
+{
+    wxCHECK_RET( !n || transforms, wxS("Transforms must be specified") );
+
+    for ( size_t i = 0; i < n; ++i )
+    {
+        PushState();
+        ConcatTransform(transforms[i]);
+        DrawBitmap(bmp, rect);
+        PopState();
+    }
+}
+
 void wxGraphicsContext::DrawRoundedRectangle( wxDouble x, wxDouble y, wxDouble w, wxDouble h, wxDouble radius)
 {
     wxGraphicsPath path = CreatePath();
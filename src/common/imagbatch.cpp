@@ -0,0 +1,343 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        src/common/imagbatch.cpp
+// Purpose:     wxImageBatchLoader implementation
+// Author:      wxWidgets team
+// Created:     2026-10-17
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+// For compilers that support precompilation, includes "wx.h".
+#include "wx/wxprec.h"
+
+#if wxUSE_IMAGE && wxUSE_STREAMS && wxUSE_THREADS
+
+#include "wx/imagbatch.h"
+
+#ifndef WX_PRECOMP
+    #include "wx/arrstr.h"
+#endif
+
+#include "wx/stream.h"
+#include "wx/thread.h"
+
+#include "wx/private/parallel.h"
+
+#include <vector>
+
+wxDEFINE_EVENT(wxEVT_IMAGE_BATCH_LOADED, wxImageBatchEvent);
+wxDEFINE_EVENT(wxEVT_IMAGE_BATCH_DONE, wxImageBatchEvent);
+
+// ============================================================================
+// wxImageBatchLoaderImpl
+// ============================================================================
+
+// Note that loading images from different threads is safe as long as each of
+// them uses its own wxImage objects and the handlers are not added or removed
+// while doing it: the handlers don't have any state used during loading and
+// all of them, including the ones using third party libraries, can be used
+// concurrently.
+class wxImageBatchLoaderImpl
+{
+public:
+    wxImageBatchLoaderImpl(wxEvtHandler* handler, unsigned int maxThreads)
+        : m_handler(handler),
+          m_maxThreads(maxThreads)
+    {
+    }
+
+    ~wxImageBatchLoaderImpl()
+    {
+        for ( const auto& item : m_items )
+            delete item.stream;
+    }
+
+    struct Item
+    {
+        wxString filename;
+        wxInputStream* stream;
+        wxBitmapType type;
+        wxImage image;
+    };
+
+    // Return false if there are no more items to load, otherwise fill in the
+    // index of the next one.
+    bool GetNextItem(size_t& n)
+    {
+        wxCriticalSectionLocker lock(m_cs);
+
+        if ( m_cancelled || m_next == m_items.size() )
+            return false;
+
+        n = m_next++;
+        return true;
+    }
+
+    // Called from the worker threads to load the given item.
+    void LoadItem(size_t n);
+
+    // Called from the worker threads when they don't have anything more to do.
+    void OnWorkerDone();
+
+    wxEvtHandler* const m_handler;
+    const unsigned int m_maxThreads;
+
+    // Items can only be added when the loader is not running, so there is no
+    // need to protect this vector itself, but only the indices below.
+    std::vector<Item> m_items;
+
+    wxArrayString m_optionNames,
+                  m_optionValues;
+
+    std::vector< std::unique_ptr<wxThread> > m_threads;
+
+    // Protects all the fields below.
+    wxCriticalSection m_cs;
+
+    // Index of the next item to load.
+    size_t m_next = 0;
+
+    // Number of threads which are still running.
+    size_t m_numRunning = 0;
+
+    bool m_cancelled = false;
+};
+
+namespace
+{
+
+class wxImageBatchLoaderThread : public wxThread
+{
+public:
+    explicit wxImageBatchLoaderThread(wxImageBatchLoaderImpl& impl)
+        : wxThread(wxTHREAD_JOINABLE),
+          m_impl(impl)
+    {
+    }
+
+protected:
+    virtual ExitCode Entry() override
+    {
+        size_t n;
+        while ( m_impl.GetNextItem(n) )
+            m_impl.LoadItem(n);
+
+        m_impl.OnWorkerDone();
+
+        return nullptr;
+    }
+
+private:
+    wxImageBatchLoaderImpl& m_impl;
+};
+
+} // anonymous namespace
+
+void wxImageBatchLoaderImpl::LoadItem(size_t n)
+{
+    Item& item = m_items[n];
+
+    wxImage image;
+    for ( size_t i = 0; i < m_optionNames.size(); i++ )
+        image.SetOption(m_optionNames[i], m_optionValues[i]);
+
+    bool ok;
+    if ( item.stream )
+    {
+        ok = image.LoadFile(*item.stream, item.type);
+
+        wxDELETE(item.stream);
+    }
+    else
+    {
+        ok = image.LoadFile(item.filename, item.type);
+    }
+
+    if ( !ok )
+        image = wxImage();
+
+    if ( m_handler )
+    {
+        // Note that wxImage reference count is not thread-safe, so we must
+        // not keep any references to the image in this thread once it's sent
+        // to the main one.
+        wxImageBatchEvent* const
+            event = new wxImageBatchEvent(wxEVT_IMAGE_BATCH_LOADED, n,
+                                          item.filename, image);
+        image = wxImage();
+
+        wxQueueEvent(m_handler, event);
+    }
+    else
+    {
+        item.image = image;
+    }
+}
+
+void wxImageBatchLoaderImpl::OnWorkerDone()
+{
+    bool cancelled;
+    {
+        wxCriticalSectionLocker lock(m_cs);
+
+        if ( --m_numRunning )
+            return;
+
+        cancelled = m_cancelled;
+    }
+
+    if ( m_handler )
+    {
+        wxQueueEvent(m_handler,
+                     new wxImageBatchEvent(wxEVT_IMAGE_BATCH_DONE, 0,
+                                           wxString(), wxImage(), cancelled));
+    }
+}
+
+// ============================================================================
+// wxImageBatchLoader
+// ============================================================================
+
+wxImageBatchLoader::wxImageBatchLoader(wxEvtHandler* handler,
+                                       unsigned int maxThreads)
+    : m_impl(new wxImageBatchLoaderImpl(handler, maxThreads))
+{
+}
+
+wxImageBatchLoader::~wxImageBatchLoader()
+{
+    Cancel();
+    Wait();
+}
+
+size_t wxImageBatchLoader::AddFile(const wxString& filename, wxBitmapType type)
+{
+    wxASSERT_MSG( !IsRunning(), "can't add images while loading" );
+
+    m_impl->m_items.push_back({filename, nullptr, type, wxImage()});
+
+    return m_impl->m_items.size() - 1;
+}
+
+size_t wxImageBatchLoader::AddStream(wxInputStream* stream, wxBitmapType type)
+{
+    wxASSERT_MSG( stream, "null stream" );
+    wxASSERT_MSG( !IsRunning(), "can't add images while loading" );
+
+    m_impl->m_items.push_back({wxString(), stream, type, wxImage()});
+
+    return m_impl->m_items.size() - 1;
+}
+
+size_t wxImageBatchLoader::GetCount() const
+{
+    return m_impl->m_items.size();
+}
+
+void wxImageBatchLoader::SetOption(const wxString& name, const wxString& value)
+{
+    wxCHECK_RET( !IsRunning(), "can't change options while loading" );
+
+    const int idx = m_impl->m_optionNames.Index(name, false);
+    if ( idx == wxNOT_FOUND )
+    {
+        m_impl->m_optionNames.Add(name);
+        m_impl->m_optionValues.Add(value);
+    }
+    else
+    {
+        m_impl->m_optionValues[idx] = value;
+    }
+}
+
+void wxImageBatchLoader::SetOption(const wxString& name, int value)
+{
+    SetOption(name, wxString::Format(wxS("%d"), value));
+}
+
+bool wxImageBatchLoader::Start()
+{
+    wxCHECK_MSG( !IsRunning(), false, "already running" );
+
+    // Join the threads used previously, if any.
+    Wait();
+
+    size_t numThreads = wxGetParallelThreadsCount(m_impl->m_maxThreads);
+    {
+        wxCriticalSectionLocker lock(m_impl->m_cs);
+
+        m_impl->m_cancelled = false;
+
+        const size_t numItems = m_impl->m_items.size() - m_impl->m_next;
+        if ( numThreads > numItems )
+            numThreads = numItems;
+
+        // Set it before starting any threads to ensure that the last one
+        // finishing, and not the first one, sends the notification.
+        m_impl->m_numRunning = numThreads;
+    }
+
+    if ( !numThreads )
+    {
+        // Nothing to do, but still notify about it to be consistent.
+        if ( m_impl->m_handler )
+        {
+            wxQueueEvent(m_impl->m_handler,
+                         new wxImageBatchEvent(wxEVT_IMAGE_BATCH_DONE));
+        }
+
+        return true;
+    }
+
+    for ( size_t n = 0; n < numThreads; n++ )
+    {
+        std::unique_ptr<wxThread> thread(new wxImageBatchLoaderThread(*m_impl));
+        if ( thread->Create() != wxTHREAD_NO_ERROR ||
+                thread->Run() != wxTHREAD_NO_ERROR )
+        {
+            // Don't wait for this thread, but notice that if no threads
+            // could be launched at all, this will send the notification
+            // immediately.
+            m_impl->OnWorkerDone();
+            continue;
+        }
+
+        m_impl->m_threads.push_back(std::move(thread));
+    }
+
+    return !m_impl->m_threads.empty();
+}
+
+void wxImageBatchLoader::Cancel()
+{
+    wxCriticalSectionLocker lock(m_impl->m_cs);
+
+    m_impl->m_cancelled = true;
+}
+
+void wxImageBatchLoader::Wait()
+{
+    for ( const auto& thread : m_impl->m_threads )
+        thread->Wait();
+
+    m_impl->m_threads.clear();
+}
+
+bool wxImageBatchLoader::IsRunning() const
+{
+    wxCriticalSectionLocker lock(m_impl->m_cs);
+
+    return m_impl->m_numRunning != 0;
+}
+
+const wxImage& wxImageBatchLoader::GetImage(size_t n) const
+{
+    wxCHECK_MSG( !m_impl->m_handler, wxNullImage,
+                 "images are sent to the handler and not stored" );
+    wxCHECK_MSG( !IsRunning(), wxNullImage, "still loading" );
+    wxCHECK_MSG( n < m_impl->m_items.size(), wxNullImage, "invalid index" );
+
+    return m_impl->m_items[n].image;
+}
+
+#endif // wxUSE_IMAGE && wxUSE_STREAMS && wxUSE_THREADS
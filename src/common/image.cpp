@@ -27,6 +27,9 @@
 #include "wx/wfstream.h"
 #include "wx/xpmdecod.h"
 
+#include "wx/private/parallel.h"
+#include "wx/private/simd.h"
+
 // For memcpy
 #include <string.h>
 
@@ -89,6 +92,9 @@ public:
     int             m_loadFlags;
     static int      sm_defaultLoadFlags;
 
+    // maximal number of threads used for processing images
+    static unsigned int sm_maxThreads;
+
 #if wxUSE_PALETTE
     wxPalette       m_palette;
 #endif // wxUSE_PALETTE
@@ -102,6 +108,9 @@ public:
 // For compatibility, if nothing else, loading is verbose by default.
 int wxImageRefData::sm_defaultLoadFlags = wxImage::Load_Verbose;
 
+// Don't use any extra threads by default.
+unsigned int wxImageRefData::sm_maxThreads = 1;
+
 wxImageRefData::wxImageRefData()
 {
     m_width = 0;
@@ -507,6 +516,14 @@ wxImage::Scale( int width, int height, wxImageResizeQuality quality ) const
             image = ResampleBox(width, height);
             break;
 
+        case wxIMAGE_QUALITY_LANCZOS3:
+            image = ResampleLanczos3(width, height);
+            break;
+
+        case wxIMAGE_QUALITY_MITCHELL:
+            image = ResampleMitchell(width, height);
+            break;
+
         case wxIMAGE_QUALITY_HIGH:
             image = width < old_width && height < old_height
                         ? ResampleBox(width, height)
@@ -533,6 +550,24 @@ wxImage::Scale( int width, int height, wxImageResizeQuality quality ) const
     return image;
 }
 
+namespace
+{
+
+// Call the given function for the bands of rows of the image of the given
+// size, possibly in parallel, depending on wxImage::SetMaxThreads().
+template <typename F>
+void ForRowBands(int width, int height, const F& func)
+{
+    // Don't use threads for bands with fewer pixels than this, the overhead
+    // of creating a thread would outweigh any gains.
+    static const int MIN_PIXELS_PER_BAND = 65536;
+
+    wxParallelForBands(height, wxImage::GetMaxThreads(),
+                       wxMax(1, MIN_PIXELS_PER_BAND / width), func);
+}
+
+} // anonymous namespace
+
 wxImage wxImage::ResampleNearest(int width, int height) const
 {
     wxImage image;
@@ -577,30 +612,35 @@ wxImage wxImage::ResampleNearest(int width, int height) const
     const wxUIntPtr x_delta = (old_width  << 16) / width;
     const wxUIntPtr y_delta = (old_height << 16) / height;
 
-    unsigned char* dest_pixel = target_data;
-
-    wxUIntPtr y = y_delta / 2;
-    for (int j = 0; j < height; j++)
+    ForRowBands(width, height, [=](int yStart, int yEnd)
     {
-        const unsigned char* src_line = &source_data[(y>>16)*old_width*3];
-        const unsigned char* src_alpha_line = source_alpha ? &source_alpha[(y>>16)*old_width] : nullptr ;
+        unsigned char* dest_pixel = target_data + yStart * width * 3;
+        unsigned char* dest_alpha = source_alpha ? target_alpha + yStart * width
+                                                 : nullptr;
 
-        wxUIntPtr x = x_delta / 2;
-        for (int i = 0; i < width; i++)
+        wxUIntPtr y = y_delta / 2 + yStart * y_delta;
+        for (int j = yStart; j < yEnd; j++)
         {
-            const unsigned char* src_pixel = &src_line[(x>>16)*3];
-            const unsigned char* src_alpha_pixel = source_alpha ? &src_alpha_line[(x>>16)] : nullptr ;
-            dest_pixel[0] = src_pixel[0];
-            dest_pixel[1] = src_pixel[1];
-            dest_pixel[2] = src_pixel[2];
-            dest_pixel += 3;
-            if ( source_alpha )
-                *(target_alpha++) = *src_alpha_pixel ;
-            x += x_delta;
-        }
+            const unsigned char* src_line = &source_data[(y>>16)*old_width*3];
+            const unsigned char* src_alpha_line = source_alpha ? &source_alpha[(y>>16)*old_width] : nullptr ;
 
-        y += y_delta;
-    }
+            wxUIntPtr x = x_delta / 2;
+            for (int i = 0; i < width; i++)
+            {
+                const unsigned char* src_pixel = &src_line[(x>>16)*3];
+                const unsigned char* src_alpha_pixel = source_alpha ? &src_alpha_line[(x>>16)] : nullptr ;
+                dest_pixel[0] = src_pixel[0];
+                dest_pixel[1] = src_pixel[1];
+                dest_pixel[2] = src_pixel[2];
+                dest_pixel += 3;
+                if ( source_alpha )
+                    *(dest_alpha++) = *src_alpha_pixel ;
+                x += x_delta;
+            }
+
+            y += y_delta;
+        }
+    });
 
     return image;
 }
@@ -608,6 +648,193 @@ wxImage wxImage::ResampleNearest(int width, int height) const
 namespace
 {
 
+// ----------------------------------------------------------------------------
+// PixelAccum: vector of RGBA components used by the resampling functions
+// ----------------------------------------------------------------------------
+
+// This class holds the red, green, blue and alpha components of a pixel as
+// doubles and performs the same arithmetic operation on all of them at once,
+// using SIMD instructions if available.
+//
+// Each of the operations is exactly the same as the one done by scalar code
+// for each component separately, so the results are identical to what they
+// would be without SIMD (as long as the compiler doesn't fuse multiplications
+// and additions in the scalar code, which it doesn't do by default on x86).
+#if defined(wxHAS_SSE2)
+
+class PixelAccum
+{
+public:
+    PixelAccum() : m_rg(_mm_setzero_pd()), m_ba(_mm_setzero_pd()) { }
+
+    // Load the colour components from the given RGB triplet and use the
+    // provided value for the last component.
+    PixelAccum(const unsigned char* rgb, unsigned char a)
+    {
+        m_rg = _mm_setr_pd(rgb[0], rgb[1]);
+        m_ba = _mm_setr_pd(rgb[2], a);
+    }
+
+    PixelAccum operator+(const PixelAccum& other) const
+    {
+        return PixelAccum(_mm_add_pd(m_rg, other.m_rg),
+                          _mm_add_pd(m_ba, other.m_ba));
+    }
+
+    PixelAccum operator+(double d) const
+    {
+        const __m128d v = _mm_set1_pd(d);
+        return PixelAccum(_mm_add_pd(m_rg, v), _mm_add_pd(m_ba, v));
+    }
+
+    PixelAccum operator*(double d) const
+    {
+        const __m128d v = _mm_set1_pd(d);
+        return PixelAccum(_mm_mul_pd(m_rg, v), _mm_mul_pd(m_ba, v));
+    }
+
+    PixelAccum& operator+=(const PixelAccum& other)
+    {
+        m_rg = _mm_add_pd(m_rg, other.m_rg);
+        m_ba = _mm_add_pd(m_ba, other.m_ba);
+        return *this;
+    }
+
+    // Store the components in the given array in R, G, B, A order.
+    void Store(double* out) const
+    {
+        _mm_storeu_pd(out, m_rg);
+        _mm_storeu_pd(out + 2, m_ba);
+    }
+
+private:
+    PixelAccum(__m128d rg, __m128d ba) : m_rg(rg), m_ba(ba) { }
+
+    __m128d m_rg,
+            m_ba;
+};
+
+#elif defined(wxHAS_NEON)
+
+class PixelAccum
+{
+public:
+    PixelAccum() : m_rg(vdupq_n_f64(0)), m_ba(vdupq_n_f64(0)) { }
+
+    PixelAccum(const unsigned char* rgb, unsigned char a)
+    {
+        const double rg[2] = { double(rgb[0]), double(rgb[1]) };
+        const double ba[2] = { double(rgb[2]), double(a) };
+        m_rg = vld1q_f64(rg);
+        m_ba = vld1q_f64(ba);
+    }
+
+    PixelAccum operator+(const PixelAccum& other) const
+    {
+        return PixelAccum(vaddq_f64(m_rg, other.m_rg),
+                          vaddq_f64(m_ba, other.m_ba));
+    }
+
+    PixelAccum operator+(double d) const
+    {
+        const float64x2_t v = vdupq_n_f64(d);
+        return PixelAccum(vaddq_f64(m_rg, v), vaddq_f64(m_ba, v));
+    }
+
+    PixelAccum operator*(double d) const
+    {
+        const float64x2_t v = vdupq_n_f64(d);
+        return PixelAccum(vmulq_f64(m_rg, v), vmulq_f64(m_ba, v));
+    }
+
+    PixelAccum& operator+=(const PixelAccum& other)
+    {
+        m_rg = vaddq_f64(m_rg, other.m_rg);
+        m_ba = vaddq_f64(m_ba, other.m_ba);
+        return *this;
+    }
+
+    void Store(double* out) const
+    {
+        vst1q_f64(out, m_rg);
+        vst1q_f64(out + 2, m_ba);
+    }
+
+private:
+    PixelAccum(float64x2_t rg, float64x2_t ba) : m_rg(rg), m_ba(ba) { }
+
+    float64x2_t m_rg,
+                m_ba;
+};
+
+#else // !wxHAS_SSE2 && !wxHAS_NEON
+
+class PixelAccum
+{
+public:
+    PixelAccum() : m_r(0), m_g(0), m_b(0), m_a(0) { }
+
+    PixelAccum(const unsigned char* rgb, unsigned char a)
+        : m_r(rgb[0]), m_g(rgb[1]), m_b(rgb[2]), m_a(a)
+    {
+    }
+
+    PixelAccum operator+(const PixelAccum& other) const
+    {
+        return PixelAccum(m_r + other.m_r, m_g + other.m_g,
+                          m_b + other.m_b, m_a + other.m_a);
+    }
+
+    PixelAccum operator+(double d) const
+    {
+        return PixelAccum(m_r + d, m_g + d, m_b + d, m_a + d);
+    }
+
+    PixelAccum operator*(double d) const
+    {
+        return PixelAccum(m_r * d, m_g * d, m_b * d, m_a * d);
+    }
+
+    PixelAccum& operator+=(const PixelAccum& other)
+    {
+        m_r += other.m_r;
+        m_g += other.m_g;
+        m_b += other.m_b;
+        m_a += other.m_a;
+        return *this;
+    }
+
+    void Store(double* out) const
+    {
+        out[0] = m_r;
+        out[1] = m_g;
+        out[2] = m_b;
+        out[3] = m_a;
+    }
+
+private:
+    PixelAccum(double r, double g, double b, double a)
+        : m_r(r), m_g(g), m_b(b), m_a(a)
+    {
+    }
+
+    double m_r, m_g, m_b, m_a;
+};
+
+#endif // SIMD kind
+
+// Source and destination data used by the resampling functions below.
+struct ResampleData
+{
+    const unsigned char* srcData;
+    const unsigned char* srcAlpha;
+    int srcWidth;
+
+    unsigned char* dstData;
+    unsigned char* dstAlpha;
+    int dstWidth;
+};
+
 struct BoxPrecalc
 {
     int boxStart;
@@ -657,88 +884,67 @@ void ResampleBoxPrecalc(wxVector<BoxPrecalc>& boxes, int oldDim)
     }
 }
 
-} // anonymous namespace
-
-wxImage wxImage::ResampleBox(int width, int height) const
+// Compute the rows in [yStart, yEnd) range of the image resampled using box
+// averaging.
+template <bool hasAlpha>
+void ResampleBoxRows(const ResampleData& rd,
+                     const wxVector<BoxPrecalc>& vPrecalcs,
+                     const wxVector<BoxPrecalc>& hPrecalcs,
+                     int yStart, int yEnd)
 {
-    wxCHECK_MSG( IsOk(), {}, "invalid image" );
-
-    // This function implements a simple pre-blur/box averaging method for
-    // downsampling that gives reasonably smooth results To scale the image
-    // down we will need to gather a grid of pixels of the size of the scale
-    // factor in each direction and then do an averaging of the pixels.
-
-    wxImage ret_image(width, height, false);
-
-    wxVector<BoxPrecalc> vPrecalcs(height);
-    wxVector<BoxPrecalc> hPrecalcs(width);
-
-    ResampleBoxPrecalc(vPrecalcs, M_IMGDATA->m_height);
-    ResampleBoxPrecalc(hPrecalcs, M_IMGDATA->m_width);
-
-
-    const unsigned char* src_data = M_IMGDATA->m_data;
-    const unsigned char* src_alpha = M_IMGDATA->m_alpha;
-    unsigned char* dst_data = ret_image.GetData();
-    unsigned char* dst_alpha = nullptr;
-
-    wxCHECK_MSG( dst_data, ret_image, wxS("unable to create image") );
-
-    if ( src_alpha )
-    {
-        ret_image.SetAlpha();
-        dst_alpha = ret_image.GetAlpha();
-    }
+    unsigned char* dst_data = rd.dstData + yStart * rd.dstWidth * 3;
+    unsigned char* dst_alpha = hasAlpha ? rd.dstAlpha + yStart * rd.dstWidth
+                                        : nullptr;
 
-    int averaged_pixels, src_pixel_index;
-    double sum_r, sum_g, sum_b, sum_a;
-
-    for ( int y = 0; y < height; y++ )         // Destination image - Y direction
+    for ( int y = yStart; y < yEnd; y++ )      // Destination image - Y direction
     {
         // Source pixel in the Y direction
         const BoxPrecalc& vPrecalc = vPrecalcs[y];
 
-        for ( int x = 0; x < width; x++ )      // Destination image - X direction
+        for ( int x = 0; x < rd.dstWidth; x++ ) // Destination image - X direction
         {
             // Source pixel in the X direction
             const BoxPrecalc& hPrecalc = hPrecalcs[x];
 
             // Box of pixels to average
-            averaged_pixels = (vPrecalc.boxEnd - vPrecalc.boxStart + 1)
+            const int averaged_pixels = (vPrecalc.boxEnd - vPrecalc.boxStart + 1)
                                 * (hPrecalc.boxEnd - hPrecalc.boxStart + 1);
-            sum_r = sum_g = sum_b = sum_a = 0.0;
+
+            // Sums of all channels: when using alpha, the colour components
+            // are weighted by it and the last one is the sum of alpha values.
+            PixelAccum sum;
 
             for ( int j = vPrecalc.boxStart; j <= vPrecalc.boxEnd; ++j )
             {
+                // Calculate the actual index in our source pixels
+                int src_pixel_index = j * rd.srcWidth + hPrecalc.boxStart;
+
                 for ( int i = hPrecalc.boxStart; i <= hPrecalc.boxEnd; ++i )
                 {
-                    // Calculate the actual index in our source pixels
-                    src_pixel_index = j * M_IMGDATA->m_width + i;
+                    const unsigned char* const
+                        src_pixel = rd.srcData + src_pixel_index * 3;
 
-                    if (src_alpha)
-                    {
-                        sum_r += src_data[src_pixel_index * 3 + 0] * src_alpha[src_pixel_index];
-                        sum_g += src_data[src_pixel_index * 3 + 1] * src_alpha[src_pixel_index];
-                        sum_b += src_data[src_pixel_index * 3 + 2] * src_alpha[src_pixel_index];
-                        sum_a += src_alpha[src_pixel_index];
-                    }
+                    if ( hasAlpha )
+                        sum += PixelAccum(src_pixel, 1) * rd.srcAlpha[src_pixel_index];
                     else
-                    {
-                        sum_r += src_data[src_pixel_index * 3 + 0];
-                        sum_g += src_data[src_pixel_index * 3 + 1];
-                        sum_b += src_data[src_pixel_index * 3 + 2];
-                    }
+                        sum += PixelAccum(src_pixel, 0);
+
+                    src_pixel_index++;
                 }
             }
 
+            double sums[4];
+            sum.Store(sums);
+
             // Calculate the average from the sum and number of averaged pixels
-            if (src_alpha)
+            if ( hasAlpha )
             {
+                const double sum_a = sums[3];
                 if (sum_a != 0)
                 {
-                    dst_data[0] = (unsigned char)(sum_r / sum_a);
-                    dst_data[1] = (unsigned char)(sum_g / sum_a);
-                    dst_data[2] = (unsigned char)(sum_b / sum_a);
+                    dst_data[0] = (unsigned char)(sums[0] / sum_a);
+                    dst_data[1] = (unsigned char)(sums[1] / sum_a);
+                    dst_data[2] = (unsigned char)(sums[2] / sum_a);
                 }
                 else
                 {
@@ -750,13 +956,58 @@ wxImage wxImage::ResampleBox(int width, int height) const
             }
             else
             {
-                dst_data[0] = (unsigned char)(sum_r / averaged_pixels);
-                dst_data[1] = (unsigned char)(sum_g / averaged_pixels);
-                dst_data[2] = (unsigned char)(sum_b / averaged_pixels);
+                dst_data[0] = (unsigned char)(sums[0] / averaged_pixels);
+                dst_data[1] = (unsigned char)(sums[1] / averaged_pixels);
+                dst_data[2] = (unsigned char)(sums[2] / averaged_pixels);
             }
             dst_data += 3;
         }
     }
+}
+
+} // anonymous namespace
+
+wxImage wxImage::ResampleBox(int width, int height) const
+{
+    wxCHECK_MSG( IsOk(), {}, "invalid image" );
+
+    // This function implements a simple pre-blur/box averaging method for
+    // downsampling that gives reasonably smooth results To scale the image
+    // down we will need to gather a grid of pixels of the size of the scale
+    // factor in each direction and then do an averaging of the pixels.
+
+    wxImage ret_image(width, height, false);
+
+    wxVector<BoxPrecalc> vPrecalcs(height);
+    wxVector<BoxPrecalc> hPrecalcs(width);
+
+    ResampleBoxPrecalc(vPrecalcs, M_IMGDATA->m_height);
+    ResampleBoxPrecalc(hPrecalcs, M_IMGDATA->m_width);
+
+
+    const unsigned char* src_data = M_IMGDATA->m_data;
+    const unsigned char* src_alpha = M_IMGDATA->m_alpha;
+    unsigned char* dst_data = ret_image.GetData();
+    unsigned char* dst_alpha = nullptr;
+
+    wxCHECK_MSG( dst_data, ret_image, wxS("unable to create image") );
+
+    if ( src_alpha )
+    {
+        ret_image.SetAlpha();
+        dst_alpha = ret_image.GetAlpha();
+    }
+
+    const ResampleData
+        rd = { src_data, src_alpha, M_IMGDATA->m_width, dst_data, dst_alpha, width };
+
+    ForRowBands(width, height, [&](int yStart, int yEnd)
+    {
+        if ( src_alpha )
+            ResampleBoxRows<true>(rd, vPrecalcs, hPrecalcs, yStart, yEnd);
+        else
+            ResampleBoxRows<false>(rd, vPrecalcs, hPrecalcs, yStart, yEnd);
+    });
 
     return ret_image;
 }
@@ -819,38 +1070,19 @@ void ResampleBilinearPrecalc(wxVector<BilinearPrecalc>& precalcs, int oldDim)
     }
 }
 
-} // anonymous namespace
-
-wxImage wxImage::ResampleBilinear(int width, int height) const
+// Compute the rows in [yStart, yEnd) range of the image resampled using
+// bilinear interpolation.
+template <bool hasAlpha>
+void ResampleBilinearRows(const ResampleData& rd,
+                          const wxVector<BilinearPrecalc>& vPrecalcs,
+                          const wxVector<BilinearPrecalc>& hPrecalcs,
+                          int yStart, int yEnd)
 {
-    wxCHECK_MSG( IsOk(), {}, "invalid image" );
-
-    // This function implements a Bilinear algorithm for resampling.
-    wxImage ret_image(width, height, false);
-    const unsigned char* src_data = M_IMGDATA->m_data;
-    const unsigned char* src_alpha = M_IMGDATA->m_alpha;
-    unsigned char* dst_data = ret_image.GetData();
-    unsigned char* dst_alpha = nullptr;
-
-    wxCHECK_MSG( dst_data, ret_image, wxS("unable to create image") );
+    unsigned char* dst_data = rd.dstData + yStart * rd.dstWidth * 3;
+    unsigned char* dst_alpha = hasAlpha ? rd.dstAlpha + yStart * rd.dstWidth
+                                        : nullptr;
 
-    if ( src_alpha )
-    {
-        ret_image.SetAlpha();
-        dst_alpha = ret_image.GetAlpha();
-    }
-
-    wxVector<BilinearPrecalc> vPrecalcs(height);
-    wxVector<BilinearPrecalc> hPrecalcs(width);
-    ResampleBilinearPrecalc(vPrecalcs, M_IMGDATA->m_height);
-    ResampleBilinearPrecalc(hPrecalcs, M_IMGDATA->m_width);
-
-    // initialize alpha values to avoid g++ warnings about possibly
-    // uninitialized variables
-    double r1, g1, b1, a1 = 0;
-    double r2, g2, b2, a2 = 0;
-
-    for ( int dsty = 0; dsty < height; dsty++ )
+    for ( int dsty = yStart; dsty < yEnd; dsty++ )
     {
         // We need to calculate the source pixel to interpolate from - Y-axis
         const BilinearPrecalc& vPrecalc = vPrecalcs[dsty];
@@ -860,7 +1092,7 @@ wxImage wxImage::ResampleBilinear(int width, int height) const
         const double dy1 = vPrecalc.dd1;
 
 
-        for ( int dstx = 0; dstx < width; dstx++ )
+        for ( int dstx = 0; dstx < rd.dstWidth; dstx++ )
         {
             // X-axis of pixel to interpolate from
             const BilinearPrecalc& hPrecalc = hPrecalcs[dstx];
@@ -870,36 +1102,78 @@ wxImage wxImage::ResampleBilinear(int width, int height) const
             const double dx = hPrecalc.dd;
             const double dx1 = hPrecalc.dd1;
 
-            int src_pixel_index00 = y_offset1 * M_IMGDATA->m_width + x_offset1;
-            int src_pixel_index01 = y_offset1 * M_IMGDATA->m_width + x_offset2;
-            int src_pixel_index10 = y_offset2 * M_IMGDATA->m_width + x_offset1;
-            int src_pixel_index11 = y_offset2 * M_IMGDATA->m_width + x_offset2;
+            int src_pixel_index00 = y_offset1 * rd.srcWidth + x_offset1;
+            int src_pixel_index01 = y_offset1 * rd.srcWidth + x_offset2;
+            int src_pixel_index10 = y_offset2 * rd.srcWidth + x_offset1;
+            int src_pixel_index11 = y_offset2 * rd.srcWidth + x_offset2;
+
+            // Alpha is interpolated in the same way as the colour components,
+            // so just use 0 for it if we don't have it and ignore the result.
+            const unsigned char* const src_data = rd.srcData;
+            const unsigned char* const src_alpha = rd.srcAlpha;
+            const PixelAccum
+                p00(src_data + src_pixel_index00 * 3, hasAlpha ? src_alpha[src_pixel_index00] : 0),
+                p01(src_data + src_pixel_index01 * 3, hasAlpha ? src_alpha[src_pixel_index01] : 0),
+                p10(src_data + src_pixel_index10 * 3, hasAlpha ? src_alpha[src_pixel_index10] : 0),
+                p11(src_data + src_pixel_index11 * 3, hasAlpha ? src_alpha[src_pixel_index11] : 0);
 
             // first line
-            r1 = src_data[src_pixel_index00 * 3 + 0] * dx1 + src_data[src_pixel_index01 * 3 + 0] * dx;
-            g1 = src_data[src_pixel_index00 * 3 + 1] * dx1 + src_data[src_pixel_index01 * 3 + 1] * dx;
-            b1 = src_data[src_pixel_index00 * 3 + 2] * dx1 + src_data[src_pixel_index01 * 3 + 2] * dx;
-            if ( src_alpha )
-                a1 = src_alpha[src_pixel_index00] * dx1 + src_alpha[src_pixel_index01] * dx;
+            const PixelAccum line1 = p00 * dx1 + p01 * dx;
 
             // second line
-            r2 = src_data[src_pixel_index10 * 3 + 0] * dx1 + src_data[src_pixel_index11 * 3 + 0] * dx;
-            g2 = src_data[src_pixel_index10 * 3 + 1] * dx1 + src_data[src_pixel_index11 * 3 + 1] * dx;
-            b2 = src_data[src_pixel_index10 * 3 + 2] * dx1 + src_data[src_pixel_index11 * 3 + 2] * dx;
-            if ( src_alpha )
-                a2 = src_alpha[src_pixel_index10] * dx1 + src_alpha[src_pixel_index11] * dx;
+            const PixelAccum line2 = p10 * dx1 + p11 * dx;
 
             // result lines
+            double result[4];
+            (line1 * dy1 + line2 * dy + .5).Store(result);
 
-            dst_data[0] = static_cast<unsigned char>(r1 * dy1 + r2 * dy + .5);
-            dst_data[1] = static_cast<unsigned char>(g1 * dy1 + g2 * dy + .5);
-            dst_data[2] = static_cast<unsigned char>(b1 * dy1 + b2 * dy + .5);
+            dst_data[0] = static_cast<unsigned char>(result[0]);
+            dst_data[1] = static_cast<unsigned char>(result[1]);
+            dst_data[2] = static_cast<unsigned char>(result[2]);
             dst_data += 3;
 
-            if ( src_alpha )
-                *dst_alpha++ = static_cast<unsigned char>(a1 * dy1 + a2 * dy +.5);
+            if ( hasAlpha )
+                *dst_alpha++ = static_cast<unsigned char>(result[3]);
         }
     }
+}
+
+} // anonymous namespace
+
+wxImage wxImage::ResampleBilinear(int width, int height) const
+{
+    wxCHECK_MSG( IsOk(), {}, "invalid image" );
+
+    // This function implements a Bilinear algorithm for resampling.
+    wxImage ret_image(width, height, false);
+    const unsigned char* src_data = M_IMGDATA->m_data;
+    const unsigned char* src_alpha = M_IMGDATA->m_alpha;
+    unsigned char* dst_data = ret_image.GetData();
+    unsigned char* dst_alpha = nullptr;
+
+    wxCHECK_MSG( dst_data, ret_image, wxS("unable to create image") );
+
+    if ( src_alpha )
+    {
+        ret_image.SetAlpha();
+        dst_alpha = ret_image.GetAlpha();
+    }
+
+    wxVector<BilinearPrecalc> vPrecalcs(height);
+    wxVector<BilinearPrecalc> hPrecalcs(width);
+    ResampleBilinearPrecalc(vPrecalcs, M_IMGDATA->m_height);
+    ResampleBilinearPrecalc(hPrecalcs, M_IMGDATA->m_width);
+
+    const ResampleData
+        rd = { src_data, src_alpha, M_IMGDATA->m_width, dst_data, dst_alpha, width };
+
+    ForRowBands(width, height, [&](int yStart, int yEnd)
+    {
+        if ( src_alpha )
+            ResampleBilinearRows<true>(rd, vPrecalcs, hPrecalcs, yStart, yEnd);
+        else
+            ResampleBilinearRows<false>(rd, vPrecalcs, hPrecalcs, yStart, yEnd);
+    });
 
     return ret_image;
 }
@@ -919,58 +1193,304 @@ static inline double spline_weight(double value)
             4 * spline_cube(value - 1)) / 6;
 }
 
+// Mitchell-Netravali cubic filter with the recommended B = C = 1/3 values.
+static double mitchell_weight(double value)
+{
+    const double x = fabs(value);
+    if ( x < 1 )
+        return (7*x*x*x - 12*x*x + 16./3) / 6;
+    if ( x < 2 )
+        return (-7./3*x*x*x + 12*x*x - 20*x + 32./3) / 6;
+
+    return 0;
+}
+
+// Lanczos filter with 3 lobes.
+static double lanczos3_weight(double value)
+{
+    const double x = fabs(value);
+    if ( x < 1e-8 )
+        return 1;
+    if ( x >= 3 )
+        return 0;
+
+    const double px = M_PI * x;
+    return 3 * sin(px) * sin(px / 3) / (px * px);
+}
+
 
 namespace
 {
 
-struct BicubicPrecalc
+// Weights used for resampling the image along one of its axes: each new pixel
+// n is computed as the sum of the old pixels with indices indices[n*taps + k]
+// multiplied by weights[n*taps + k] for all k in [0, taps) range.
+//
+// Note that the indices used for the same new pixel must be consecutive,
+// except for being clamped to the valid range at the image edges.
+struct ResampleWeights
 {
-    double weight[4];
-    int offset[4];
+    int taps = 0;
+    wxVector<int> indices;
+    wxVector<double> weights;
+
+    void Init(int newDim, int taps_)
+    {
+        taps = taps_;
+        indices.resize(newDim * taps);
+        weights.resize(newDim * taps);
+    }
 };
 
-inline void DoCalc(BicubicPrecalc& precalc, double srcpixd, int oldDim)
+inline int ClampIndex(int index, int oldDim)
 {
-    const double dd = srcpixd - static_cast<int>(srcpixd);
+    return index < 0 ? 0 : index >= oldDim ? oldDim - 1 : index;
+}
+
+void ResampleBicubicPrecalc(ResampleWeights& precalc, int newDim, int oldDim)
+{
+    wxASSERT( oldDim > 0 && newDim > 0 );
 
-    for ( int k = -1; k <= 2; k++ )
+    precalc.Init(newDim, 4);
+
+    // We want to map pixels in the range [0..newDim-1] to the range
+    // [0..oldDim-1], except if there is just one new pixel, in which case
+    // we take the pixel from the center of the source image.
+    const double scale_factor = newDim > 1
+                                    ? static_cast<double>(oldDim-1) / (newDim-1)
+                                    : 0;
+
+    for ( int dstd = 0; dstd < newDim; dstd++ )
     {
-        precalc.offset[k + 1] = srcpixd + k < 0.0
-            ? 0
-            : srcpixd + k >= oldDim
-                ? oldDim - 1
-                : static_cast<int>(srcpixd + k);
+        const double srcpixd = newDim > 1
+                                ? static_cast<double>(dstd) * scale_factor
+                                : static_cast<double>(oldDim - 1) / 2.0;
+
+        const double dd = srcpixd - static_cast<int>(srcpixd);
 
-        precalc.weight[k + 1] = spline_weight(k - dd);
+        for ( int k = -1; k <= 2; k++ )
+        {
+            const int n = dstd*4 + k + 1;
+
+            precalc.indices[n] = srcpixd + k < 0.0
+                ? 0
+                : srcpixd + k >= oldDim
+                    ? oldDim - 1
+                    : static_cast<int>(srcpixd + k);
+
+            precalc.weights[n] = spline_weight(k - dd);
+        }
     }
 }
 
-void ResampleBicubicPrecalc(wxVector<BicubicPrecalc> &aWeight, int oldDim)
+// Compute the weights for the filter defined by the given function, which must
+// be 0 outside of [-support, support] interval.
+void ResampleFilterPrecalc(ResampleWeights& precalc, int newDim, int oldDim,
+                           double (*filter)(double), double support)
 {
-    const int newDim = aWeight.size();
     wxASSERT( oldDim > 0 && newDim > 0 );
 
-    if ( newDim > 1 )
+    // Unlike the bicubic algorithm, which just interpolates between the old
+    // pixels, here we consider the pixels to be squares, with the centre of
+    // the new pixel n being mapped to (n + 0.5)*scale - 0.5 in old pixel
+    // coordinates.
+    const double scale = static_cast<double>(oldDim) / newDim;
+
+    // When downscaling, stretch the filter to cover all the old pixels
+    // corresponding to the new one, which avoids aliasing.
+    const double filterScale = wxMax(scale, 1.0);
+    const double radius = support * filterScale;
+
+    const int taps = static_cast<int>(ceil(radius * 2)) + 1;
+    precalc.Init(newDim, taps);
+
+    for ( int dstd = 0; dstd < newDim; dstd++ )
     {
-        // We want to map pixels in the range [0..newDim-1]
-        // to the range [0..oldDim-1]
-        const double scale_factor = static_cast<double>(oldDim-1) / (newDim-1);
+        const double center = (dstd + 0.5) * scale - 0.5;
+        const int first = static_cast<int>(floor(center - radius));
 
-        for ( int dstd = 0; dstd < newDim; dstd++ )
+        const int n = dstd*taps;
+
+        double total = 0;
+        for ( int k = 0; k < taps; k++ )
         {
-            // We need to calculate the source pixel to interpolate from - Y-axis
-            const double srcpixd = static_cast<double>(dstd) * scale_factor;
+            const double w = filter((first + k - center) / filterScale);
+
+            precalc.indices[n + k] = ClampIndex(first + k, oldDim);
+            precalc.weights[n + k] = w;
 
-            DoCalc(aWeight[dstd], srcpixd, oldDim);
+            total += w;
+        }
+
+        // Normalize the weights to ensure that uniform areas are preserved.
+        if ( total != 0 )
+        {
+            for ( int k = 0; k < taps; k++ )
+                precalc.weights[n + k] /= total;
         }
     }
-    else
+}
+
+inline unsigned char ClampToByte(double value)
+{
+    return value <= 0 ? 0
+                      : value >= 255 ? 255
+                                     : static_cast<unsigned char>(value);
+}
+
+// Compute the rows in [yStart, yEnd) range of the image resampled using the
+// given weights.
+//
+// This is done in two passes: first each of the old rows used by the current
+// new row is resampled horizontally, then the new row is computed by combining
+// them. The horizontally resampled rows are kept in a ring buffer, as they are
+// typically used for several consecutive new rows.
+template <bool hasAlpha>
+void ResampleSeparableRows(const ResampleData& rd,
+                           const ResampleWeights& vWeights,
+                           const ResampleWeights& hWeights,
+                           int yStart, int yEnd)
+{
+    const int dstWidth = rd.dstWidth;
+
+    // When using alpha, the colour components of the rows are premultiplied
+    // by it and the last component is the alpha value itself.
+    const int numRows = vWeights.taps;
+    wxVector<PixelAccum> rows(numRows * dstWidth);
+    wxVector<int> rowIndices(numRows, -1);
+
+    // Sums of the rows contributing to the current new row.
+    wxVector<PixelAccum> sums(dstWidth);
+
+    const int hTaps = hWeights.taps;
+
+    unsigned char* dst_data = rd.dstData + yStart * dstWidth * 3;
+    unsigned char* dst_alpha = hasAlpha ? rd.dstAlpha + yStart * dstWidth
+                                        : nullptr;
+
+    for ( int dsty = yStart; dsty < yEnd; dsty++ )
     {
-        // Let's take the pixel from the center of the source image.
-        const double srcpixd = static_cast<double>(oldDim - 1) / 2.0;
+        for ( int x = 0; x < dstWidth; x++ )
+            sums[x] = PixelAccum();
 
-        DoCalc(aWeight[0], srcpixd, oldDim);
+        for ( int k = 0; k < numRows; k++ )
+        {
+            const int n = dsty*numRows + k;
+            const int srcy = vWeights.indices[n];
+            const double weight = vWeights.weights[n];
+
+            PixelAccum* const row = &rows[(srcy % numRows) * dstWidth];
+
+            // Resample this row horizontally if we don't have it yet.
+            if ( rowIndices[srcy % numRows] != srcy )
+            {
+                rowIndices[srcy % numRows] = srcy;
+
+                const unsigned char* const
+                    src_data = rd.srcData + srcy * rd.srcWidth * 3;
+                const unsigned char* const
+                    src_alpha = hasAlpha ? rd.srcAlpha + srcy * rd.srcWidth
+                                         : nullptr;
+
+                const int* indices = &hWeights.indices[0];
+                const double* weights = &hWeights.weights[0];
+                for ( int x = 0; x < dstWidth; x++ )
+                {
+                    PixelAccum sum;
+                    for ( int i = 0; i < hTaps; i++ )
+                    {
+                        const int srcx = indices[i];
+                        if ( hasAlpha )
+                        {
+                            sum += PixelAccum(src_data + srcx * 3, 1)
+                                    * weights[i] * src_alpha[srcx];
+                        }
+                        else
+                        {
+                            sum += PixelAccum(src_data + srcx * 3, 0)
+                                    * weights[i];
+                        }
+                    }
+
+                    row[x] = sum;
+
+                    indices += hTaps;
+                    weights += hTaps;
+                }
+            }
+
+            for ( int x = 0; x < dstWidth; x++ )
+                sums[x] += row[x] * weight;
+        }
+
+        for ( int x = 0; x < dstWidth; x++ )
+        {
+            double v[4];
+            sums[x].Store(v);
+
+            // Put the data into the destination image, rounding the values
+            // and clamping them, as the filters with negative lobes can
+            // result in the values outside of the valid range.
+            if ( hasAlpha )
+            {
+                const double a = v[3];
+                if ( a > 0 )
+                {
+                    dst_data[0] = ClampToByte(v[0] / a + 0.5);
+                    dst_data[1] = ClampToByte(v[1] / a + 0.5);
+                    dst_data[2] = ClampToByte(v[2] / a + 0.5);
+                }
+                else
+                {
+                    dst_data[0] = 0;
+                    dst_data[1] = 0;
+                    dst_data[2] = 0;
+                }
+                *dst_alpha++ = ClampToByte(a + 0.5);
+            }
+            else
+            {
+                dst_data[0] = ClampToByte(v[0] + 0.5);
+                dst_data[1] = ClampToByte(v[1] + 0.5);
+                dst_data[2] = ClampToByte(v[2] + 0.5);
+            }
+            dst_data += 3;
+        }
+    }
+}
+
+// Resample the given image using the provided weights.
+wxImage ResampleSeparable(const wxImage& image, int width, int height,
+                          const ResampleWeights& vWeights,
+                          const ResampleWeights& hWeights)
+{
+    wxImage ret_image(width, height, false);
+
+    const unsigned char* src_data = image.GetData();
+    const unsigned char* src_alpha = image.GetAlpha();
+    unsigned char* dst_data = ret_image.GetData();
+    unsigned char* dst_alpha = nullptr;
+
+    wxCHECK_MSG( dst_data, ret_image, wxS("unable to create image") );
+
+    if ( src_alpha )
+    {
+        ret_image.SetAlpha();
+        dst_alpha = ret_image.GetAlpha();
     }
+
+    const ResampleData
+        rd = { src_data, src_alpha, image.GetWidth(), dst_data, dst_alpha, width };
+
+    ForRowBands(width, height, [&](int yStart, int yEnd)
+    {
+        if ( src_alpha )
+            ResampleSeparableRows<true>(rd, vWeights, hWeights, yStart, yEnd);
+        else
+            ResampleSeparableRows<false>(rd, vWeights, hWeights, yStart, yEnd);
+    });
+
+    return ret_image;
 }
 
 } // anonymous namespace
@@ -992,6 +1512,10 @@ wxImage wxImage::ResampleBicubic(int width, int height) const
     // upsampling by large factors.  This is basically because a slight
     // gaussian blur is being performed to get the smooth look of the upsampled
     // image.
+    //
+    // As the B-Spline kernel is separable, the image is resampled in one
+    // direction and then in the other one, which requires much less
+    // computations than using the 4x4 kernel for each pixel directly.
 
     // Edge pixels: 3-4 possible solutions
     // - (Wrap/tile) Wrap the image, take the color value from the opposite
@@ -1006,214 +1530,242 @@ wxImage wxImage::ResampleBicubic(int width, int height) const
     // NOTE: below the y_offset and x_offset variables are being set for edge
     // pixels using the "Mirror" method mentioned above
 
-    wxImage ret_image;
+    // Precalculate weights
+    ResampleWeights vPrecalcs, hPrecalcs;
+    ResampleBicubicPrecalc(vPrecalcs, height, M_IMGDATA->m_height);
+    ResampleBicubicPrecalc(hPrecalcs, width, M_IMGDATA->m_width);
 
-    ret_image.Create(width, height, false);
+    return ResampleSeparable(*this, width, height, vPrecalcs, hPrecalcs);
+}
 
-    const unsigned char* src_data = M_IMGDATA->m_data;
-    const unsigned char* src_alpha = M_IMGDATA->m_alpha;
-    unsigned char* dst_data = ret_image.GetData();
-    unsigned char* dst_alpha = nullptr;
+wxImage wxImage::ResampleLanczos3(int width, int height) const
+{
+    wxCHECK_MSG( IsOk(), {}, "invalid image" );
 
-    wxCHECK_MSG( dst_data, ret_image, wxS("unable to create image") );
+    ResampleWeights vPrecalcs, hPrecalcs;
+    ResampleFilterPrecalc(vPrecalcs, height, M_IMGDATA->m_height, lanczos3_weight, 3);
+    ResampleFilterPrecalc(hPrecalcs, width, M_IMGDATA->m_width, lanczos3_weight, 3);
 
-    if ( src_alpha )
+    return ResampleSeparable(*this, width, height, vPrecalcs, hPrecalcs);
+}
+
+wxImage wxImage::ResampleMitchell(int width, int height) const
+{
+    wxCHECK_MSG( IsOk(), {}, "invalid image" );
+
+    ResampleWeights vPrecalcs, hPrecalcs;
+    ResampleFilterPrecalc(vPrecalcs, height, M_IMGDATA->m_height, mitchell_weight, 2);
+    ResampleFilterPrecalc(hPrecalcs, width, M_IMGDATA->m_width, mitchell_weight, 2);
+
+    return ResampleSeparable(*this, width, height, vPrecalcs, hPrecalcs);
+}
+
+namespace
+{
+
+// Helper dividing the sums of blurRadius*2 + 1 pixels by their number.
+//
+// Integer division is relatively slow and used for every component of every
+// pixel, so replace it with multiplication by the inverse in fixed point,
+// which gives exactly the same result for all the sums of up to 65535 bytes.
+class BoxDivider
+{
+public:
+    explicit BoxDivider(int area)
+        : m_area(area),
+          m_mul(area < 65536 ? ((wxUint64)1 << SHIFT) / area + 1 : 0)
     {
-        ret_image.SetAlpha();
-        dst_alpha = ret_image.GetAlpha();
     }
 
-    // Precalculate weights
-    wxVector<BicubicPrecalc> vPrecalcs(height);
-    wxVector<BicubicPrecalc> hPrecalcs(width);
+    unsigned char operator()(wxUint32 sum) const
+    {
+        return static_cast<unsigned char>(m_mul ? (sum * m_mul) >> SHIFT
+                                                : sum / m_area);
+    }
 
-    ResampleBicubicPrecalc(vPrecalcs, M_IMGDATA->m_height);
-    ResampleBicubicPrecalc(hPrecalcs, M_IMGDATA->m_width);
+private:
+    enum { SHIFT = 40 };
 
-    for ( int dsty = 0; dsty < height; dsty++ )
+    const wxUint32 m_area;
+    const wxUint64 m_mul;
+};
+
+// Blur a single row of width pixels consisting of N interleaved components.
+//
+// As with all the other functions here, the pixels beyond the image edge are
+// assumed to be the same as the pixels at the edge and bias is added to each
+// sum before dividing it, to allow rounding the results instead of truncating
+// them.
+template <int N>
+void BlurRow(const unsigned char* src, unsigned char* dst, int width,
+             int radius, wxUint32 bias, const BoxDivider& divide)
+{
+    const unsigned char* const last = src + (width - 1)*N;
+
+    // Note that the initial sum doesn't depend on the radius if it's greater
+    // than the width, as all the extra pixels are the same.
+    const int inside = wxMin(radius, width - 1);
+
+    wxUint32 sums[N];
+    for ( int c = 0; c < N; c++ )
     {
-        // We need to calculate the source pixel to interpolate from - Y-axis
-        const BicubicPrecalc& vPrecalc = vPrecalcs[dsty];
+        wxUint32 sum = bias + (radius + 1)*src[c] + (radius - inside)*last[c];
+        for ( int x = 1; x <= inside; x++ )
+            sum += src[x*N + c];
+
+        sums[c] = sum;
+    }
 
-        for ( int dstx = 0; dstx < width; dstx++ )
+    // Now slide the window along the row, without any branches in the loop.
+    for ( int x = 0; x < width; x++ )
+    {
+        const unsigned char* const add = src + wxMin(x + radius + 1, width - 1)*N;
+        const unsigned char* const sub = src + wxMax(x - radius, 0)*N;
+
+        for ( int c = 0; c < N; c++ )
         {
-            // X-axis of pixel to interpolate from
-            const BicubicPrecalc& hPrecalc = hPrecalcs[dstx];
+            *dst++ = divide(sums[c]);
 
-            // Sums for each color channel
-            double sum_r = 0, sum_g = 0, sum_b = 0, sum_a = 0;
+            sums[c] += add[c];
+            sums[c] -= sub[c];
+        }
+    }
+}
 
-            // Here we actually determine the RGBA values for the destination pixel
-            for ( int k = -1; k <= 2; k++ )
-            {
-                // Y offset
-                const int y_offset = vPrecalc.offset[k + 1];
+// Blur the columns of height rows, each of them containing count bytes and
+// starting stride bytes after the previous one.
+//
+// The image is processed row by row, keeping the sums for all the columns,
+// which is much more cache-friendly than processing one column at a time.
+void BlurColumns(const unsigned char* src, unsigned char* dst,
+                 int count, int stride, int height,
+                 int radius, wxUint32 bias, const BoxDivider& divide)
+{
+    const unsigned char* const last = src + (height - 1)*stride;
+    const int inside = wxMin(radius, height - 1);
 
-                // Loop across the X axis
-                for ( int i = -1; i <= 2; i++ )
-                {
-                    // X offset
-                    const int x_offset = hPrecalc.offset[i + 1];
-
-                    // Calculate the exact position where the source data
-                    // should be pulled from based on the x_offset and y_offset
-                    int src_pixel_index = y_offset*M_IMGDATA->m_width + x_offset;
-
-                    // Calculate the weight for the specified pixel according
-                    // to the bicubic b-spline kernel we're using for
-                    // interpolation
-                    const double
-                        pixel_weight = vPrecalc.weight[k + 1] * hPrecalc.weight[i + 1];
-
-                    // Create a sum of all values for each color channel
-                    // adjusted for the pixel's calculated weight
-                    if ( src_alpha )
-                    {
-                        const unsigned char a = src_alpha[src_pixel_index];
-                        sum_r += src_data[src_pixel_index * 3 + 0] * pixel_weight * a;
-                        sum_g += src_data[src_pixel_index * 3 + 1] * pixel_weight * a;
-                        sum_b += src_data[src_pixel_index * 3 + 2] * pixel_weight * a;
-                        sum_a += a * pixel_weight;
-                    }
-                    else
-                    {
-                        sum_r += src_data[src_pixel_index * 3 + 0] * pixel_weight;
-                        sum_g += src_data[src_pixel_index * 3 + 1] * pixel_weight;
-                        sum_b += src_data[src_pixel_index * 3 + 2] * pixel_weight;
-                    }
-                }
-            }
+    wxVector<wxUint32> sums(count);
+    for ( int i = 0; i < count; i++ )
+        sums[i] = bias + (radius + 1)*src[i] + (radius - inside)*last[i];
 
-            // Put the data into the destination image.  The summed values are
-            // of double data type and are rounded here for accuracy
-            if ( src_alpha )
-            {
-                if (sum_a != 0)
-                {
-                     dst_data[0] = (unsigned char)(sum_r / sum_a + 0.5);
-                     dst_data[1] = (unsigned char)(sum_g / sum_a + 0.5);
-                     dst_data[2] = (unsigned char)(sum_b / sum_a + 0.5);
-                }
-                else
-                {
-                    dst_data[0] = 0;
-                    dst_data[1] = 0;
-                    dst_data[2] = 0;
-                }
-                *dst_alpha++ = (unsigned char)sum_a;
-            }
-            else
-            {
-                dst_data[0] = (unsigned char)(sum_r + 0.5);
-                dst_data[1] = (unsigned char)(sum_g + 0.5);
-                dst_data[2] = (unsigned char)(sum_b + 0.5);
-            }
-            dst_data += 3;
-        }
+    for ( int y = 1; y <= inside; y++ )
+    {
+        const unsigned char* const row = src + y*stride;
+        for ( int i = 0; i < count; i++ )
+            sums[i] += row[i];
     }
 
-    return ret_image;
+    for ( int y = 0; y < height; y++ )
+    {
+        const unsigned char* const add = src + wxMin(y + radius + 1, height - 1)*stride;
+        const unsigned char* const sub = src + wxMax(y - radius, 0)*stride;
+
+        unsigned char* const out = dst + y*stride;
+        for ( int i = 0; i < count; i++ )
+        {
+            out[i] = divide(sums[i]);
+
+            sums[i] += add[i];
+            sums[i] -= sub[i];
+        }
+    }
 }
 
-// Blur in the horizontal direction
-wxImage wxImage::BlurHorizontal(int blurRadius) const
+// Blur the source image horizontally into the destination one, which must
+// have the same size and also have alpha if the source one does.
+void DoBlurHorizontal(const wxImage& src, wxImage& dst, int radius, bool round)
 {
-    wxImage ret_image(MakeEmptyClone());
+    const int width = src.GetWidth();
+    const int height = src.GetHeight();
 
-    wxCHECK( ret_image.IsOk(), ret_image );
+    const unsigned char* const src_data = src.GetData();
+    const unsigned char* const src_alpha = src.GetAlpha();
+    unsigned char* const dst_data = dst.GetData();
+    unsigned char* const dst_alpha = dst.GetAlpha();
 
-    const unsigned char* src_data = M_IMGDATA->m_data;
-    unsigned char* dst_data = ret_image.GetData();
-    const unsigned char* src_alpha = M_IMGDATA->m_alpha;
-    unsigned char* dst_alpha = ret_image.GetAlpha();
-
-    // number of pixels we average over
-    const int blurArea = blurRadius*2 + 1;
-
-    // Horizontal blurring algorithm - average all pixels in the specified blur
-    // radius in the X or horizontal direction
-    for ( int y = 0; y < M_IMGDATA->m_height; y++ )
-    {
-        // Variables used in the blurring algorithm
-        long sum_r = 0,
-             sum_g = 0,
-             sum_b = 0,
-             sum_a = 0;
-
-        long pixel_idx;
-        const unsigned char *src;
-        unsigned char *dst;
-
-        // Calculate the average of all pixels in the blur radius for the first
-        // pixel of the row
-        for ( int kernel_x = -blurRadius; kernel_x <= blurRadius; kernel_x++ )
-        {
-            // To deal with the pixels at the start of a row so it's not
-            // grabbing GOK values from memory at negative indices of the
-            // image's data or grabbing from the previous row
-            if ( kernel_x < 0 )
-                pixel_idx = y * M_IMGDATA->m_width;
-            else
-                pixel_idx = kernel_x + y * M_IMGDATA->m_width;
+    const int blurArea = radius*2 + 1;
+    const wxUint32 bias = round ? blurArea / 2 : 0;
+    const BoxDivider divide(blurArea);
+
+    ForRowBands(width, height, [&](int yStart, int yEnd)
+    {
+        for ( int y = yStart; y < yEnd; y++ )
+        {
+            BlurRow<3>(src_data + y*width*3, dst_data + y*width*3, width,
+                       radius, bias, divide);
 
-            src = src_data + pixel_idx*3;
-            sum_r += src[0];
-            sum_g += src[1];
-            sum_b += src[2];
             if ( src_alpha )
-                sum_a += src_alpha[pixel_idx];
+            {
+                BlurRow<1>(src_alpha + y*width, dst_alpha + y*width, width,
+                           radius, bias, divide);
+            }
         }
+    });
+}
 
-        dst = dst_data + y * M_IMGDATA->m_width*3;
-        dst[0] = (unsigned char)(sum_r / blurArea);
-        dst[1] = (unsigned char)(sum_g / blurArea);
-        dst[2] = (unsigned char)(sum_b / blurArea);
-        if ( src_alpha )
-            dst_alpha[y * M_IMGDATA->m_width] = (unsigned char)(sum_a / blurArea);
+// Blur the source image vertically into the destination one, with the same
+// requirements as for DoBlurHorizontal().
+void DoBlurVertical(const wxImage& src, wxImage& dst, int radius, bool round)
+{
+    const int width = src.GetWidth();
+    const int height = src.GetHeight();
 
-        // Now average the values of the rest of the pixels by just moving the
-        // blur radius box along the row
-        for ( int x = 1; x < M_IMGDATA->m_width; x++ )
-        {
-            // Take care of edge pixels on the left edge by essentially
-            // duplicating the edge pixel
-            if ( x - blurRadius - 1 < 0 )
-                pixel_idx = y * M_IMGDATA->m_width;
-            else
-                pixel_idx = (x - blurRadius - 1) + y * M_IMGDATA->m_width;
-
-            // Subtract the value of the pixel at the left side of the blur
-            // radius box
-            src = src_data + pixel_idx*3;
-            sum_r -= src[0];
-            sum_g -= src[1];
-            sum_b -= src[2];
-            if ( src_alpha )
-                sum_a -= src_alpha[pixel_idx];
+    const unsigned char* const src_data = src.GetData();
+    const unsigned char* const src_alpha = src.GetAlpha();
+    unsigned char* const dst_data = dst.GetData();
+    unsigned char* const dst_alpha = dst.GetAlpha();
 
-            // Take care of edge pixels on the right edge
-            if ( x + blurRadius > M_IMGDATA->m_width - 1 )
-                pixel_idx = M_IMGDATA->m_width - 1 + y * M_IMGDATA->m_width;
-            else
-                pixel_idx = x + blurRadius + y * M_IMGDATA->m_width;
+    const int blurArea = radius*2 + 1;
+    const wxUint32 bias = round ? blurArea / 2 : 0;
+    const BoxDivider divide(blurArea);
 
-            // Add the value of the pixel being added to the end of our box
-            src = src_data + pixel_idx*3;
-            sum_r += src[0];
-            sum_g += src[1];
-            sum_b += src[2];
-            if ( src_alpha )
-                sum_a += src_alpha[pixel_idx];
+    // Split the image in bands of columns here.
+    ForRowBands(height, width, [&](int xStart, int xEnd)
+    {
+        BlurColumns(src_data + xStart*3, dst_data + xStart*3,
+                    (xEnd - xStart)*3, width*3, height,
+                    radius, bias, divide);
 
-            // Save off the averaged data
-            dst = dst_data + x*3 + y*M_IMGDATA->m_width*3;
-            dst[0] = (unsigned char)(sum_r / blurArea);
-            dst[1] = (unsigned char)(sum_g / blurArea);
-            dst[2] = (unsigned char)(sum_b / blurArea);
-            if ( src_alpha )
-                dst_alpha[x + y * M_IMGDATA->m_width] = (unsigned char)(sum_a / blurArea);
+        if ( src_alpha )
+        {
+            BlurColumns(src_alpha + xStart, dst_alpha + xStart,
+                        xEnd - xStart, width, height,
+                        radius, bias, divide);
         }
+    });
+}
+
+// Compute the radii of 3 successive box blurs approximating the Gaussian blur
+// with the given standard deviation, see "Fast Almost-Gaussian Filtering" by
+// Peter Kovesi for the explanation of the formulas used here.
+void GetGaussianBoxRadii(double sigma, int radii[3])
+{
+    // Ideal width of the box filter, which must be odd.
+    int widthLow = static_cast<int>(sqrt(4*sigma*sigma + 1));
+    if ( widthLow % 2 == 0 )
+        widthLow--;
+
+    // Number of passes using the lower width, the others use the next one.
+    const int numLow = wxRound((12*sigma*sigma - 3*widthLow*widthLow
+                                - 12*widthLow - 9) / (-4*widthLow - 4));
+
+    for ( int n = 0; n < 3; n++ )
+    {
+        const int w = n < numLow ? widthLow : widthLow + 2;
+        radii[n] = (w - 1) / 2;
     }
+}
+
+} // anonymous namespace
+
+// Blur in the horizontal direction
+wxImage wxImage::BlurHorizontal(int blurRadius) const
+{
+    wxImage ret_image(MakeEmptyClone());
+
+    wxCHECK( ret_image.IsOk(), ret_image );
+
+    DoBlurHorizontal(*this, ret_image, blurRadius, false);
 
     return ret_image;
 }
@@ -1225,111 +1777,53 @@ wxImage wxImage::BlurVertical(int blurRadius) const
 
     wxCHECK( ret_image.IsOk(), ret_image );
 
-    const unsigned char* src_data = M_IMGDATA->m_data;
-    unsigned char* dst_data = ret_image.GetData();
-    const unsigned char* src_alpha = M_IMGDATA->m_alpha;
-    unsigned char* dst_alpha = ret_image.GetAlpha();
-
-    // number of pixels we average over
-    const int blurArea = blurRadius*2 + 1;
-
-    // Vertical blurring algorithm - same as horizontal but switched the
-    // opposite direction
-    for ( int x = 0; x < M_IMGDATA->m_width; x++ )
-    {
-        // Variables used in the blurring algorithm
-        long sum_r = 0,
-             sum_g = 0,
-             sum_b = 0,
-             sum_a = 0;
-
-        long pixel_idx;
-        const unsigned char *src;
-        unsigned char *dst;
-
-        // Calculate the average of all pixels in our blur radius box for the
-        // first pixel of the column
-        for ( int kernel_y = -blurRadius; kernel_y <= blurRadius; kernel_y++ )
-        {
-            // To deal with the pixels at the start of a column so it's not
-            // grabbing GOK values from memory at negative indices of the
-            // image's data or grabbing from the previous column
-            if ( kernel_y < 0 )
-                pixel_idx = x;
-            else
-                pixel_idx = x + kernel_y * M_IMGDATA->m_width;
+    DoBlurVertical(*this, ret_image, blurRadius, false);
 
-            src = src_data + pixel_idx*3;
-            sum_r += src[0];
-            sum_g += src[1];
-            sum_b += src[2];
-            if ( src_alpha )
-                sum_a += src_alpha[pixel_idx];
-        }
+    return ret_image;
+}
 
-        dst = dst_data + x*3;
-        dst[0] = (unsigned char)(sum_r / blurArea);
-        dst[1] = (unsigned char)(sum_g / blurArea);
-        dst[2] = (unsigned char)(sum_b / blurArea);
-        if ( src_alpha )
-            dst_alpha[x] = (unsigned char)(sum_a / blurArea);
+// The new blur function
+wxImage wxImage::Blur(int blurRadius, wxImageBlurMode mode) const
+{
+    wxImage ret_image(MakeEmptyClone());
 
-        // Now average the values of the rest of the pixels by just moving the
-        // box along the column from top to bottom
-        for ( int y = 1; y < M_IMGDATA->m_height; y++ )
-        {
-            // Take care of pixels that would be beyond the top edge by
-            // duplicating the top edge pixel for the column
-            if ( y - blurRadius - 1 < 0 )
-                pixel_idx = x;
-            else
-                pixel_idx = x + (y - blurRadius - 1) * M_IMGDATA->m_width;
+    wxCHECK( ret_image.IsOk(), ret_image );
 
-            // Subtract the value of the pixel at the top of our blur radius box
-            src = src_data + pixel_idx*3;
-            sum_r -= src[0];
-            sum_g -= src[1];
-            sum_b -= src[2];
-            if ( src_alpha )
-                sum_a -= src_alpha[pixel_idx];
+    switch ( mode )
+    {
+        case wxIMAGE_BLUR_BOX:
+            {
+                // Blur the image in each direction
+                DoBlurHorizontal(*this, ret_image, blurRadius, false);
 
-            // Take care of the pixels that would be beyond the bottom edge of
-            // the image similar to the top edge
-            if ( y + blurRadius > M_IMGDATA->m_height - 1 )
-                pixel_idx = x + (M_IMGDATA->m_height - 1) * M_IMGDATA->m_width;
-            else
-                pixel_idx = x + (blurRadius + y) * M_IMGDATA->m_width;
+                wxImage tmp(ret_image.MakeEmptyClone());
+                DoBlurVertical(ret_image, tmp, blurRadius, false);
+                ret_image = tmp;
+            }
+            break;
 
-            // Add the value of the pixel being added to the end of our box
-            src = src_data + pixel_idx*3;
-            sum_r += src[0];
-            sum_g += src[1];
-            sum_b += src[2];
-            if ( src_alpha )
-                sum_a += src_alpha[pixel_idx];
+        case wxIMAGE_BLUR_GAUSSIAN:
+            {
+                // The radius corresponds to 2 standard deviations.
+                int radii[3];
+                GetGaussianBoxRadii(blurRadius / 2.0, radii);
 
-            // Save off the averaged data
-            dst = dst_data + (x + y * M_IMGDATA->m_width) * 3;
-            dst[0] = (unsigned char)(sum_r / blurArea);
-            dst[1] = (unsigned char)(sum_g / blurArea);
-            dst[2] = (unsigned char)(sum_b / blurArea);
-            if ( src_alpha )
-                dst_alpha[x + y * M_IMGDATA->m_width] = (unsigned char)(sum_a / blurArea);
-        }
-    }
+                // Round all the intermediate results to avoid darkening the
+                // image by accumulating truncation errors.
+                wxImage tmp(ret_image.MakeEmptyClone());
 
-    return ret_image;
-}
+                DoBlurHorizontal(*this, ret_image, radii[0], true);
+                DoBlurHorizontal(ret_image, tmp, radii[1], true);
+                DoBlurHorizontal(tmp, ret_image, radii[2], true);
 
-// The new blur function
-wxImage wxImage::Blur(int blurRadius) const
-{
-    wxImage ret_image;
-    ret_image.Create(M_IMGDATA->m_width, M_IMGDATA->m_height, false);
+                DoBlurVertical(ret_image, tmp, radii[0], true);
+                DoBlurVertical(tmp, ret_image, radii[1], true);
+                DoBlurVertical(ret_image, tmp, radii[2], true);
 
-    // Blur the image in each direction
-    ret_image = BlurHorizontal(blurRadius);
-    ret_image = ret_image.BlurVertical(blurRadius);
+                ret_image = tmp;
+            }
+            break;
+    }
 
     return ret_image;
 }
@@ -1610,6 +2104,239 @@ wxImage wxImage::GetSubImage( const wxRect &rect ) const
     return image;
 }
 
+// ----------------------------------------------------------------------------
+// wxImagePixelView
+// ----------------------------------------------------------------------------
+
+wxImagePixelView::wxImagePixelView(unsigned char* data,
+                                   int width,
+                                   int height,
+                                   wxImagePixelLayout layout,
+                                   int stride)
+{
+    wxCHECK_RET( data && width > 0 && height > 0, "invalid pixel view" );
+
+    m_layout = layout;
+
+    const int rowSize = width*GetBytesPerPixel();
+    if ( !stride )
+        stride = rowSize;
+
+    wxCHECK_RET( stride >= rowSize, "stride is too small for this width" );
+
+    m_data = data;
+    m_width = width;
+    m_height = height;
+    m_stride = stride;
+}
+
+wxImagePixelView::wxImagePixelView(wxImage& image)
+{
+    wxCHECK_RET( image.IsOk(), "invalid image" );
+
+    // Make sure we don't modify the data shared with other images.
+    image.UnShare();
+
+    m_data = image.GetData();
+    m_width = image.GetWidth();
+    m_height = image.GetHeight();
+    m_stride = m_width*3;
+    m_layout = wxIMAGE_PIXEL_RGB;
+}
+
+void
+wxImagePixelView::SetRGB(int x, int y,
+                         unsigned char r, unsigned char g, unsigned char b)
+{
+    wxCHECK_RET( x >= 0 && y >= 0 && x < m_width && y < m_height,
+                 "invalid pixel coordinates" );
+
+    unsigned char* const p = GetPixelData(x, y);
+    p[GetRedOffset()] = r;
+    p[1] = g;
+    p[2 - GetRedOffset()] = b;
+}
+
+void wxImagePixelView::SetAlpha(int x, int y, unsigned char alpha)
+{
+    wxCHECK_RET( HasAlpha(), "view has no alpha" );
+    wxCHECK_RET( x >= 0 && y >= 0 && x < m_width && y < m_height,
+                 "invalid pixel coordinates" );
+
+    GetPixelData(x, y)[3] = alpha;
+}
+
+wxImagePixelView wxImagePixelView::GetSubView(const wxRect& rect) const
+{
+    wxCHECK_MSG( IsOk(), wxImagePixelView(), "invalid pixel view" );
+
+    wxCHECK_MSG( rect.x >= 0 && rect.y >= 0 &&
+                 rect.width > 0 && rect.height > 0 &&
+                 rect.GetRight() < m_width && rect.GetBottom() < m_height,
+                 wxImagePixelView(), "invalid sub-view rectangle" );
+
+    return wxImagePixelView(GetPixelData(rect.x, rect.y),
+                            rect.width, rect.height,
+                            m_layout, m_stride);
+}
+
+wxImage wxImagePixelView::ToImage() const
+{
+    wxCHECK_MSG( IsOk(), wxImage(), "invalid pixel view" );
+
+    wxImage image(m_width, m_height, false);
+
+    unsigned char* data = image.GetData();
+    wxCHECK_MSG( data, wxImage(), "unable to create image" );
+
+    unsigned char* alpha = nullptr;
+    if ( HasAlpha() )
+    {
+        image.SetAlpha();
+        alpha = image.GetAlpha();
+    }
+
+    const int bpp = GetBytesPerPixel();
+    const int redOffset = GetRedOffset();
+
+    for ( int y = 0; y < m_height; y++ )
+    {
+        const unsigned char* src = GetRowData(y);
+
+        if ( m_layout == wxIMAGE_PIXEL_RGB )
+        {
+            // This is the format used by wxImage itself, so just copy it.
+            memcpy(data, src, m_width*3);
+            data += m_width*3;
+            continue;
+        }
+
+        for ( int x = 0; x < m_width; x++ )
+        {
+            data[0] = src[redOffset];
+            data[1] = src[1];
+            data[2] = src[2 - redOffset];
+            data += 3;
+
+            if ( alpha )
+                *alpha++ = src[3];
+
+            src += bpp;
+        }
+    }
+
+    return image;
+}
+
+bool wxImagePixelView::CopyFrom(const wxImage& image)
+{
+    wxCHECK_MSG( IsOk(), false, "invalid pixel view" );
+    wxCHECK_MSG( image.IsOk(), false, "invalid image" );
+    wxCHECK_MSG( image.GetWidth() == m_width && image.GetHeight() == m_height,
+                 false, "image and view sizes must be the same" );
+
+    const unsigned char* data = image.GetData();
+    const unsigned char* alpha = image.GetAlpha();
+
+    const int bpp = GetBytesPerPixel();
+    const int redOffset = GetRedOffset();
+
+    for ( int y = 0; y < m_height; y++ )
+    {
+        unsigned char* dst = GetRowData(y);
+
+        if ( m_layout == wxIMAGE_PIXEL_RGB )
+        {
+            memcpy(dst, data, m_width*3);
+            data += m_width*3;
+            continue;
+        }
+
+        for ( int x = 0; x < m_width; x++ )
+        {
+            dst[redOffset] = data[0];
+            dst[1] = data[1];
+            dst[2 - redOffset] = data[2];
+            data += 3;
+
+            if ( bpp == 4 )
+                dst[3] = alpha ? *alpha++ : wxIMAGE_ALPHA_OPAQUE;
+
+            dst += bpp;
+        }
+    }
+
+    return true;
+}
+
+void wxImagePixelView::Mirror(bool horizontally)
+{
+    wxCHECK_RET( IsOk(), "invalid pixel view" );
+
+    const int bpp = GetBytesPerPixel();
+
+    if ( horizontally )
+    {
+        for ( int y = 0; y < m_height; y++ )
+        {
+            unsigned char* left = GetRowData(y);
+            unsigned char* right = left + (m_width - 1)*bpp;
+            for ( ; left < right; left += bpp, right -= bpp )
+            {
+                for ( int i = 0; i < bpp; i++ )
+                    wxSwap(left[i], right[i]);
+            }
+        }
+    }
+    else // vertically
+    {
+        const int rowSize = m_width*bpp;
+        wxVector<unsigned char> tmp(rowSize);
+
+        for ( int y = 0; y < m_height / 2; y++ )
+        {
+            unsigned char* const top = GetRowData(y);
+            unsigned char* const bottom = GetRowData(m_height - 1 - y);
+
+            memcpy(&tmp[0], top, rowSize);
+            memcpy(top, bottom, rowSize);
+            memcpy(bottom, &tmp[0], rowSize);
+        }
+    }
+}
+
+bool wxImagePixelView::Rotate90(const wxImagePixelView& dst, bool clockwise) const
+{
+    wxCHECK_MSG( IsOk(), false, "invalid pixel view" );
+    wxCHECK_MSG( dst.IsOk(), false, "invalid destination view" );
+    wxCHECK_MSG( dst.m_layout == m_layout, false,
+                 "destination view must have the same layout" );
+    wxCHECK_MSG( dst.m_width == m_height && dst.m_height == m_width, false,
+                 "destination view must have the transposed size" );
+
+    const int bpp = GetBytesPerPixel();
+
+    // Iterate over the destination rows to write the memory sequentially.
+    for ( int y = 0; y < dst.m_height; y++ )
+    {
+        unsigned char* out = dst.GetRowData(y);
+
+        for ( int x = 0; x < dst.m_width; x++ )
+        {
+            // The pixel (x, y) of the source is moved to (height - 1 - y, x)
+            // when rotating clockwise and to (y, width - 1 - x) otherwise.
+            const unsigned char* const in = clockwise
+                ? GetPixelData(y, m_height - 1 - x)
+                : GetPixelData(m_width - 1 - y, x);
+
+            memcpy(out, in, bpp);
+            out += bpp;
+        }
+    }
+
+    return true;
+}
+
 wxImage wxImage::Size( const wxSize& size, const wxPoint& pos,
                        int r_, int g_, int b_ ) const
 {
@@ -1867,23 +2594,92 @@ void wxImage::Replace( unsigned char r1, unsigned char g1, unsigned char b1,
 
     AllocExclusive();
 
-    unsigned char *data = GetData();
+    unsigned char *data = GetData();
+
+    const int w = GetWidth();
+    const int h = GetHeight();
+
+    for (int j = 0; j < h; j++)
+        for (int i = 0; i < w; i++)
+        {
+            if ((data[0] == r1) && (data[1] == g1) && (data[2] == b1))
+            {
+                data[0] = r2;
+                data[1] = g2;
+                data[2] = b2;
+            }
+            data += 3;
+        }
+}
+
+namespace
+{
+
+// ----------------------------------------------------------------------------
+// ChannelTable: lookup table for per-channel colour transformations
+// ----------------------------------------------------------------------------
+
+// This class can be used for the transformations which change each colour
+// channel independently of the others, e.g. wxColour::ChangeLightness().
+class ChannelTable
+{
+public:
+    // The functor is called with pointers to red, green and blue components
+    // and must change all of them in the same way.
+    template <typename F>
+    explicit ChannelTable(const F& func)
+    {
+        for ( int i = 0; i < 256; i++ )
+        {
+            unsigned char r = i, g = i, b = i;
+            func(&r, &g, &b);
+            m_table[i] = r;
+        }
+    }
+
+    void Apply(unsigned char* rgb) const
+    {
+        rgb[0] = m_table[rgb[0]];
+        rgb[1] = m_table[rgb[1]];
+        rgb[2] = m_table[rgb[2]];
+    }
+
+private:
+    unsigned char m_table[256];
+};
 
-    const int w = GetWidth();
-    const int h = GetHeight();
+// ----------------------------------------------------------------------------
+// GreyscaleTables: lookup tables used by wxImage::ConvertToGreyscale()
+// ----------------------------------------------------------------------------
 
-    for (int j = 0; j < h; j++)
-        for (int i = 0; i < w; i++)
+// The luminance is computed in exactly the same way as by wxColour::MakeGrey()
+// but without any multiplications.
+class GreyscaleTables
+{
+public:
+    GreyscaleTables(double weight_r, double weight_g, double weight_b)
+    {
+        for ( int i = 0; i < 256; i++ )
         {
-            if ((data[0] == r1) && (data[1] == g1) && (data[2] == b1))
-            {
-                data[0] = r2;
-                data[1] = g2;
-                data[2] = b2;
-            }
-            data += 3;
+            m_red[i] = i * weight_r;
+            m_green[i] = i * weight_g;
+            m_blue[i] = i * weight_b;
         }
-}
+    }
+
+    void Apply(unsigned char* rgb) const
+    {
+        const double luma = m_red[rgb[0]] + m_green[rgb[1]] + m_blue[rgb[2]];
+        rgb[0] = rgb[1] = rgb[2] = (wxByte)wxRound(luma);
+    }
+
+private:
+    double m_red[256],
+           m_green[256],
+           m_blue[256];
+};
+
+} // anonymous namespace
 
 wxImage wxImage::ConvertToGreyscale() const
 {
@@ -1893,11 +2689,25 @@ wxImage wxImage::ConvertToGreyscale() const
 wxImage wxImage::ConvertToGreyscale(double weight_r, double weight_g, double weight_b) const
 {
     wxImage image = *this;
-    image.ApplyToAllPixels([&image, weight_r, weight_g, weight_b](unsigned char *rgb)
+
+    // The tables for the default weights are used most often, so reuse them.
+    static const GreyscaleTables s_defaultTables(0.299, 0.587, 0.114);
+
+    const bool useDefault = wxIsSameDouble(weight_r, 0.299) &&
+                            wxIsSameDouble(weight_g, 0.587) &&
+                            wxIsSameDouble(weight_b, 0.114);
+    std::unique_ptr<GreyscaleTables> tablesCustom;
+    if ( !useDefault )
+        tablesCustom.reset(new GreyscaleTables(weight_r, weight_g, weight_b));
+
+    const GreyscaleTables&
+        tables = useDefault ? s_defaultTables : *tablesCustom;
+
+    image.ApplyToAllPixels([&image, &tables](unsigned char *rgb)
     {
         if ( !image.HasMask() || rgb[0] != image.GetMaskRed() ||
              rgb[1] != image.GetMaskGreen() || rgb[2] != image.GetMaskBlue() )
-            wxColour::MakeGrey(rgb, rgb + 1, rgb + 2, weight_r, weight_g, weight_b);
+            tables.Apply(rgb);
     });
     return image;
 }
@@ -1925,11 +2735,18 @@ wxImage wxImage::ConvertToMono(unsigned char r, unsigned char g, unsigned char b
 wxImage wxImage::ConvertToDisabled(unsigned char brightness) const
 {
     wxImage image = *this;
-    image.ApplyToAllPixels([&image, brightness](unsigned char *rgb)
+
+    const ChannelTable
+        table([brightness](unsigned char* r, unsigned char* g, unsigned char* b)
+        {
+            wxColour::MakeDisabled(r, g, b, brightness);
+        });
+
+    image.ApplyToAllPixels([&image, &table](unsigned char *rgb)
     {
         if ( !image.HasMask() || rgb[0] != image.GetMaskRed() ||
              rgb[1] != image.GetMaskGreen() || rgb[2] != image.GetMaskBlue() )
-            wxColour::MakeDisabled(rgb, rgb + 1, rgb + 2, brightness);
+            table.Apply(rgb);
     });
     return image;
 }
@@ -1938,11 +2755,18 @@ wxImage wxImage::ChangeLightness(int alpha) const
 {
     wxASSERT(alpha >= 0 && alpha <= 200);
     wxImage image = *this;
-    image.ApplyToAllPixels([&image, alpha](unsigned char *rgb)
+
+    const ChannelTable
+        table([alpha](unsigned char* r, unsigned char* g, unsigned char* b)
+        {
+            wxColour::ChangeLightness(r, g, b, alpha);
+        });
+
+    image.ApplyToAllPixels([&image, &table](unsigned char *rgb)
     {
         if ( !image.HasMask() || rgb[0] != image.GetMaskRed() ||
              rgb[1] != image.GetMaskGreen() || rgb[2] != image.GetMaskBlue() )
-            wxColour::ChangeLightness(rgb, rgb + 1, rgb + 2, alpha);
+            table.Apply(rgb);
     });
     return image;
 }
@@ -2603,6 +3427,18 @@ int wxImage::GetDefaultLoadFlags()
     return wxImageRefData::sm_defaultLoadFlags;
 }
 
+/* static */
+void wxImage::SetMaxThreads(unsigned int count)
+{
+    wxImageRefData::sm_maxThreads = count;
+}
+
+/* static */
+unsigned int wxImage::GetMaxThreads()
+{
+    return wxImageRefData::sm_maxThreads;
+}
+
 void wxImage::SetLoadFlags(int flags)
 {
     AllocExclusive();
@@ -3363,23 +4199,257 @@ wxImage::RGBValue wxImage::HSVtoRGB(const HSVValue& hsv)
                     (unsigned char)wxRound(blue * 255.0));
 }
 
-static void DoRotateHue(unsigned char *rgb, double angle)
+namespace
+{
+
+// ----------------------------------------------------------------------------
+// Float4: vector of 4 floats used by the colour transformations
+// ----------------------------------------------------------------------------
+
+// This class allows to write the code operating on 4 pixels at once without
+// caring about the SIMD instructions available. Comparison operators return
+// masks which can only be used with Select().
+#if defined(wxHAS_SSE2)
+
+class Float4
 {
-    wxImage::RGBValue rgbValue(rgb[0], rgb[1], rgb[2]);
-    wxImage::HSVValue hsvValue = wxImage::RGBtoHSV(rgbValue);
+public:
+    explicit Float4(float f) : m_v(_mm_set1_ps(f)) { }
+    explicit Float4(const float* p) : m_v(_mm_loadu_ps(p)) { }
 
-    hsvValue.hue = hsvValue.hue + angle;
+    void Store(float* p) const { _mm_storeu_ps(p, m_v); }
 
-    if (hsvValue.hue > 1.0)
-        hsvValue.hue = hsvValue.hue - 1.0;
-    else if (hsvValue.hue < 0.0)
-        hsvValue.hue = hsvValue.hue + 1.0;
+    Float4 operator+(const Float4& o) const { return Float4(_mm_add_ps(m_v, o.m_v)); }
+    Float4 operator-(const Float4& o) const { return Float4(_mm_sub_ps(m_v, o.m_v)); }
+    Float4 operator*(const Float4& o) const { return Float4(_mm_mul_ps(m_v, o.m_v)); }
+    Float4 operator/(const Float4& o) const { return Float4(_mm_div_ps(m_v, o.m_v)); }
 
-    rgbValue = wxImage::HSVtoRGB(hsvValue);
-    rgb[0] = rgbValue.red;
-    rgb[1] = rgbValue.green;
-    rgb[2] = rgbValue.blue;
-}
+    Float4 operator==(const Float4& o) const { return Float4(_mm_cmpeq_ps(m_v, o.m_v)); }
+    Float4 operator<(const Float4& o) const { return Float4(_mm_cmplt_ps(m_v, o.m_v)); }
+    Float4 operator>(const Float4& o) const { return Float4(_mm_cmpgt_ps(m_v, o.m_v)); }
+    Float4 operator>=(const Float4& o) const { return Float4(_mm_cmpge_ps(m_v, o.m_v)); }
+
+    static Float4 Min(const Float4& a, const Float4& b)
+        { return Float4(_mm_min_ps(a.m_v, b.m_v)); }
+    static Float4 Max(const Float4& a, const Float4& b)
+        { return Float4(_mm_max_ps(a.m_v, b.m_v)); }
+
+    // Return the elements of a where the mask is set and of b elsewhere.
+    static Float4 Select(const Float4& mask, const Float4& a, const Float4& b)
+    {
+        return Float4(_mm_or_ps(_mm_and_ps(mask.m_v, a.m_v),
+                                _mm_andnot_ps(mask.m_v, b.m_v)));
+    }
+
+private:
+    explicit Float4(__m128 v) : m_v(v) { }
+
+    __m128 m_v;
+};
+
+#elif defined(wxHAS_NEON)
+
+class Float4
+{
+public:
+    explicit Float4(float f) : m_v(vdupq_n_f32(f)) { }
+    explicit Float4(const float* p) : m_v(vld1q_f32(p)) { }
+
+    void Store(float* p) const { vst1q_f32(p, m_v); }
+
+    Float4 operator+(const Float4& o) const { return Float4(vaddq_f32(m_v, o.m_v)); }
+    Float4 operator-(const Float4& o) const { return Float4(vsubq_f32(m_v, o.m_v)); }
+    Float4 operator*(const Float4& o) const { return Float4(vmulq_f32(m_v, o.m_v)); }
+    Float4 operator/(const Float4& o) const { return Float4(vdivq_f32(m_v, o.m_v)); }
+
+    Float4 operator==(const Float4& o) const { return FromMask(vceqq_f32(m_v, o.m_v)); }
+    Float4 operator<(const Float4& o) const { return FromMask(vcltq_f32(m_v, o.m_v)); }
+    Float4 operator>(const Float4& o) const { return FromMask(vcgtq_f32(m_v, o.m_v)); }
+    Float4 operator>=(const Float4& o) const { return FromMask(vcgeq_f32(m_v, o.m_v)); }
+
+    static Float4 Min(const Float4& a, const Float4& b)
+        { return Float4(vminq_f32(a.m_v, b.m_v)); }
+    static Float4 Max(const Float4& a, const Float4& b)
+        { return Float4(vmaxq_f32(a.m_v, b.m_v)); }
+
+    static Float4 Select(const Float4& mask, const Float4& a, const Float4& b)
+    {
+        return Float4(vbslq_f32(vreinterpretq_u32_f32(mask.m_v), a.m_v, b.m_v));
+    }
+
+private:
+    explicit Float4(float32x4_t v) : m_v(v) { }
+
+    static Float4 FromMask(uint32x4_t mask)
+        { return Float4(vreinterpretq_f32_u32(mask)); }
+
+    float32x4_t m_v;
+};
+
+#else // !wxHAS_SSE2 && !wxHAS_NEON
+
+class Float4
+{
+public:
+    explicit Float4(float f) { for ( int i = 0; i < 4; i++ ) m_v[i] = f; }
+    explicit Float4(const float* p) { for ( int i = 0; i < 4; i++ ) m_v[i] = p[i]; }
+
+    void Store(float* p) const { for ( int i = 0; i < 4; i++ ) p[i] = m_v[i]; }
+
+    Float4 operator+(const Float4& o) const { Float4 r; for ( int i = 0; i < 4; i++ ) r.m_v[i] = m_v[i] + o.m_v[i]; return r; }
+    Float4 operator-(const Float4& o) const { Float4 r; for ( int i = 0; i < 4; i++ ) r.m_v[i] = m_v[i] - o.m_v[i]; return r; }
+    Float4 operator*(const Float4& o) const { Float4 r; for ( int i = 0; i < 4; i++ ) r.m_v[i] = m_v[i] * o.m_v[i]; return r; }
+    Float4 operator/(const Float4& o) const { Float4 r; for ( int i = 0; i < 4; i++ ) r.m_v[i] = m_v[i] / o.m_v[i]; return r; }
+
+    // The masks use 1 for true and 0 for false here.
+    Float4 operator==(const Float4& o) const { Float4 r; for ( int i = 0; i < 4; i++ ) r.m_v[i] = m_v[i] == o.m_v[i]; return r; }
+    Float4 operator<(const Float4& o) const { Float4 r; for ( int i = 0; i < 4; i++ ) r.m_v[i] = m_v[i] < o.m_v[i]; return r; }
+    Float4 operator>(const Float4& o) const { Float4 r; for ( int i = 0; i < 4; i++ ) r.m_v[i] = m_v[i] > o.m_v[i]; return r; }
+    Float4 operator>=(const Float4& o) const { Float4 r; for ( int i = 0; i < 4; i++ ) r.m_v[i] = m_v[i] >= o.m_v[i]; return r; }
+
+    static Float4 Min(const Float4& a, const Float4& b)
+        { Float4 r; for ( int i = 0; i < 4; i++ ) r.m_v[i] = a.m_v[i] < b.m_v[i] ? a.m_v[i] : b.m_v[i]; return r; }
+    static Float4 Max(const Float4& a, const Float4& b)
+        { Float4 r; for ( int i = 0; i < 4; i++ ) r.m_v[i] = a.m_v[i] > b.m_v[i] ? a.m_v[i] : b.m_v[i]; return r; }
+
+    static Float4 Select(const Float4& mask, const Float4& a, const Float4& b)
+        { Float4 r; for ( int i = 0; i < 4; i++ ) r.m_v[i] = mask.m_v[i] != 0 ? a.m_v[i] : b.m_v[i]; return r; }
+
+private:
+    Float4() { }
+
+    float m_v[4];
+};
+
+#endif // wxHAS_SSE2/wxHAS_NEON/none
+
+// ----------------------------------------------------------------------------
+// HSVTransform: changes hue, saturation and value of whole rows of pixels
+// ----------------------------------------------------------------------------
+
+// This class performs all the adjustments done by wxImage::ChangeHSV() in a
+// single pass, converting each pixel to HSV and back only once, and processes
+// 4 pixels at once using single precision arithmetic. The results may differ
+// from those of RGBtoHSV() and HSVtoRGB() by 1 due to rounding.
+class HSVTransform
+{
+public:
+    // The parameters have the same meaning as for wxImage::ChangeHSV().
+    HSVTransform(double angleH, double factorS, double factorV)
+        : m_hueShift(static_cast<float>(angleH * 6.0)),
+          m_factorS(static_cast<float>(factorS)),
+          m_factorV(static_cast<float>(factorV))
+    {
+    }
+
+    // Transform the given number of pixels in RGB format.
+    void Apply(unsigned char* rgb, size_t count) const
+    {
+        float r[4], g[4], b[4];
+        while ( count )
+        {
+            const size_t n = count < 4 ? count : 4;
+
+            size_t i;
+            for ( i = 0; i < n; i++ )
+            {
+                r[i] = rgb[3*i];
+                g[i] = rgb[3*i + 1];
+                b[i] = rgb[3*i + 2];
+            }
+
+            // Avoid using uninitialized values for the last partial group.
+            for ( ; i < 4; i++ )
+                r[i] = g[i] = b[i] = 0;
+
+            Transform(r, g, b);
+
+            // The values are already rounded and clamped to [0, 255] range.
+            for ( i = 0; i < n; i++ )
+            {
+                rgb[3*i] = static_cast<unsigned char>(r[i]);
+                rgb[3*i + 1] = static_cast<unsigned char>(g[i]);
+                rgb[3*i + 2] = static_cast<unsigned char>(b[i]);
+            }
+
+            rgb += 3*n;
+            count -= n;
+        }
+    }
+
+private:
+    void Transform(float* r, float* g, float* b) const
+    {
+        const Float4 red(r), green(g), blue(b);
+        const Float4 zero(0.0f), one(1.0f), six(6.0f);
+
+        const Float4 maximumRGB = Float4::Max(Float4::Max(red, green), blue);
+        const Float4 minimumRGB = Float4::Min(Float4::Min(red, green), blue);
+        const Float4 deltaRGB = maximumRGB - minimumRGB;
+        const Float4 notGrey = deltaRGB > zero;
+
+        // Compute the hue in [0, 6) range, i.e. in units of 60 degrees, in the
+        // same way as RGBtoHSV() does, but avoiding the division by 0 for greys
+        // for which the hue doesn't matter anyhow as their saturation is 0.
+        const Float4 divisor = Float4::Select(notGrey, deltaRGB, one);
+        Float4 hue = Float4::Select(red == maximumRGB,
+                                    (green - blue) / divisor,
+                     Float4::Select(green == maximumRGB,
+                                    Float4(2.0f) + (blue - red) / divisor,
+                                    Float4(4.0f) + (red - green) / divisor));
+        hue = Float4::Select(hue < zero, hue + six, hue);
+
+        hue = hue + Float4(m_hueShift);
+        hue = Float4::Select(hue < zero, hue + six, hue);
+        hue = Float4::Select(hue >= six, hue - six, hue);
+
+        // Maximum is at least 1 for non-grey pixels, so using it as divisor
+        // is safe.
+        Float4 saturation = Float4::Select(notGrey,
+                                           deltaRGB / Float4::Max(maximumRGB, one),
+                                           zero);
+        saturation = saturation + saturation * Float4(m_factorS);
+        saturation = Float4::Min(Float4::Max(saturation, zero), one);
+
+        // Keep the value in [0, 255] range to avoid scaling it.
+        Float4 value = maximumRGB + maximumRGB * Float4(m_factorV);
+        value = Float4::Min(Float4::Max(value, zero), Float4(255.0f));
+
+        // Convert back to RGB using the formula equivalent to the one used by
+        // HSVtoRGB() but avoiding any branches.
+        const Float4 chroma = value * saturation;
+        const Float4 half(0.5f);
+
+        ToChannel(5.0f, hue, value, chroma, half).Store(r);
+        ToChannel(3.0f, hue, value, chroma, half).Store(g);
+        ToChannel(1.0f, hue, value, chroma, half).Store(b);
+    }
+
+    // Return the rounded value of the component with the given offset: 5 for
+    // red, 3 for green and 1 for blue.
+    static Float4 ToChannel(float offset,
+                            const Float4& hue,
+                            const Float4& value,
+                            const Float4& chroma,
+                            const Float4& half)
+    {
+        const Float4 zero(0.0f), one(1.0f), six(6.0f);
+
+        Float4 k = hue + Float4(offset);
+        k = Float4::Select(k >= six, k - six, k);
+
+        const Float4
+            f = Float4::Min(Float4::Max(Float4::Min(k, Float4(4.0f) - k), zero),
+                            one);
+
+        return value - chroma * f + half;
+    }
+
+    const float m_hueShift,
+                m_factorS,
+                m_factorV;
+};
+} // anonymous namespace
 
 // Rotates the hue of each pixel in the image by angle, which is a double in the
 // range [-1.0..+1.0], where -1.0 corresponds to -360 degrees and +1.0 corresponds
@@ -3390,28 +4460,7 @@ void wxImage::RotateHue(double angle)
         return;
 
     wxASSERT(angle >= -1.0 && angle <= 1.0);
-    ApplyToAllPixels([angle](unsigned char *rgb)
-    {
-        DoRotateHue(rgb, angle);
-    });
-}
-
-static void DoChangeSaturation(unsigned char *rgb, double factor)
-{
-    wxImage::RGBValue rgbValue(rgb[0], rgb[1], rgb[2]);
-    wxImage::HSVValue hsvValue = wxImage::RGBtoHSV(rgbValue);
-
-    hsvValue.saturation += hsvValue.saturation * factor;
-
-    if (hsvValue.saturation > 1.0)
-        hsvValue.saturation = 1.0;
-    else if (hsvValue.saturation < 0.0)
-        hsvValue.saturation = 0.0;
-
-    rgbValue = wxImage::HSVtoRGB(hsvValue);
-    rgb[0] = rgbValue.red;
-    rgb[1] = rgbValue.green;
-    rgb[2] = rgbValue.blue;
+    ChangeHSV(angle, 0.0, 0.0);
 }
 
 // Changes the saturation of each pixel in the image. factor is a double in the
@@ -3423,28 +4472,7 @@ void wxImage::ChangeSaturation(double factor)
         return;
 
     wxASSERT(factor >= -1.0 && factor <= 1.0);
-    ApplyToAllPixels([factor](unsigned char *rgb)
-    {
-        DoChangeSaturation(rgb, factor);
-    });
-}
-
-static void DoChangeBrightness(unsigned char *rgb, double factor)
-{
-    wxImage::RGBValue rgbValue(rgb[0], rgb[1], rgb[2]);
-    wxImage::HSVValue hsvValue = wxImage::RGBtoHSV(rgbValue);
-
-    hsvValue.value += hsvValue.value * factor;
-
-    if (hsvValue.value > 1.0)
-        hsvValue.value = 1.0;
-    else if (hsvValue.value < 0.0)
-        hsvValue.value = 0.0;
-
-    rgbValue = wxImage::HSVtoRGB(hsvValue);
-    rgb[0] = rgbValue.red;
-    rgb[1] = rgbValue.green;
-    rgb[2] = rgbValue.blue;
+    ChangeHSV(0.0, factor, 0.0);
 }
 
 // Changes the brightness (value) of each pixel in the image. factor is a double
@@ -3456,10 +4484,7 @@ void wxImage::ChangeBrightness(double factor)
         return;
 
     wxASSERT(factor >= -1.0 && factor <= 1.0);
-    ApplyToAllPixels([factor](unsigned char *rgb)
-    {
-        DoChangeBrightness(rgb, factor);
-    });
+    ChangeHSV(0.0, 0.0, factor);
 }
 
 // Changes the hue, the saturation and the brightness (value) of each pixel in
@@ -3475,16 +4500,11 @@ void wxImage::ChangeHSV(double angleH, double factorS, double factorV)
 
     wxASSERT(angleH >= -1.0 && angleH <= 1.0 && factorS >= -1.0 &&
              factorS <= 1.0 && factorV >= -1.0 && factorV <= 1.0);
-    ApplyToAllPixels([angleH, factorS, factorV](unsigned char *rgb)
-    {
-        if ( !wxIsNullDouble(angleH) )
-            DoRotateHue(rgb, angleH);
-
-        if ( !wxIsNullDouble(factorS) )
-            DoChangeSaturation(rgb, factorS);
 
-        if ( !wxIsNullDouble(factorV) )
-            DoChangeBrightness(rgb, factorV);
+    const HSVTransform transform(angleH, factorS, factorV);
+    ApplyToAllRows([&transform](unsigned char *rgb, size_t count)
+    {
+        transform.Apply(rgb, count);
     });
 }
 
@@ -3558,6 +4578,180 @@ wxImageHandler::GetResolutionFromOptions(const wxImage& image, int *x, int *y)
     return (wxImageResolution)resUnit;
 }
 
+//-----------------------------------------------------------------------------
+// wxImageIncrementalDecoder
+//-----------------------------------------------------------------------------
+
+/* static */
+wxImageIncrementalDecoder* wxImageIncrementalDecoder::Create(wxBitmapType type)
+{
+    const wxImageHandler* const handler = wxImage::FindHandler(type);
+    if ( !handler )
+        return nullptr;
+
+    return handler->CreateIncrementalDecoder();
+}
+
+bool wxImageIncrementalDecoder::Feed(const void* data, size_t len)
+{
+    switch ( m_state )
+    {
+        case State_Header:
+        case State_Decoding:
+            break;
+
+        case State_Done:
+            // Ignore any trailing data.
+            return true;
+
+        case State_Failed:
+        case State_Cancelled:
+            return false;
+    }
+
+    if ( !len )
+        return true;
+
+    if ( !DoFeed(static_cast<const unsigned char*>(data), len, false) )
+    {
+        SetFailed();
+        return false;
+    }
+
+    return NotifyListener();
+}
+
+bool wxImageIncrementalDecoder::Finish()
+{
+    if ( m_state == State_Header || m_state == State_Decoding )
+    {
+        if ( !DoFeed(nullptr, 0, true) )
+        {
+            SetFailed();
+            return false;
+        }
+
+        if ( !NotifyListener() )
+            return false;
+
+        // If the decoder couldn't complete the image even without any more
+        // data, it must be truncated.
+        if ( m_state != State_Done )
+            SetFailed();
+    }
+
+    return m_state == State_Done;
+}
+
+#if wxUSE_STREAMS
+
+bool wxImageIncrementalDecoder::Load(wxInputStream& stream)
+{
+    unsigned char buf[16384];
+    for ( ;; )
+    {
+        const size_t len = stream.Read(buf, sizeof(buf)).LastRead();
+        if ( !len )
+            break;
+
+        if ( !Feed(buf, len) )
+            return false;
+    }
+
+    return Finish();
+}
+
+#endif // wxUSE_STREAMS
+
+bool
+wxImageIncrementalDecoder::StartImage(int width, int height,
+                                      bool hasAlpha, bool clear)
+{
+    wxCHECK_MSG( m_state == State_Header, false, "image already started" );
+
+    if ( !m_image.Create(width, height, clear) )
+        return false;
+
+    if ( hasAlpha )
+    {
+        m_image.SetAlpha();
+
+        if ( clear )
+            memset(m_image.GetAlpha(), 0, static_cast<size_t>(width)*height);
+    }
+
+    m_state = State_Decoding;
+    m_notifyStarted = true;
+
+    return true;
+}
+
+void wxImageIncrementalDecoder::AddDecodedRows(int firstRow, int numRows, int pass)
+{
+    if ( numRows <= 0 )
+        return;
+
+    // We only notify the listener once DoFeed() returns, so just combine all
+    // the rows decoded during the last call to it, possibly in different
+    // passes, together.
+    const int lastRow = firstRow + numRows - 1;
+    if ( m_firstRow == -1 )
+    {
+        m_firstRow = firstRow;
+        m_lastRow = lastRow;
+    }
+    else
+    {
+        m_firstRow = wxMin(m_firstRow, firstRow);
+        m_lastRow = wxMax(m_lastRow, lastRow);
+    }
+
+    m_pass = pass;
+}
+
+bool wxImageIncrementalDecoder::NotifyListener()
+{
+    bool ok = true;
+    if ( m_notifyStarted )
+    {
+        m_notifyStarted = false;
+
+        if ( m_listener && !m_listener->OnImageStarted(m_image) )
+            ok = false;
+    }
+
+    if ( m_firstRow != -1 )
+    {
+        if ( ok && m_listener &&
+                !m_listener->OnRowsDecoded(m_image, m_firstRow,
+                                           m_lastRow - m_firstRow + 1,
+                                           m_pass) )
+        {
+            ok = false;
+        }
+
+        m_firstRow =
+        m_lastRow = -1;
+    }
+
+    // Don't consider that decoding was cancelled if it's already done.
+    if ( !ok && m_state != State_Done )
+    {
+        m_state = State_Cancelled;
+        return false;
+    }
+
+    return true;
+}
+
+void wxImageIncrementalDecoder::SetFailed()
+{
+    m_state = State_Failed;
+
+    if ( m_verbose )
+        wxLogError(_("Failed to decode the image data."));
+}
+
 // ----------------------------------------------------------------------------
 // image histogram stuff
 // ----------------------------------------------------------------------------
@@ -3946,19 +5140,35 @@ wxImage wxImage::Rotate(double angle,
     return rotated;
 }
 
-// Helper function used internally by wxImage class only.
+// Helper functions used internally by wxImage class only.
 template <typename F>
-void wxImage::ApplyToAllPixels(const F& func)
+void wxImage::ApplyToAllRows(const F& func)
 {
+    wxCHECK_RET( IsOk(), wxT("invalid image") );
+
     AllocExclusive();
 
-    const size_t size = GetWidth() * GetHeight();
-    unsigned char *data = GetData();
+    const int width = GetWidth();
+    unsigned char* const data = GetData();
 
-    for ( size_t i = 0; i < size; i++, data += 3 )
+    // The rows are contiguous, so each band can be processed at once.
+    ForRowBands(width, GetHeight(), [width, data, &func](int start, int end)
     {
-        func(data);
-    }
+        func(data + 3*static_cast<size_t>(start)*width,
+             static_cast<size_t>(end - start)*width);
+    });
+}
+
+template <typename F>
+void wxImage::ApplyToAllPixels(const F& func)
+{
+    ApplyToAllRows([&func](unsigned char *data, size_t count)
+    {
+        for ( size_t i = 0; i < count; i++, data += 3 )
+        {
+            func(data);
+        }
+    });
 }
 
 // A module to allow wxImage initialization/cleanup
@@ -349,6 +349,328 @@ bool wxJPEGHandler::LoadFile( wxImage *image, wxInputStream& stream, bool verbos
     return true;
 }
 
+// ----------------------------------------------------------------------------
+// incremental decoding
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+// Data source manager used for incremental decoding: it doesn't read any data
+// itself, but just suspends the decoder when more data is needed.
+struct wx_incremental_source_mgr
+{
+    struct jpeg_source_mgr pub;   /* public fields */
+
+    bool eof;                     /* no more data will be fed */
+    size_t skip;                  /* bytes to skip from the data fed later */
+};
+
+} // anonymous namespace
+
+extern "C"
+{
+
+CPP_METHODDEF(boolean) wx_incremental_fill_input_buffer ( j_decompress_ptr cinfo )
+{
+    wx_incremental_source_mgr* src = (wx_incremental_source_mgr*) cinfo->src;
+
+    if ( !src->eof )
+    {
+        // Suspend the decoder until more data is fed to it.
+        return FALSE;
+    }
+
+    // Insert a fake EOI marker, as wx_fill_input_buffer() does.
+    static const JOCTET fakeEOI[] = { 0xFF, JPEG_EOI };
+    src->pub.next_input_byte = fakeEOI;
+    src->pub.bytes_in_buffer = WXSIZEOF(fakeEOI);
+
+    return TRUE;
+}
+
+CPP_METHODDEF(void) wx_incremental_skip_input_data ( j_decompress_ptr cinfo, long num_bytes )
+{
+    if (num_bytes > 0)
+    {
+        wx_incremental_source_mgr* src = (wx_incremental_source_mgr*) cinfo->src;
+
+        if ( (size_t)num_bytes > src->pub.bytes_in_buffer )
+        {
+            // Remember to skip the rest when we get it.
+            src->skip += (size_t)num_bytes - src->pub.bytes_in_buffer;
+            num_bytes = (long)src->pub.bytes_in_buffer;
+        }
+
+        src->pub.next_input_byte += (size_t) num_bytes;
+        src->pub.bytes_in_buffer -= (size_t) num_bytes;
+    }
+}
+
+} // extern "C"
+
+namespace
+{
+
+class wxJPEGIncrementalDecoder : public wxImageIncrementalDecoder
+{
+public:
+    wxJPEGIncrementalDecoder() = default;
+    virtual ~wxJPEGIncrementalDecoder() override;
+
+protected:
+    virtual bool DoFeed(const unsigned char* data, size_t len, bool finish) override;
+
+private:
+    // Decode as much as possible of the data available in m_buffer. This
+    // function uses setjmp(), so there must be no objects with non-trivial
+    // dtors in it.
+    bool DoDecode();
+
+    // Copy the last row read by libjpeg into the image.
+    void StoreRow();
+
+    // Possible stages of decoding, corresponding to the libjpeg function to
+    // call next.
+    enum Stage
+    {
+        Stage_ReadHeader,
+        Stage_StartDecompress,
+        Stage_StartOutput,      // only used for progressive JPEGs
+        Stage_ReadScanlines,
+        Stage_FinishOutput,     // only used for progressive JPEGs
+        Stage_FinishDecompress,
+        Stage_Done
+    };
+
+    struct jpeg_decompress_struct m_cinfo;
+    wx_error_mgr m_jerr;
+    wx_incremental_source_mgr m_src;
+    bool m_created = false;
+
+    // Data fed to us but not consumed by libjpeg yet.
+    wxVector<JOCTET> m_buffer;
+
+    JSAMPARRAY m_row = nullptr;
+    Stage m_stage = Stage_ReadHeader;
+
+    // Only used for the progressive JPEGs.
+    int m_pass = 0;
+    int m_lastScan = 0;
+    bool m_finalPass = false;
+};
+
+wxJPEGIncrementalDecoder::~wxJPEGIncrementalDecoder()
+{
+    if ( m_created )
+        jpeg_destroy_decompress(&m_cinfo);
+}
+
+bool
+wxJPEGIncrementalDecoder::DoFeed(const unsigned char* data, size_t len, bool finish)
+{
+    if ( !m_created )
+    {
+        m_cinfo.err = jpeg_std_error(&m_jerr);
+        m_jerr.error_exit = wx_error_exit;
+
+        if ( !IsVerbose() )
+            m_cinfo.err->output_message = wx_ignore_message;
+
+        if ( setjmp(m_jerr.setjmp_buffer) )
+            return false;
+
+        jpeg_create_decompress(&m_cinfo);
+        m_created = true;
+
+        m_src.pub.init_source = wx_init_source;
+        m_src.pub.fill_input_buffer = wx_incremental_fill_input_buffer;
+        m_src.pub.skip_input_data = wx_incremental_skip_input_data;
+        m_src.pub.resync_to_restart = jpeg_resync_to_restart;
+        m_src.pub.term_source = wx_init_source; /* nothing to do here neither */
+        m_src.pub.next_input_byte = nullptr;
+        m_src.pub.bytes_in_buffer = 0;
+        m_src.eof = false;
+        m_src.skip = 0;
+
+        m_cinfo.src = &m_src.pub;
+    }
+
+    if ( finish )
+    {
+        m_src.eof = true;
+    }
+    else
+    {
+        // Skip the data libjpeg asked to skip before.
+        const size_t skip = wxMin(m_src.skip, len);
+        m_src.skip -= skip;
+        data += skip;
+        len -= skip;
+
+        // Keep the data which hasn't been consumed yet and append the new one.
+        const size_t remaining = m_src.pub.bytes_in_buffer;
+        if ( remaining && m_src.pub.next_input_byte != &m_buffer[0] )
+            memmove(&m_buffer[0], m_src.pub.next_input_byte, remaining);
+
+        m_buffer.resize(remaining + len);
+        if ( len )
+            memcpy(&m_buffer[remaining], data, len);
+
+        m_src.pub.next_input_byte = m_buffer.empty() ? nullptr : &m_buffer[0];
+        m_src.pub.bytes_in_buffer = m_buffer.size();
+    }
+
+    return DoDecode();
+}
+
+bool wxJPEGIncrementalDecoder::DoDecode()
+{
+    if ( setjmp(m_jerr.setjmp_buffer) )
+        return false;
+
+    // Note that all the libjpeg functions called here may suspend, in which
+    // case we just return and call them again when we have more data.
+    for ( ;; )
+    {
+        switch ( m_stage )
+        {
+            case Stage_ReadHeader:
+                if ( jpeg_read_header(&m_cinfo, TRUE) == JPEG_SUSPENDED )
+                    return true;
+
+                if ( m_cinfo.out_color_space == JCS_CMYK ||
+                        m_cinfo.out_color_space == JCS_YCCK )
+                {
+                    m_cinfo.out_color_space = JCS_CMYK;
+                }
+                else // all the rest is treated as RGB
+                {
+                    m_cinfo.out_color_space = JCS_RGB;
+                }
+
+                // Show the progressive images scan by scan.
+                m_cinfo.buffered_image = jpeg_has_multiple_scans(&m_cinfo);
+
+                m_stage = Stage_StartDecompress;
+                break;
+
+            case Stage_StartDecompress:
+                if ( !jpeg_start_decompress(&m_cinfo) )
+                    return true;
+
+                // Clear progressive images, as they're shown before being
+                // fully decoded.
+                if ( !StartImage(m_cinfo.output_width, m_cinfo.output_height,
+                                 false, m_cinfo.buffered_image != FALSE) )
+                {
+                    return false;
+                }
+
+                if ( m_cinfo.saw_JFIF_marker )
+                {
+                    m_image.SetOption(wxIMAGE_OPTION_RESOLUTIONX, m_cinfo.X_density);
+                    m_image.SetOption(wxIMAGE_OPTION_RESOLUTIONY, m_cinfo.Y_density);
+                    m_image.SetOption(wxIMAGE_OPTION_RESOLUTIONUNIT, m_cinfo.density_unit);
+                }
+
+                m_row = (*m_cinfo.mem->alloc_sarray)
+                            ((j_common_ptr) &m_cinfo, JPOOL_IMAGE,
+                             m_cinfo.output_width * m_cinfo.output_components, 1);
+
+                m_stage = m_cinfo.buffered_image ? Stage_StartOutput
+                                                 : Stage_ReadScanlines;
+                break;
+
+            case Stage_StartOutput:
+                {
+                    // Absorb all the available input before outputting it.
+                    int rc;
+                    do
+                    {
+                        rc = jpeg_consume_input(&m_cinfo);
+                    } while ( rc != JPEG_SUSPENDED && rc != JPEG_REACHED_EOI );
+
+                    // Don't waste time on redisplaying the same scan.
+                    m_finalPass = jpeg_input_complete(&m_cinfo) != FALSE;
+                    if ( !m_finalPass && m_cinfo.input_scan_number == m_lastScan )
+                        return true;
+
+                    if ( !jpeg_start_output(&m_cinfo, m_cinfo.input_scan_number) )
+                        return true;
+
+                    m_lastScan = m_cinfo.input_scan_number;
+                    m_stage = Stage_ReadScanlines;
+                }
+                break;
+
+            case Stage_ReadScanlines:
+                while ( m_cinfo.output_scanline < m_cinfo.output_height )
+                {
+                    if ( jpeg_read_scanlines(&m_cinfo, m_row, 1) != 1 )
+                        return true;
+
+                    StoreRow();
+                }
+
+                m_stage = m_cinfo.buffered_image ? Stage_FinishOutput
+                                                 : Stage_FinishDecompress;
+                break;
+
+            case Stage_FinishOutput:
+                if ( !jpeg_finish_output(&m_cinfo) )
+                    return true;
+
+                m_pass++;
+                m_stage = m_finalPass ? Stage_FinishDecompress
+                                      : Stage_StartOutput;
+                break;
+
+            case Stage_FinishDecompress:
+                if ( !jpeg_finish_decompress(&m_cinfo) )
+                    return true;
+
+                SetDone();
+                m_stage = Stage_Done;
+                wxFALLTHROUGH;
+
+            case Stage_Done:
+                return true;
+        }
+    }
+}
+
+void wxJPEGIncrementalDecoder::StoreRow()
+{
+    const int y = m_cinfo.output_scanline - 1;
+    const unsigned width = m_cinfo.output_width;
+
+    unsigned char* ptr = m_image.GetData() + y * width * 3;
+    if ( m_cinfo.out_color_space == JCS_RGB )
+    {
+        memcpy(ptr, m_row[0], width * 3);
+    }
+    else // CMYK
+    {
+        const unsigned char* inptr = (const unsigned char*) m_row[0];
+        for ( unsigned i = 0; i < width; i++ )
+        {
+            wx_cmyk_to_rgb(ptr, inptr);
+            ptr += 3;
+            inptr += 4;
+        }
+    }
+
+    AddDecodedRows(y, 1, m_pass);
+}
+
+} // anonymous namespace
+
+wxImageIncrementalDecoder* wxJPEGHandler::CreateIncrementalDecoder() const
+{
+    return new wxJPEGIncrementalDecoder();
+}
+
 typedef struct {
     struct jpeg_destination_mgr pub;
 
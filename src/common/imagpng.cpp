@@ -109,6 +109,7 @@ struct wxPNGImageData
     {
         lines = nullptr;
         m_buf = nullptr;
+        m_row = nullptr;
         info_ptr = (png_infop) nullptr;
         png_ptr = (png_structp) nullptr;
         ok = false;
@@ -144,6 +145,7 @@ struct wxPNGImageData
     ~wxPNGImageData()
     {
         free(m_buf);
+        free(m_row);
         free( lines );
 
         if ( png_ptr )
@@ -155,10 +157,12 @@ struct wxPNGImageData
         }
     }
 
-    void DoLoadPNGFile(wxImage* image, wxPNGInfoStruct& wxinfo);
+    void DoLoadPNGFile(wxImage* image, wxPNGInfoStruct& wxinfo,
+                       unsigned maxWidth, unsigned maxHeight);
 
     unsigned char** lines;
     unsigned char* m_buf;
+    unsigned char* m_row;
     png_infop info_ptr;
     png_structp png_ptr;
     bool ok;
@@ -283,68 +287,16 @@ void CopyDataFromPNG(wxImage *image,
     }
 }
 
-// temporarily disable the warning C4611 (interaction between '_setjmp' and
-// C++ object destruction is non-portable) - I don't see any dtors here
-#ifdef __VISUALC__
-    #pragma warning(disable:4611)
-#endif /* VC++ */
-
-// This function uses wxPNGImageData to store some of its "local" variables in
-// order to avoid clobbering these variables by longjmp(): having them inside
-// the stack frame of the caller prevents this from happening. It also
-// "returns" its result via wxPNGImageData: use its "ok" field to check
-// whether loading succeeded or failed.
-void
-wxPNGImageData::DoLoadPNGFile(wxImage* image, wxPNGInfoStruct& wxinfo)
+// set the image palette and options from the PNG data available after
+// reading all of it
+//
+// colorType must be the colour type from the IHDR chunk, as the one returned
+// by png_get_color_type() is changed by png_read_update_info() to take into
+// account the transformations, such as png_set_expand(), used.
+static
+void SetImageOptionsFromPNG(wxImage *image, png_structp png_ptr, png_infop info_ptr,
+                            int colorType)
 {
-    png_uint_32 width, height = 0;
-    int bit_depth, color_type;
-
-    image->Destroy();
-
-    png_ptr = png_create_read_struct
-                          (
-                            PNG_LIBPNG_VER_STRING,
-                            nullptr,
-                            wx_PNG_error,
-                            wx_PNG_warning
-                          );
-    if (!png_ptr)
-        return;
-
-    // NB: please see the comment near wxPNGInfoStruct declaration for
-    //     explanation why this line is mandatory
-    png_set_read_fn( png_ptr, &wxinfo, wx_PNG_stream_reader);
-
-    info_ptr = png_create_info_struct( png_ptr );
-    if (!info_ptr)
-        return;
-
-    if (setjmp(wxinfo.jmpbuf))
-        return;
-
-    png_read_info( png_ptr, info_ptr );
-    png_get_IHDR( png_ptr, info_ptr, &width, &height, &bit_depth, &color_type, nullptr, nullptr, nullptr );
-
-    png_set_expand(png_ptr);
-    png_set_gray_to_rgb(png_ptr);
-    png_set_strip_16( png_ptr );
-    png_set_packing( png_ptr );
-
-    image->Create((int)width, (int)height, (bool) false /* no need to init pixels */);
-
-    if (!image->IsOk())
-        return;
-
-    const bool needCopy =
-        (color_type & PNG_COLOR_MASK_ALPHA) ||
-        png_get_valid(png_ptr, info_ptr, PNG_INFO_tRNS);
-
-    if (!Alloc(width, height, needCopy ? nullptr : image->GetData()))
-        return;
-
-    png_read_image( png_ptr, lines );
-
     // load "Description" text chunk
     png_textp text_ptr;
     const int num_comments = png_get_text( png_ptr, info_ptr, &text_ptr, nullptr );
@@ -378,10 +330,8 @@ wxPNGImageData::DoLoadPNGFile(wxImage* image, wxPNGInfoStruct& wxinfo)
         }
     }
 
-    png_read_end( png_ptr, info_ptr );
-
 #if wxUSE_PALETTE
-    if (color_type == PNG_COLOR_TYPE_PALETTE)
+    if (colorType == PNG_COLOR_TYPE_PALETTE)
     {
         png_colorp palette = nullptr;
         int numPalette = 0;
@@ -445,11 +395,145 @@ wxPNGImageData::DoLoadPNGFile(wxImage* image, wxPNGInfoStruct& wxinfo)
 
         image->SetOption(wxIMAGE_OPTION_RESOLUTIONUNIT, res);
     }
+}
+
+// temporarily disable the warning C4611 (interaction between '_setjmp' and
+// C++ object destruction is non-portable) - I don't see any dtors here
+#ifdef __VISUALC__
+    #pragma warning(disable:4611)
+#endif /* VC++ */
+
+// This function uses wxPNGImageData to store some of its "local" variables in
+// order to avoid clobbering these variables by longjmp(): having them inside
+// the stack frame of the caller prevents this from happening. It also
+// "returns" its result via wxPNGImageData: use its "ok" field to check
+// whether loading succeeded or failed.
+void
+wxPNGImageData::DoLoadPNGFile(wxImage* image, wxPNGInfoStruct& wxinfo,
+                              unsigned maxWidth, unsigned maxHeight)
+{
+    png_uint_32 width, height = 0;
+    int bit_depth, color_type;
+
+    image->Destroy();
+
+    png_ptr = png_create_read_struct
+                          (
+                            PNG_LIBPNG_VER_STRING,
+                            nullptr,
+                            wx_PNG_error,
+                            wx_PNG_warning
+                          );
+    if (!png_ptr)
+        return;
+
+    // NB: please see the comment near wxPNGInfoStruct declaration for
+    //     explanation why this line is mandatory
+    png_set_read_fn( png_ptr, &wxinfo, wx_PNG_stream_reader);
+
+    info_ptr = png_create_info_struct( png_ptr );
+    if (!info_ptr)
+        return;
+
+    if (setjmp(wxinfo.jmpbuf))
+        return;
+
+    png_read_info( png_ptr, info_ptr );
+    png_get_IHDR( png_ptr, info_ptr, &width, &height, &bit_depth, &color_type, nullptr, nullptr, nullptr );
+
+    png_set_expand(png_ptr);
+    png_set_gray_to_rgb(png_ptr);
+    png_set_strip_16( png_ptr );
+    png_set_packing( png_ptr );
+
+    // If the image is interlaced and needs to be scaled down anyhow, we don't
+    // need to decode all of it: the first Adam7 passes contain all the pixels
+    // with both coordinates multiple of 8 (pass 1), 4 (passes 1-3) or 2
+    // (passes 1-5), so we can just read them and stop.
+    png_uint_32 scale = 1;
+    if ( (maxWidth || maxHeight) &&
+            png_get_interlace_type(png_ptr, info_ptr) == PNG_INTERLACE_ADAM7 )
+    {
+        // this uses the same (trivial) algorithm as the JPEG handler
+        while ( scale < 8 &&
+                    ((maxWidth && (width + scale - 1) / scale > maxWidth) ||
+                     (maxHeight && (height + scale - 1) / scale > maxHeight)) )
+        {
+            scale *= 2;
+        }
+    }
+
+    const png_uint_32 widthScaled = (width + scale - 1) / scale,
+                      heightScaled = (height + scale - 1) / scale;
+
+    image->Create((int)widthScaled, (int)heightScaled, (bool) false /* no need to init pixels */);
+
+    if (!image->IsOk())
+        return;
+
+    const bool needCopy =
+        (color_type & PNG_COLOR_MASK_ALPHA) ||
+        png_get_valid(png_ptr, info_ptr, PNG_INFO_tRNS);
+
+    if (!Alloc(widthScaled, heightScaled, needCopy ? nullptr : image->GetData()))
+        return;
+
+    if ( scale == 1 )
+    {
+        png_read_image( png_ptr, lines );
+
+        png_read_end( png_ptr, info_ptr );
+    }
+    else
+    {
+        // Note that we don't call png_set_interlace_handling() here, so that
+        // png_read_row() returns the rows of the reduced image of each pass.
+        png_read_update_info( png_ptr, info_ptr );
+
+        m_row = static_cast<unsigned char*>(malloc(png_get_rowbytes(png_ptr, info_ptr)));
+        if (!m_row)
+            return;
+
+        const int numPasses = scale == 8 ? 1 : scale == 4 ? 3 : 5;
+        const size_t bpp = needCopy ? 4 : 3;
+
+        for ( int pass = 0; pass < numPasses; pass++ )
+        {
+            const png_uint_32 passWidth = PNG_PASS_COLS(width, pass),
+                              passHeight = PNG_PASS_ROWS(height, pass);
+
+            // libpng skips the empty passes entirely
+            if ( !passWidth || !passHeight )
+                continue;
+
+            for ( png_uint_32 j = 0; j < passHeight; j++ )
+            {
+                png_read_row( png_ptr, m_row, nullptr );
+
+                unsigned char* const
+                    dst = lines[PNG_ROW_FROM_PASS_ROW(j, pass) / scale];
+                const unsigned char* src = m_row;
+                for ( png_uint_32 i = 0; i < passWidth; i++, src += bpp )
+                {
+                    memcpy(dst + (PNG_COL_FROM_PASS_COL(i, pass) / scale)*bpp,
+                           src, bpp);
+                }
+            }
+        }
+
+        // There is no need to read the rest of the image data, so we don't
+        // call png_read_end() either, which means that the text chunks
+        // following the image data, if any, are not read.
+
+        image->SetOption(wxIMAGE_OPTION_ORIGINAL_WIDTH, (int)width);
+        image->SetOption(wxIMAGE_OPTION_ORIGINAL_HEIGHT, (int)height);
+    }
 
+    SetImageOptionsFromPNG(image, png_ptr, info_ptr, color_type);
 
     // loaded successfully, now init wxImage with this data
     if (needCopy)
-        CopyDataFromPNG(image, lines, width, height);
+        CopyDataFromPNG(image, lines, widthScaled, heightScaled);
 
     // This will indicate to the caller that loading succeeded.
     ok = true;
@@ -461,12 +545,16 @@ wxPNGHandler::LoadFile(wxImage *image,
                        bool verbose,
                        int WXUNUSED(index))
 {
+    // save these options as DoLoadPNGFile() destroys the image
+    const unsigned maxWidth = image->GetOptionInt(wxIMAGE_OPTION_MAX_WIDTH),
+                   maxHeight = image->GetOptionInt(wxIMAGE_OPTION_MAX_HEIGHT);
+
     wxPNGInfoStruct wxinfo;
     wxinfo.verbose = verbose;
     wxinfo.stream.in = &stream;
 
     wxPNGImageData data;
-    data.DoLoadPNGFile(image, wxinfo);
+    data.DoLoadPNGFile(image, wxinfo, maxWidth, maxHeight);
 
     if ( !data.ok )
     {
@@ -486,6 +574,265 @@ wxPNGHandler::LoadFile(wxImage *image,
     return true;
 }
 
+// ----------------------------------------------------------------------------
+// incremental decoding
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+class wxPNGIncrementalDecoder;
+
+// This struct is used as io_ptr of png_struct, as libpng progressive reader
+// uses the same pointer for it and for the progressive callbacks data, so it
+// must derive from wxPNGInfoStruct for wx_PNG_error() to work.
+struct wxPNGIncrementalInfo : wxPNGInfoStruct
+{
+    wxPNGIncrementalDecoder* decoder;
+};
+
+class wxPNGIncrementalDecoder : public wxImageIncrementalDecoder
+{
+public:
+    wxPNGIncrementalDecoder();
+    virtual ~wxPNGIncrementalDecoder() override;
+
+    // Callbacks called from libpng.
+    void OnInfo();
+    void OnRow(png_bytep row, png_uint_32 rowNum, int pass);
+    void OnEnd();
+
+protected:
+    virtual bool DoFeed(const unsigned char* data, size_t len, bool finish) override;
+
+private:
+    // Process the data, using setjmp(), so there must be no objects with
+    // non-trivial dtors in this function.
+    bool DoProcessData(const unsigned char* data, size_t len);
+
+    wxPNGIncrementalInfo m_info;
+
+    png_structp m_png_ptr = nullptr;
+    png_infop m_info_ptr = nullptr;
+
+    // Number of channels in the rows returned by libpng, 3 or 4.
+    int m_channels = 0;
+
+    // Colour type of the image before applying any transformations to it.
+    int m_colorType = 0;
+
+    // All the rows for the interlaced images, which are combined from several
+    // passes, or just a single row for the other ones.
+    wxVector<unsigned char> m_rows;
+    bool m_interlaced = false;
+};
+
+} // anonymous namespace
+
+extern "C"
+{
+
+static wxPNGIncrementalDecoder* GetPNGDecoder(png_structp png_ptr)
+{
+    return static_cast<wxPNGIncrementalInfo*>(
+            static_cast<wxPNGInfoStruct*>(png_get_progressive_ptr(png_ptr)))
+                ->decoder;
+}
+
+static void PNGLINKAGEMODE wx_PNG_info_callback(png_structp png_ptr,
+                                                png_infop WXUNUSED(info_ptr))
+{
+    GetPNGDecoder(png_ptr)->OnInfo();
+}
+
+static void PNGLINKAGEMODE wx_PNG_row_callback(png_structp png_ptr,
+                                               png_bytep new_row,
+                                               png_uint_32 row_num,
+                                               int pass)
+{
+    GetPNGDecoder(png_ptr)->OnRow(new_row, row_num, pass);
+}
+
+static void PNGLINKAGEMODE wx_PNG_end_callback(png_structp png_ptr,
+                                               png_infop WXUNUSED(info_ptr))
+{
+    GetPNGDecoder(png_ptr)->OnEnd();
+}
+
+} // extern "C"
+
+wxPNGIncrementalDecoder::wxPNGIncrementalDecoder()
+{
+    m_info.verbose = true;
+    m_info.stream.in = nullptr;
+    m_info.decoder = this;
+}
+
+wxPNGIncrementalDecoder::~wxPNGIncrementalDecoder()
+{
+    if ( m_png_ptr )
+        png_destroy_read_struct(&m_png_ptr, &m_info_ptr, (png_infopp) nullptr);
+}
+
+bool
+wxPNGIncrementalDecoder::DoFeed(const unsigned char* data, size_t len, bool finish)
+{
+    // There is nothing we can do with the truncated PNG images.
+    if ( finish )
+        return true;
+
+    if ( !m_png_ptr )
+    {
+        m_info.verbose = IsVerbose();
+
+        m_png_ptr = png_create_read_struct
+                    (
+                        PNG_LIBPNG_VER_STRING,
+                        nullptr,
+                        wx_PNG_error,
+                        wx_PNG_warning
+                    );
+        if ( !m_png_ptr )
+            return false;
+
+        m_info_ptr = png_create_info_struct(m_png_ptr);
+        if ( !m_info_ptr )
+            return false;
+
+        // NB: please see the comment near wxPNGInfoStruct declaration for
+        //     explanation why the first parameter must be wxPNGInfoStruct
+        png_set_progressive_read_fn(m_png_ptr,
+                                    static_cast<wxPNGInfoStruct*>(&m_info),
+                                    wx_PNG_info_callback,
+                                    wx_PNG_row_callback,
+                                    wx_PNG_end_callback);
+    }
+
+    return DoProcessData(data, len);
+}
+
+bool
+wxPNGIncrementalDecoder::DoProcessData(const unsigned char* data, size_t len)
+{
+    if ( setjmp(m_info.jmpbuf) )
+        return false;
+
+    png_process_data(m_png_ptr, m_info_ptr,
+                     const_cast<png_bytep>(data), len);
+
+    return GetState() != State_Failed;
+}
+
+void wxPNGIncrementalDecoder::OnInfo()
+{
+    png_uint_32 width, height;
+    int bit_depth, color_type, interlace_type;
+    png_get_IHDR(m_png_ptr, m_info_ptr, &width, &height,
+                 &bit_depth, &color_type, &interlace_type, nullptr, nullptr);
+
+    m_colorType = color_type;
+
+    png_set_expand(m_png_ptr);
+    png_set_gray_to_rgb(m_png_ptr);
+    png_set_strip_16(m_png_ptr);
+    png_set_packing(m_png_ptr);
+
+    m_interlaced = interlace_type != PNG_INTERLACE_NONE;
+    if ( m_interlaced )
+        png_set_interlace_handling(m_png_ptr);
+
+    png_read_update_info(m_png_ptr, m_info_ptr);
+
+    m_channels = png_get_channels(m_png_ptr, m_info_ptr);
+
+    // Unlike wxPNGHandler::LoadFile(), we can't check if all pixels are
+    // opaque before creating the image, so always create alpha channel if
+    // the image may have transparency and remove it at the end if it turns
+    // out to be unnecessary.
+    //
+    // Also clear the interlaced images, as the rows are filled in gradually.
+    if ( !StartImage(width, height, m_channels == 4, m_interlaced) )
+        png_error(m_png_ptr, "failed to allocate image");
+
+    m_rows.resize(static_cast<size_t>(width) * m_channels
+                    * (m_interlaced ? height : 1));
+}
+
+void wxPNGIncrementalDecoder::OnRow(png_bytep row, png_uint_32 rowNum, int pass)
+{
+    // This happens for the rows not changed during this pass.
+    if ( !row )
+        return;
+
+    const int width = m_image.GetWidth();
+    const size_t rowSize = static_cast<size_t>(width) * m_channels;
+
+    unsigned char* src;
+    if ( m_interlaced )
+    {
+        src = &m_rows[rowNum * rowSize];
+        png_progressive_combine_row(m_png_ptr, src, row);
+    }
+    else
+    {
+        src = row;
+    }
+
+    unsigned char* dst = m_image.GetData() + rowNum * width * 3;
+    if ( m_channels == 4 )
+    {
+        unsigned char* alpha = m_image.GetAlpha() + rowNum * width;
+        for ( int x = 0; x < width; x++ )
+        {
+            *dst++ = *src++;
+            *dst++ = *src++;
+            *dst++ = *src++;
+            *alpha++ = *src++;
+        }
+    }
+    else
+    {
+        memcpy(dst, src, width * 3);
+    }
+
+    AddDecodedRows(rowNum, 1, pass);
+}
+
+void wxPNGIncrementalDecoder::OnEnd()
+{
+    SetImageOptionsFromPNG(&m_image, m_png_ptr, m_info_ptr, m_colorType);
+
+    if ( m_image.HasAlpha() )
+    {
+        const unsigned char* const alpha = m_image.GetAlpha();
+        const size_t count = static_cast<size_t>(m_image.GetWidth())
+                                * m_image.GetHeight();
+
+        bool allOpaque = true;
+        for ( size_t n = 0; n < count; n++ )
+        {
+            if ( !IsOpaque(alpha[n]) )
+            {
+                allOpaque = false;
+                break;
+            }
+        }
+
+        if ( allOpaque )
+            m_image.ClearAlpha();
+    }
+
+    // Free the memory used for combining passes, it's not needed any more.
+    wxVector<unsigned char>().swap(m_rows);
+
+    SetDone();
+}
+
+wxImageIncrementalDecoder* wxPNGHandler::CreateIncrementalDecoder() const
+{
+    return new wxPNGIncrementalDecoder();
+}
+
 // ----------------------------------------------------------------------------
 // SaveFile() palette helpers
 // ----------------------------------------------------------------------------
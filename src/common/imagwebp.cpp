@@ -38,6 +38,7 @@ wxIMPLEMENT_DYNAMIC_CLASS(wxWEBPHandler, wxImageHandler);
 
 #include <memory>
 #include <functional>
+#include <vector>
 
 namespace
 {
@@ -45,7 +46,65 @@ typedef std::unique_ptr<WebPDemuxer, std::function<void(WebPDemuxer*)>> WebPDemu
 typedef std::unique_ptr<WebPAnimDecoder, std::function<void(WebPAnimDecoder*)>> WebPAnimDecoderPtr;
 typedef std::unique_ptr<uint8_t, std::function<void(uint8_t*)>> WebPDecodeRGBAPtr;
 
-bool DecodeWebPDataIntoImage(wxImage* image, WebPData* webp_data, bool verbose)
+// Decode the image scaled down to the given size using libwebp built-in
+// scaler, which is much faster than decoding it at full size and rescaling it.
+bool DecodeScaledWebPDataIntoImage(wxImage* image,
+                                   WebPData* webp_data,
+                                   bool hasAlpha,
+                                   bool verbose)
+{
+    WebPDecoderConfig config;
+    if (!WebPInitDecoderConfig(&config))
+        return false;
+
+    const int width = image->GetWidth(),
+              height = image->GetHeight();
+
+    config.options.use_scaling = 1;
+    config.options.scaled_width = width;
+    config.options.scaled_height = height;
+
+    // Decode RGB data directly into the image buffer, but RGBA data still
+    // needs to be re-ordered, so use an intermediate buffer for it.
+    std::vector<uint8_t> rgba;
+    WebPRGBABuffer& output = config.output.u.RGBA;
+    config.output.is_external_memory = 1;
+    if (hasAlpha)
+    {
+        config.output.colorspace = MODE_RGBA;
+        output.stride = width * 4;
+        output.size = (size_t)output.stride * height;
+        rgba.resize(output.size);
+        output.rgba = rgba.data();
+    }
+    else
+    {
+        config.output.colorspace = MODE_RGB;
+        output.stride = width * 3;
+        output.size = (size_t)output.stride * height;
+        output.rgba = image->GetData();
+    }
+
+    const VP8StatusCode status = WebPDecode(webp_data->bytes, webp_data->size, &config);
+    WebPFreeDecBuffer(&config.output);
+
+    if (status != VP8_STATUS_OK)
+    {
+        if (verbose)
+        {
+            wxLogError(_("WebP: Decoding scaled image data failed."));
+        }
+        return false;
+    }
+
+    if (hasAlpha)
+        image->SetDataRGBA(rgba.data());
+
+    return true;
+}
+
+bool DecodeWebPDataIntoImage(wxImage* image, WebPData* webp_data, bool verbose,
+                             unsigned maxWidth = 0, unsigned maxHeight = 0)
 {
     WebPBitstreamFeatures features;
     VP8StatusCode status = WebPGetFeatures(webp_data->bytes, webp_data->size, &features);
@@ -58,6 +117,36 @@ bool DecodeWebPDataIntoImage(wxImage* image, WebPData* webp_data, bool verbose)
         return false;
     }
 
+    // this uses the same (trivial) algorithm as the JPEG handler
+    unsigned width = features.width,
+             height = features.height;
+    while ( (maxWidth && width > maxWidth) ||
+                (maxHeight && height > maxHeight) )
+    {
+        width /= 2;
+        height /= 2;
+    }
+
+    const bool scaled = width != (unsigned)features.width ||
+                            height != (unsigned)features.height;
+    if (scaled && width && height)
+    {
+        if (!image->Create(width, height, false))
+        {
+            if (verbose)
+            {
+                wxLogError(_("WebP: Allocating image memory failed."));
+            }
+            return false;
+        }
+        image->SetOption(wxIMAGE_OPTION_WEBP_FORMAT, features.format);
+        image->SetOption(wxIMAGE_OPTION_ORIGINAL_WIDTH, features.width);
+        image->SetOption(wxIMAGE_OPTION_ORIGINAL_HEIGHT, features.height);
+
+        return DecodeScaledWebPDataIntoImage(image, webp_data,
+                                             features.has_alpha != 0, verbose);
+    }
+
     if (!image->Create(features.width, features.height, false))
     {
         if (verbose)
@@ -141,6 +230,10 @@ bool wxWEBPHandler::LoadFile(wxImage* image, wxInputStream& stream, bool verbose
     if (image == nullptr)
         return false;
 
+    // save these options before calling Destroy()
+    const unsigned maxWidth = image->GetOptionInt(wxIMAGE_OPTION_MAX_WIDTH),
+                   maxHeight = image->GetOptionInt(wxIMAGE_OPTION_MAX_HEIGHT);
+
     bool ok = false;
     image->Destroy();
 
@@ -165,7 +258,8 @@ bool wxWEBPHandler::LoadFile(wxImage* image, wxInputStream& stream, bool verbose
             WebPIterator iter;
             if (WebPDemuxGetFrame(demux.get(), index + 1, &iter))
             {
-                ok = DecodeWebPDataIntoImage(image, &iter.fragment, verbose);
+                ok = DecodeWebPDataIntoImage(image, &iter.fragment, verbose,
+                                             maxWidth, maxHeight);
                 WebPDemuxReleaseIterator(&iter);
             }
         }
@@ -0,0 +1,703 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        src/common/staticformat.cpp
+// Purpose:     Run-time part of formatting using compile-time format strings
+// Author:      wxWidgets team
+// Created:     2026-10-17
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+// For compilers that support precompilation, includes "wx.h".
+#include "wx/wxprec.h"
+
+#include "wx/staticformat.h"
+
+#include "wx/math.h"
+#include "wx/private/unicode.h"
+
+#include <locale.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <cmath>
+#include <vector>
+
+#if wxHAS_CXX17_INCLUDE(<charconv>)
+    #include <charconv>
+
+    // Floating point overloads of std::to_chars() are not available in all
+    // standard library implementations supporting C++17.
+    #if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+        #define wxHAS_TO_CHARS_DOUBLE
+    #endif
+#endif
+
+using namespace wxPrivate;
+
+namespace
+{
+
+// ----------------------------------------------------------------------------
+// helpers for appending to the output string
+// ----------------------------------------------------------------------------
+
+// Append ASCII or, in UTF-8 build, UTF-8 string.
+inline void AppendRaw(wxStringImpl& out, const char* s, size_t len)
+{
+#if wxUSE_UNICODE_UTF8
+    out.append(s, len);
+#else
+    out.append(s, s + len);
+#endif
+}
+
+#if wxUSE_UNICODE_WCHAR
+inline void AppendRaw(wxStringImpl& out, const wchar_t* s, size_t len)
+{
+    out.append(s, len);
+}
+#endif // wxUSE_UNICODE_WCHAR
+
+inline void AppendString(wxStringImpl& out, const wxString& s)
+{
+#if wxUSE_UNICODE_UTF8
+    out.append(s.wx_str(), s.utf8_length());
+#else
+    out.append(s.wx_str(), s.length());
+#endif
+}
+
+// Append a string in the current locale encoding.
+void AppendNarrow(wxStringImpl& out, const char* s, size_t len)
+{
+    if ( wxGetASCIIPrefixLength(s, len) == len )
+        AppendRaw(out, s, len);
+    else
+        AppendString(out, wxString(s, wxConvLibc, len));
+}
+
+inline void AppendText(wxStringImpl& out, const char* s, size_t len, bool isAscii)
+{
+    if ( isAscii )
+        AppendRaw(out, s, len);
+    else
+        AppendString(out, wxString(s, wxConvLibc, len));
+}
+
+inline void AppendText(wxStringImpl& out, const wchar_t* s, size_t len, bool WXUNUSED(isAscii))
+{
+#if wxUSE_UNICODE_UTF8
+    AppendString(out, wxString(s, len));
+#else
+    out.append(s, len);
+#endif
+}
+
+// Return the number of padding characters needed for the field of the given
+// length in characters.
+inline size_t GetPadding(const StaticFormatItem& it, size_t len)
+{
+    return it.width > 0 && static_cast<size_t>(it.width) > len
+            ? static_cast<size_t>(it.width) - len
+            : 0;
+}
+
+// Append the string in the internal representation, or ASCII one, applying
+// the width and precision to it.
+template <typename CharT>
+void AppendField(wxStringImpl& out, const StaticFormatItem& it,
+                 const CharT* s, size_t len)
+{
+    size_t numChars = len;
+
+#if wxUSE_UNICODE_UTF8
+    // Precision and width are in characters, not bytes.
+    if ( it.precision >= 0 || it.width > 0 )
+    {
+        const size_t maxChars = it.precision >= 0
+                                    ? static_cast<size_t>(it.precision)
+                                    : len;
+        size_t bytes = 0;
+        numChars = 0;
+        for ( ; bytes < len; bytes++ )
+        {
+            if ( (static_cast<unsigned char>(s[bytes]) & 0xc0) != 0x80 )
+            {
+                if ( numChars == maxChars )
+                    break;
+
+                numChars++;
+            }
+        }
+
+        len = bytes;
+    }
+#else // wxUSE_UNICODE_WCHAR
+    if ( it.precision >= 0 && static_cast<size_t>(it.precision) < len )
+        numChars =
+        len = static_cast<size_t>(it.precision);
+#endif // wxUSE_UNICODE_UTF8/wxUSE_UNICODE_WCHAR
+
+    const size_t padding = GetPadding(it, numChars);
+
+    if ( !(it.flags & StaticFormat_Minus) )
+        out.append(padding, ' ');
+
+    AppendRaw(out, s, len);
+
+    if ( it.flags & StaticFormat_Minus )
+        out.append(padding, ' ');
+}
+
+void AppendField(wxStringImpl& out, const StaticFormatItem& it,
+                 const wxString& s)
+{
+#if wxUSE_UNICODE_UTF8
+    AppendField(out, it, s.wx_str(), s.utf8_length());
+#else
+    AppendField(out, it, s.wx_str(), s.length());
+#endif
+}
+
+// ----------------------------------------------------------------------------
+// conversions
+// ----------------------------------------------------------------------------
+
+const char digitPairs[] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+// Format an unsigned value, possibly preceded by the sign character.
+void
+FormatUnsigned(wxStringImpl& out, const StaticFormatItem& it,
+               unsigned long long value, char sign, bool forcePrefix = false)
+{
+    const bool isZero = value == 0;
+
+    char buf[32];
+    char* const end = buf + sizeof(buf);
+    char* p = end;
+
+    // Zero precision means that zero value is not output at all.
+    if ( !isZero || it.precision != 0 )
+    {
+        switch ( it.conv )
+        {
+            case 'o':
+                do
+                {
+                    *--p = static_cast<char>('0' + (value & 7));
+                    value >>= 3;
+                } while ( value );
+                break;
+
+            case 'x':
+            case 'X':
+                {
+                    const char* const digits = it.conv == 'x'
+                                                ? "0123456789abcdef"
+                                                : "0123456789ABCDEF";
+                    do
+                    {
+                        *--p = digits[value & 0xf];
+                        value >>= 4;
+                    } while ( value );
+                }
+                break;
+
+            default:
+                while ( value >= 100 )
+                {
+                    const size_t idx = static_cast<size_t>(value % 100)*2;
+                    value /= 100;
+                    *--p = digitPairs[idx + 1];
+                    *--p = digitPairs[idx];
+                }
+
+                if ( value >= 10 )
+                {
+                    const size_t idx = static_cast<size_t>(value)*2;
+                    *--p = digitPairs[idx + 1];
+                    *--p = digitPairs[idx];
+                }
+                else
+                {
+                    *--p = static_cast<char>('0' + value);
+                }
+        }
+    }
+
+    const size_t numDigits = end - p;
+
+    size_t zeros = it.precision > 0 && static_cast<size_t>(it.precision) > numDigits
+                    ? static_cast<size_t>(it.precision) - numDigits
+                    : 0;
+
+    char prefix[3];
+    size_t prefixLen = 0;
+    if ( sign )
+        prefix[prefixLen++] = sign;
+
+    if ( (it.flags & StaticFormat_Alt) || forcePrefix )
+    {
+        switch ( it.conv )
+        {
+            case 'o':
+                // Alternative form of octal numbers always starts with 0.
+                if ( !zeros && (!numDigits || *p != '0') )
+                    zeros = 1;
+                break;
+
+            case 'x':
+            case 'X':
+                if ( !isZero || forcePrefix )
+                {
+                    prefix[prefixLen++] = '0';
+                    prefix[prefixLen++] = it.conv;
+                }
+                break;
+        }
+    }
+
+    size_t padding = GetPadding(it, prefixLen + zeros + numDigits);
+
+    // Zero flag is ignored if the precision is specified.
+    if ( padding &&
+            (it.flags & (StaticFormat_Zero | StaticFormat_Minus)) == StaticFormat_Zero &&
+                it.precision < 0 )
+    {
+        zeros += padding;
+        padding = 0;
+    }
+
+    if ( !(it.flags & StaticFormat_Minus) )
+        out.append(padding, ' ');
+
+    AppendRaw(out, prefix, prefixLen);
+    out.append(zeros, '0');
+    AppendRaw(out, p, numDigits);
+
+    if ( it.flags & StaticFormat_Minus )
+        out.append(padding, ' ');
+}
+
+char GetSignChar(const StaticFormatItem& it, bool negative)
+{
+    if ( negative )
+        return '-';
+    if ( it.flags & StaticFormat_Plus )
+        return '+';
+    if ( it.flags & StaticFormat_Space )
+        return ' ';
+
+    return '\0';
+}
+
+void FormatInt(wxStringImpl& out, const StaticFormatItem& it,
+               const StaticFormatArg& arg)
+{
+    const bool isSigned = it.conv == 'd' || it.conv == 'i';
+
+    if ( it.intSize )
+    {
+        // As printf(), convert the value to short or char for "h" and "hh"
+        // modifiers, whatever its actual type is.
+        const unsigned bits = it.intSize*8;
+        const unsigned long long
+            raw = arg.kind == StaticFormatArg_UInt
+                    ? arg.u
+                    : static_cast<unsigned long long>(arg.i);
+        const unsigned long long value = raw & ((1ULL << bits) - 1);
+
+        if ( isSigned && (value >> (bits - 1)) )
+        {
+            // The value is negative, so output its absolute value.
+            FormatUnsigned(out, it, (1ULL << bits) - value,
+                           GetSignChar(it, true));
+        }
+        else
+        {
+            FormatUnsigned(out, it, value,
+                           isSigned ? GetSignChar(it, false) : '\0');
+        }
+        return;
+    }
+
+    if ( arg.kind == StaticFormatArg_UInt )
+    {
+        FormatUnsigned(out, it, arg.u,
+                       isSigned ? GetSignChar(it, false) : '\0');
+        return;
+    }
+
+    if ( isSigned )
+    {
+        const bool negative = arg.i < 0;
+        const unsigned long long value =
+            negative ? 0ULL - static_cast<unsigned long long>(arg.i)
+                     : static_cast<unsigned long long>(arg.i);
+
+        FormatUnsigned(out, it, value, GetSignChar(it, negative));
+    }
+    else
+    {
+        // As printf(), interpret negative values as unsigned values of the
+        // same size, but notice that the types smaller than int are promoted
+        // to it when they're passed to printf().
+        unsigned long long value = static_cast<unsigned long long>(arg.i);
+        const size_t size = wxMax(arg.size, sizeof(int));
+        if ( size < sizeof(value) )
+            value &= (1ULL << (size*8)) - 1;
+
+        FormatUnsigned(out, it, value, '\0');
+    }
+}
+
+void FormatChar(wxStringImpl& out, const StaticFormatItem& it,
+                const StaticFormatArg& arg)
+{
+    const unsigned long value = arg.kind == StaticFormatArg_Int
+                                    ? static_cast<unsigned long>(arg.i)
+                                    : static_cast<unsigned long>(arg.u);
+
+    // Single byte characters are in the current locale encoding.
+    wxString str;
+    if ( arg.size == 1 )
+    {
+        const char c = static_cast<char>(value);
+        if ( static_cast<unsigned char>(c) < 0x80 )
+        {
+            str = c;
+        }
+        else
+        {
+            // Don't use wxUniChar ctor which asserts if the character is
+            // invalid in the current encoding, just don't output anything
+            // for it in this case, as vsnprintf() does.
+            str = wxString(&c, wxConvLibc, 1);
+            if ( str.empty() )
+                return;
+        }
+    }
+    else
+    {
+        str = wxUniChar(value);
+    }
+
+    const size_t padding = GetPadding(it, 1);
+
+    if ( !(it.flags & StaticFormat_Minus) )
+        out.append(padding, ' ');
+
+    AppendString(out, str);
+
+    if ( it.flags & StaticFormat_Minus )
+        out.append(padding, ' ');
+}
+
+void FormatString(wxStringImpl& out, const StaticFormatItem& it,
+                  const StaticFormatArg& arg)
+{
+    if ( !arg.p )
+    {
+        AppendField(out, it, "(null)", 6);
+        return;
+    }
+
+    switch ( arg.kind )
+    {
+        case StaticFormatArg_NarrowStr:
+            {
+                const char* const s = static_cast<const char*>(arg.p);
+                const size_t len = arg.len == wxString::npos ? strlen(s)
+                                                             : arg.len;
+
+                if ( wxGetASCIIPrefixLength(s, len) == len )
+                    AppendField(out, it, s, len);
+                else
+                    AppendField(out, it, wxString(s, wxConvLibc, len));
+            }
+            break;
+
+        case StaticFormatArg_WideStr:
+            {
+                const wchar_t* const s = static_cast<const wchar_t*>(arg.p);
+                const size_t len = arg.len == wxString::npos ? wcslen(s)
+                                                             : arg.len;
+
+#if wxUSE_UNICODE_UTF8
+                AppendField(out, it, wxString(s, len));
+#else
+                AppendField(out, it, s, len);
+#endif
+            }
+            break;
+
+        case StaticFormatArg_ImplStr:
+            {
+                const wxStringCharType* const
+                    s = static_cast<const wxStringCharType*>(arg.p);
+                const size_t len =
+                    arg.len == wxString::npos
+                        ? std::char_traits<wxStringCharType>::length(s)
+                        : arg.len;
+
+                AppendField(out, it, s, len);
+            }
+            break;
+
+        default:
+            wxFAIL_MSG( "unexpected argument kind for %s" );
+    }
+}
+
+// Format the value using the system snprintf(), this is only used for the
+// cases not handled by FormatDouble() and FormatPointer() themselves.
+template <typename T>
+void FormatUsingSystem(wxStringImpl& out, const StaticFormatItem& it, T value)
+{
+    char spec[32];
+    char* p = spec;
+    *p++ = '%';
+    if ( it.flags & StaticFormat_Minus )
+        *p++ = '-';
+    if ( it.flags & StaticFormat_Plus )
+        *p++ = '+';
+    if ( it.flags & StaticFormat_Space )
+        *p++ = ' ';
+    if ( it.flags & StaticFormat_Zero )
+        *p++ = '0';
+    if ( it.flags & StaticFormat_Alt )
+        *p++ = '#';
+    if ( it.width >= 0 )
+        p += sprintf(p, "%d", it.width);
+    if ( it.precision >= 0 )
+        p += sprintf(p, ".%d", it.precision);
+    *p++ = it.conv;
+    *p = '\0';
+
+    char buf[512];
+    const int len = snprintf(buf, sizeof(buf), spec, value);
+    if ( len < 0 )
+        return;
+
+    if ( static_cast<size_t>(len) < sizeof(buf) )
+    {
+        AppendNarrow(out, buf, len);
+    }
+    else
+    {
+        std::vector<char> big(len + 1);
+        snprintf(&big[0], big.size(), spec, value);
+        AppendNarrow(out, &big[0], len);
+    }
+}
+
+void FormatPointer(wxStringImpl& out, const StaticFormatItem& it,
+                   const StaticFormatArg& arg)
+{
+    // The output for the null pointer is implementation-defined, e.g. glibc
+    // uses "(nil)" for it, so let the system format it.
+    if ( !arg.p )
+    {
+        FormatUsingSystem(out, it, arg.p);
+        return;
+    }
+
+    StaticFormatItem itHex = it;
+    itHex.conv = 'x';
+
+    FormatUnsigned(out, itHex, wxPtrToUInt(arg.p), '\0', true /* prefix */);
+}
+
+void FormatDouble(wxStringImpl& out, const StaticFormatItem& it,
+                  const StaticFormatArg& arg)
+{
+    const double value = arg.d;
+
+#ifdef wxHAS_TO_CHARS_DOUBLE
+    // Only handle the most common cases here, the alternative form, the
+    // hexadecimal format and special values are handled by the system.
+    std::chars_format fmt;
+    switch ( it.conv )
+    {
+        case 'f':
+        case 'F':
+            fmt = std::chars_format::fixed;
+            break;
+
+        case 'e':
+        case 'E':
+            fmt = std::chars_format::scientific;
+            break;
+
+        case 'g':
+        case 'G':
+            fmt = std::chars_format::general;
+            break;
+
+        default:
+            FormatUsingSystem(out, it, value);
+            return;
+    }
+
+    if ( (it.flags & StaticFormat_Alt) || !wxFinite(value) )
+    {
+        FormatUsingSystem(out, it, value);
+        return;
+    }
+
+    const int precision = it.precision >= 0 ? it.precision : 6;
+
+    char buf[512];
+    const std::to_chars_result
+        res = std::to_chars(buf, buf + sizeof(buf), std::fabs(value), fmt, precision);
+    if ( res.ec != std::errc() )
+    {
+        // The number is too long for the buffer.
+        FormatUsingSystem(out, it, value);
+        return;
+    }
+
+    size_t len = res.ptr - buf;
+
+    if ( it.conv == 'E' || it.conv == 'G' )
+    {
+        for ( char* p = buf; p != res.ptr; ++p )
+        {
+            if ( *p == 'e' )
+                *p = 'E';
+        }
+    }
+
+    // As printf(), use the decimal separator of the current locale.
+    const char* const point = localeconv()->decimal_point;
+    const char* const dot = static_cast<const char*>(memchr(buf, '.', len));
+    const bool replacePoint = dot && point && strcmp(point, ".") != 0;
+    if ( replacePoint && (strlen(point) != 1 || (*point & 0x80)) )
+    {
+        // Handling non-ASCII separators here is not worth it.
+        FormatUsingSystem(out, it, value);
+        return;
+    }
+
+    if ( replacePoint )
+        buf[dot - buf] = *point;
+
+    const char sign = GetSignChar(it, std::signbit(value));
+
+    size_t padding = GetPadding(it, len + (sign ? 1 : 0));
+    size_t zeros = 0;
+    if ( padding &&
+            (it.flags & (StaticFormat_Zero | StaticFormat_Minus)) == StaticFormat_Zero )
+    {
+        zeros = padding;
+        padding = 0;
+    }
+
+    if ( !(it.flags & StaticFormat_Minus) )
+        out.append(padding, ' ');
+
+    if ( sign )
+        out += sign;
+
+    out.append(zeros, '0');
+    AppendRaw(out, buf, len);
+
+    if ( it.flags & StaticFormat_Minus )
+        out.append(padding, ' ');
+#else // !wxHAS_TO_CHARS_DOUBLE
+    FormatUsingSystem(out, it, value);
+#endif // wxHAS_TO_CHARS_DOUBLE/!wxHAS_TO_CHARS_DOUBLE
+}
+
+template <typename CharT>
+wxString
+DoFormat(const CharT* format, bool isAscii,
+         const StaticFormatItem* items, size_t count,
+         const StaticFormatArg* args)
+{
+    wxStringImpl out;
+
+    // Reserve enough space for the format string itself and, hopefully, for
+    // most of the arguments too.
+    const StaticFormatItem& last = items[count - 1];
+    out.reserve(last.textStart + last.textLen + 16*(count - 1));
+
+    for ( size_t n = 0; n < count; n++ )
+    {
+        const StaticFormatItem& it = items[n];
+        if ( it.textLen )
+            AppendText(out, format + it.textStart, it.textLen, isAscii);
+
+        switch ( it.conv )
+        {
+            case '\0':
+                break;
+
+            case '%':
+                out += '%';
+                break;
+
+            case 'd':
+            case 'i':
+            case 'u':
+            case 'o':
+            case 'x':
+            case 'X':
+                FormatInt(out, it, args[it.arg]);
+                break;
+
+            case 'c':
+                FormatChar(out, it, args[it.arg]);
+                break;
+
+            case 's':
+                FormatString(out, it, args[it.arg]);
+                break;
+
+            case 'p':
+                FormatPointer(out, it, args[it.arg]);
+                break;
+
+            default:
+                FormatDouble(out, it, args[it.arg]);
+        }
+    }
+
+#if wxUSE_UNICODE_UTF8
+    return wxString::FromUTF8Unchecked(std::move(out));
+#else
+    return wxString(std::move(out));
+#endif
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// implementation
+// ============================================================================
+
+namespace wxPrivate
+{
+
+wxString
+DoStaticFormat(const char* format, bool isAscii,
+               const StaticFormatItem* items, size_t count,
+               const StaticFormatArg* args)
+{
+    return DoFormat(format, isAscii, items, count, args);
+}
+
+wxString
+DoStaticFormat(const wchar_t* format, bool isAscii,
+               const StaticFormatItem* items, size_t count,
+               const StaticFormatArg* args)
+{
+    return DoFormat(format, isAscii, items, count, args);
+}
+
+} // namespace wxPrivate
@@ -943,6 +943,157 @@ extern const unsigned char tableUtf8Lengths[256] = {
                    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0   // F5..FF
 };
 
+// Convert the ASCII characters at the beginning of the given UTF-8 string of
+// the given length to the wide string, which may be null if we're only
+// computing the length, and return their number.
+static size_t wxWidenASCIIPrefix(wchar_t *dst, const char *src, size_t len)
+{
+    if ( !dst )
+        return wxGetASCIIPrefixLength(src, len);
+
+    size_t n = 0;
+
+#if defined(wxHAS_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for ( ; n + 16 <= len; n += 16 )
+    {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + n));
+        if ( _mm_movemask_epi8(v) )
+            break;
+
+        const __m128i lo = _mm_unpacklo_epi8(v, zero);
+        const __m128i hi = _mm_unpackhi_epi8(v, zero);
+
+        __m128i* const out = reinterpret_cast<__m128i*>(dst + n);
+#ifdef WC_UTF16
+        _mm_storeu_si128(out, lo);
+        _mm_storeu_si128(out + 1, hi);
+#else
+        _mm_storeu_si128(out, _mm_unpacklo_epi16(lo, zero));
+        _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(lo, zero));
+        _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(hi, zero));
+        _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(hi, zero));
+#endif
+    }
+#elif defined(wxHAS_NEON)
+    for ( ; n + 16 <= len; n += 16 )
+    {
+        const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(src + n));
+        if ( vmaxvq_u8(v) & 0x80 )
+            break;
+
+        const uint16x8_t lo = vmovl_u8(vget_low_u8(v));
+        const uint16x8_t hi = vmovl_u8(vget_high_u8(v));
+
+#ifdef WC_UTF16
+        uint16_t* const out = reinterpret_cast<uint16_t*>(dst + n);
+        vst1q_u16(out, lo);
+        vst1q_u16(out + 8, hi);
+#else
+        uint32_t* const out = reinterpret_cast<uint32_t*>(dst + n);
+        vst1q_u32(out, vmovl_u16(vget_low_u16(lo)));
+        vst1q_u32(out + 4, vmovl_u16(vget_high_u16(lo)));
+        vst1q_u32(out + 8, vmovl_u16(vget_low_u16(hi)));
+        vst1q_u32(out + 12, vmovl_u16(vget_high_u16(hi)));
+#endif
+    }
+#endif
+
+    for ( ; n < len; n++ )
+    {
+        const unsigned char c = src[n];
+        if ( c & 0x80 )
+            break;
+
+        dst[n] = c;
+    }
+
+    return n;
+}
+
+// Convert the ASCII characters at the beginning of the given wide string of
+// the given length to UTF-8, if dst is non-null, and return their number.
+static size_t wxNarrowASCIIPrefix(char *dst, const wchar_t *src, size_t len)
+{
+    size_t n = 0;
+
+#if defined(wxHAS_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for ( ; n + 16 <= len; n += 16 )
+    {
+        const __m128i* const in = reinterpret_cast<const __m128i*>(src + n);
+#ifdef WC_UTF16
+        const __m128i a = _mm_loadu_si128(in);
+        const __m128i b = _mm_loadu_si128(in + 1);
+        const __m128i nonASCII = _mm_and_si128(_mm_or_si128(a, b),
+                                               _mm_set1_epi16(~0x7f));
+#else
+        const __m128i a0 = _mm_loadu_si128(in);
+        const __m128i a1 = _mm_loadu_si128(in + 1);
+        const __m128i b0 = _mm_loadu_si128(in + 2);
+        const __m128i b1 = _mm_loadu_si128(in + 3);
+
+        // Check the original values and not the packed ones, as packing
+        // saturates them and so could make some of them look like ASCII.
+        const __m128i nonASCII = _mm_and_si128(
+                                    _mm_or_si128(_mm_or_si128(a0, a1),
+                                                 _mm_or_si128(b0, b1)),
+                                    _mm_set1_epi32(~0x7f));
+
+        const __m128i a = _mm_packs_epi32(a0, a1);
+        const __m128i b = _mm_packs_epi32(b0, b1);
+#endif
+        if ( _mm_movemask_epi8(_mm_cmpeq_epi8(nonASCII, zero)) != 0xffff )
+            break;
+
+        if ( dst )
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + n),
+                             _mm_packus_epi16(a, b));
+        }
+    }
+#elif defined(wxHAS_NEON)
+    for ( ; n + 16 <= len; n += 16 )
+    {
+#ifdef WC_UTF16
+        const uint16_t* const in = reinterpret_cast<const uint16_t*>(src + n);
+        const uint16x8_t a = vld1q_u16(in);
+        const uint16x8_t b = vld1q_u16(in + 8);
+        if ( vmaxvq_u16(vorrq_u16(a, b)) >= 0x80 )
+            break;
+#else
+        const uint32_t* const in = reinterpret_cast<const uint32_t*>(src + n);
+        const uint32x4_t a0 = vld1q_u32(in);
+        const uint32x4_t a1 = vld1q_u32(in + 4);
+        const uint32x4_t b0 = vld1q_u32(in + 8);
+        const uint32x4_t b1 = vld1q_u32(in + 12);
+        if ( vmaxvq_u32(vorrq_u32(vorrq_u32(a0, a1), vorrq_u32(b0, b1))) >= 0x80 )
+            break;
+
+        const uint16x8_t a = vcombine_u16(vmovn_u32(a0), vmovn_u32(a1));
+        const uint16x8_t b = vcombine_u16(vmovn_u32(b0), vmovn_u32(b1));
+#endif
+        if ( dst )
+        {
+            vst1q_u8(reinterpret_cast<uint8_t*>(dst + n),
+                     vcombine_u8(vmovn_u16(a), vmovn_u16(b)));
+        }
+    }
+#endif
+
+    for ( ; n < len; n++ )
+    {
+        const wxUint32 code = src[n];
+        if ( code >= 0x80 )
+            break;
+
+        if ( dst )
+            dst[n] = static_cast<char>(code);
+    }
+
+    return n;
+}
+
 size_t
 wxMBConvStrictUTF8::ToWChar(wchar_t *dst, size_t dstLen,
                             const char *src, size_t srcLen) const
@@ -975,6 +1126,28 @@ wxMBConvStrictUTF8::ToWChar(wchar_t *dst, size_t dstLen,
             return written;
         }
 
+        if ( !(*p & 0x80) )
+        {
+            // Convert the entire run of ASCII characters at once.
+            const size_t n = wxWidenASCIIPrefix(out, p,
+                                                out && dstLen < srcLen ? dstLen
+                                                                       : srcLen);
+            if ( n )
+            {
+                srcLen -= n;
+                written += n;
+                if ( out )
+                {
+                    out += n;
+                    dstLen -= n;
+                }
+
+                // The loop increments the pointer past the last character.
+                p += n - 1;
+                continue;
+            }
+        }
+
         if ( out && !dstLen-- )
             break;
 
@@ -1088,6 +1261,28 @@ wxMBConvStrictUTF8::FromWChar(char *dst, size_t dstLen,
             return written;
         }
 
+        if ( end && static_cast<wxUint32>(*wp) < 0x80 )
+        {
+            // Convert the entire run of ASCII characters at once.
+            size_t n = end - wp;
+            if ( out && dstLen < n )
+                n = dstLen;
+
+            n = wxNarrowASCIIPrefix(out, wp, n);
+            if ( n )
+            {
+                wp += n;
+                written += n;
+                if ( out )
+                {
+                    out += n;
+                    dstLen -= n;
+                }
+
+                continue;
+            }
+        }
+
         wxUint32 code;
 #ifdef WC_UTF16
         code = *wp++;
@@ -25,10 +25,13 @@
 #include <ctype.h>
 
 #include <errno.h>
+#include <float.h>
+#include <locale.h>
 
 #include <string.h>
 #include <stdlib.h>
 
+#include "wx/math.h"
 #include "wx/uilocale.h"
 #include "wx/vector.h"
 #include "wx/xlocale.h"
@@ -1643,15 +1646,71 @@ bool SkipOptPrefixAndSetBase(int& base, const char*& start, const char* end)
     return true;
 }
 
+// Helper providing the contents of a string, which is supposed to contain a
+// number, as NUL-terminated UTF-8 string for from_chars(): it avoids
+// allocating memory for the short ASCII strings, which is by far the most
+// common case.
+class NumberCharsBuffer
+{
+public:
+    explicit NumberCharsBuffer(const wxString& s)
+    {
+#if wxUSE_UNICODE_UTF8
+        m_start = s.wx_str();
+        m_end = m_start + s.utf8_length();
+#else // wxUSE_UNICODE_WCHAR
+        const wchar_t* const p = s.wx_str();
+        const size_t len = s.length();
+        if ( len < WXSIZEOF(m_buf) )
+        {
+            size_t n;
+            for ( n = 0; n < len; n++ )
+            {
+                if ( static_cast<unsigned long>(p[n]) > 0x7f )
+                    break;
+
+                m_buf[n] = static_cast<char>(p[n]);
+            }
+
+            if ( n == len )
+            {
+                m_buf[len] = '\0';
+                m_start = m_buf;
+                m_end = m_buf + len;
+                return;
+            }
+        }
+
+        m_utf8 = s.utf8_str();
+        m_start = m_utf8.data();
+        m_end = m_start + m_utf8.length();
+#endif // wxUSE_UNICODE_UTF8/wxUSE_UNICODE_WCHAR
+    }
+
+    const char* GetStart() const { return m_start; }
+    const char* GetEnd() const { return m_end; }
+
+private:
+#if wxUSE_UNICODE_WCHAR
+    char m_buf[64];
+    wxScopedCharBuffer m_utf8;
+#endif // wxUSE_UNICODE_WCHAR
+
+    const char* m_start;
+    const char* m_end;
+
+    wxDECLARE_NO_COPY_CLASS(NumberCharsBuffer);
+};
+
 } // anonymous namespace
 
 bool wxString::ToCLong(long *pVal, int base) const
 {
     wxCHECK_MSG( pVal, false, "null output pointer" );
 
-    const wxScopedCharBuffer& buf = utf8_str();
-    auto start = buf.data();
-    const auto end = start + buf.length();
+    const NumberCharsBuffer buf(*this);
+    auto start = buf.GetStart();
+    const auto end = buf.GetEnd();
 
     if ( !SkipOptPrefixAndSetBase(base, start, end) )
         return false;
@@ -1665,9 +1724,9 @@ bool wxString::ToCULong(unsigned long *pVal, int base) const
 {
     wxCHECK_MSG( pVal, false, "null output pointer" );
 
-    const wxScopedCharBuffer& buf = utf8_str();
-    auto start = buf.data();
-    const auto end = start + buf.length();
+    const NumberCharsBuffer buf(*this);
+    auto start = buf.GetStart();
+    const auto end = buf.GetEnd();
 
     if ( !SkipOptPrefixAndSetBase(base, start, end) )
         return false;
@@ -1697,9 +1756,9 @@ bool wxString::ToCDouble(double *pVal) const
 {
     wxCHECK_MSG( pVal, false, "null output pointer" );
 
-    const wxScopedCharBuffer& buf = utf8_str();
-    auto start = buf.data();
-    const auto end = start + buf.length();
+    const NumberCharsBuffer buf(*this);
+    auto start = buf.GetStart();
+    const auto end = buf.GetEnd();
 
     // Retain compatibility with the strtod() function by allowing starting spaces
     // and a leading + sign, which from_chars() does not accept.
@@ -1720,10 +1779,9 @@ wxString wxString::FromCDouble(double val, int precision)
 {
     wxCHECK_MSG( precision >= -1, wxString(), "Invalid negative precision" );
 
-    // 64 digits is more than enough for any double.
+    // 64 digits is more than enough for any double in the exponential format
+    // used by default, but not necessarily in the fixed one.
     char buf[64];
-    const auto start = buf;
-    const auto end = buf + sizeof(buf);
 
     std::to_chars_result res;
 
@@ -1732,19 +1790,210 @@ wxString wxString::FromCDouble(double val, int precision)
     // shortest string avoiding precision loss, but "%g" is supposed to
     // truncate, so use its default precision explicitly to achieve this here.
     if ( precision == -1 )
-        res = std::to_chars(start, end, val, std::chars_format::general, 6);
+    {
+        res = std::to_chars(buf, buf + sizeof(buf), val,
+                            std::chars_format::general, 6);
+    }
     else
-        res = std::to_chars(start, end, val, std::chars_format::fixed, precision);
+    {
+        res = std::to_chars(buf, buf + sizeof(buf), val,
+                            std::chars_format::fixed, precision);
+
+        if ( res.ec == std::errc::value_too_large )
+        {
+            // The integer part of a double can't have more than 309 digits.
+            std::vector<char> big(320 + precision);
+
+            res = std::to_chars(&big[0], &big[0] + big.size(), val,
+                                std::chars_format::fixed, precision);
+            if ( res.ec != std::errc{} )
+                return {};
+
+            return wxString::FromAscii(&big[0], res.ptr - &big[0]);
+        }
+    }
+
+    if ( res.ec != std::errc{} )
+        return {};
+
+    return wxString::FromAscii(buf, res.ptr - buf);
+}
 
+/* static */
+wxString wxString::FromCDoubleShortest(double val)
+{
+    // The shortest round-trip representation is what to_chars() returns if
+    // no format nor precision is specified.
+    char buf[64];
+    const std::to_chars_result res = std::to_chars(buf, buf + sizeof(buf), val);
     if ( res.ec != std::errc{} )
         return {};
 
-    *res.ptr = '\0';
+    return wxString::FromAscii(buf, res.ptr - buf);
+}
+
+/* static */
+wxString wxString::FromDouble(double val, int precision)
+{
+    // std::to_chars() is much faster than printf() and produces the same
+    // output, except for the decimal separator which is always the period, so
+    // replace it with the separator of the current locale, as printf() does.
+    wxString s = FromCDouble(val, precision);
+
+    const char* const point = localeconv()->decimal_point;
+    if ( point && strcmp(point, ".") != 0 )
+    {
+        const size_t posPoint = s.find('.');
+        if ( posPoint != npos )
+            s.replace(posPoint, 1, wxString(point, wxConvLibc));
+    }
+
+    return s;
+}
+
+#else // !__cpp_lib_to_chars
+
+namespace
+{
+
+// Check if floating point operations on doubles are performed using double
+// precision: this is not the case when using x87 FPU, for example, and the
+// results of the operations can be affected by double rounding then.
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+
+#define wxHAS_EXACT_DOUBLE_ARITHMETIC
+
+// All powers of 10 up to this one are exactly representable as doubles.
+const double exactPowersOf10[] =
+{
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+// Parse the number in C locale format if it's simple enough for the result to
+// be computed exactly using a single floating point operation, as explained in
+// W. Clinger "How to Read Floating Point Numbers Accurately" paper.
+//
+// Returns false if the string doesn't contain a valid number or if it's not
+// simple enough, the caller must use the slow path in this case.
+bool DoParseSimpleCDouble(const wxStringCharType* p, double* pVal)
+{
+    // Leading whitespace is allowed, as with strtod().
+    while ( *p == ' ' || *p == '\t' )
+        p++;
+
+    bool negative = false;
+    if ( *p == '-' )
+    {
+        negative = true;
+        p++;
+    }
+    else if ( *p == '+' )
+    {
+        p++;
+    }
+
+    // The mantissa can't overflow as we don't accept more than 19 digits.
+    wxUint64 mantissa = 0;
+    int numDigits = 0;
+    int exp10 = 0;
+    bool hasDigits = false;
+
+    for ( ; *p >= '0' && *p <= '9'; p++ )
+    {
+        hasDigits = true;
+
+        // Leading zeroes are not significant.
+        if ( !mantissa && *p == '0' )
+            continue;
+
+        if ( ++numDigits > 19 )
+            return false;
+
+        mantissa = mantissa*10 + (*p - '0');
+    }
+
+    if ( *p == '.' )
+    {
+        for ( p++; *p >= '0' && *p <= '9'; p++ )
+        {
+            hasDigits = true;
+            exp10--;
+
+            if ( !mantissa && *p == '0' )
+                continue;
+
+            if ( ++numDigits > 19 )
+                return false;
+
+            mantissa = mantissa*10 + (*p - '0');
+        }
+    }
+
+    if ( !hasDigits )
+        return false;
+
+    if ( *p == 'e' || *p == 'E' )
+    {
+        p++;
+
+        bool negativeExp = false;
+        if ( *p == '-' )
+        {
+            negativeExp = true;
+            p++;
+        }
+        else if ( *p == '+' )
+        {
+            p++;
+        }
+
+        if ( *p < '0' || *p > '9' )
+            return false;
 
-    return wxString::FromAscii(buf);
+        int exp = 0;
+        for ( ; *p >= '0' && *p <= '9'; p++ )
+        {
+            // Avoid overflow, such big exponents are not handled here anyhow.
+            if ( exp < 10000 )
+                exp = exp*10 + (*p - '0');
+        }
+
+        exp10 += negativeExp ? -exp : exp;
+    }
+
+    // Trailing garbage is not allowed.
+    if ( *p != '\0' )
+        return false;
+
+    double value = 0;
+    if ( mantissa )
+    {
+        // Both the mantissa and the power of 10 must be exactly representable
+        // for the result of multiplying or dividing them to be exact.
+        if ( mantissa > (static_cast<wxUint64>(1) << 53) )
+            return false;
+
+        if ( exp10 < -22 || exp10 > 22 )
+            return false;
+
+        value = static_cast<double>(mantissa);
+        if ( exp10 < 0 )
+            value /= exactPowersOf10[-exp10];
+        else
+            value *= exactPowersOf10[exp10];
+    }
+
+    *pVal = negative ? -value : value;
+
+    return true;
 }
 
-#elif wxUSE_XLOCALE
+#endif // FLT_EVAL_METHOD == 0
+
+} // anonymous namespace
+
+#if wxUSE_XLOCALE
 
 bool wxString::ToCLong(long *pVal, int base) const
 {
@@ -1782,6 +2031,12 @@ bool wxString::ToCULong(unsigned long *pVal, int base) const
 
 bool wxString::ToCDouble(double *pVal) const
 {
+#ifdef wxHAS_EXACT_DOUBLE_ARITHMETIC
+    // Most numbers can be parsed much faster without calling strtod().
+    if ( pVal && DoParseSimpleCDouble(wx_str(), pVal) )
+        return true;
+#endif // wxHAS_EXACT_DOUBLE_ARITHMETIC
+
     return ToNumeric<double>
            (
             pVal,
@@ -1818,6 +2073,11 @@ bool wxString::ToCULong(unsigned long *pVal, int base) const
 // point which is different in different locales.
 bool wxString::ToCDouble(double *pVal) const
 {
+#ifdef wxHAS_EXACT_DOUBLE_ARITHMETIC
+    if ( pVal && DoParseSimpleCDouble(wx_str(), pVal) )
+        return true;
+#endif // wxHAS_EXACT_DOUBLE_ARITHMETIC
+
     // See the explanations in FromCDouble() below for the reasons for all this.
 
     // Try parsing using the current locale separator.
@@ -1851,10 +2111,14 @@ bool wxString::ToCDouble(double *pVal) const
 
 #endif  // wxUSE_XLOCALE/!wxUSE_XLOCALE
 
+#endif // __cpp_lib_to_chars/!__cpp_lib_to_chars
+
 // ----------------------------------------------------------------------------
 // number to string conversion
 // ----------------------------------------------------------------------------
 
+#ifndef __cpp_lib_to_chars
+
 /* static */
 wxString wxString::FromDouble(double val, int precision)
 {
@@ -1873,8 +2137,6 @@ wxString wxString::FromDouble(double val, int precision)
     return wxString::Format(format, val);
 }
 
-#ifndef __cpp_lib_to_chars
-
 /* static */
 wxString wxString::FromCDouble(double val, int precision)
 {
@@ -1895,6 +2157,84 @@ wxString wxString::FromCDouble(double val, int precision)
     return s;
 }
 
+/* static */
+wxString wxString::FromCDoubleShortest(double val)
+{
+    // Zero, infinities and NaNs are formatted in the same way in any case.
+    if ( val == 0 || !wxFinite(val) )
+        return FromCDouble(val);
+
+    // Find the smallest number of significant digits allowing to represent
+    // the number without loss of precision: this is at most 17 for doubles
+    // and, in practice, 15 is enough for the vast majority of numbers (with
+    // trailing zeroes removed below), except for the denormalized ones which
+    // may need less digits than that.
+    char buf[64];
+    for ( int prec = fabs(val) < DBL_MIN ? 1 : 15; ; prec++ )
+    {
+        snprintf(buf, sizeof(buf), "%.*e", prec - 1, val);
+        if ( prec == 17 || strtod(buf, nullptr) == val )
+            break;
+    }
+
+    // Extract the significant digits and the exponent from the string, which
+    // has "[-]d.ddde[+-]xx" form, with a locale-dependent decimal separator.
+    const char* p = buf;
+    const bool negative = *p == '-';
+    if ( negative )
+        p++;
+
+    char digits[20];
+    int numDigits = 0;
+    for ( ; *p && *p != 'e'; p++ )
+    {
+        if ( *p >= '0' && *p <= '9' )
+            digits[numDigits++] = *p;
+    }
+
+    const int exp10 = *p == 'e' ? atoi(p + 1) : 0;
+
+    while ( numDigits > 1 && digits[numDigits - 1] == '0' )
+        numDigits--;
+
+    // Use the same format as std::to_chars(), i.e. the shortest of the fixed
+    // and scientific ones, preferring the former in case of a tie.
+    wxString sci;
+    sci += digits[0];
+    if ( numDigits > 1 )
+    {
+        sci += '.';
+        sci.append(digits + 1, numDigits - 1);
+    }
+    sci += wxString::Format("e%c%02d", exp10 < 0 ? '-' : '+', abs(exp10));
+
+    wxString fixed;
+    if ( exp10 < 0 )
+    {
+        fixed = "0.";
+        fixed.append(static_cast<size_t>(-exp10 - 1), '0');
+        fixed.append(digits, numDigits);
+    }
+    else if ( numDigits <= exp10 + 1 )
+    {
+        // Note that std::to_chars() outputs all the digits of the exact
+        // integer value in this case, rather than padding with zeroes.
+        snprintf(buf, sizeof(buf), "%.0f", fabs(val));
+        fixed = buf;
+    }
+    else
+    {
+        fixed.append(digits, exp10 + 1);
+        fixed += '.';
+        fixed.append(digits + exp10 + 1, numDigits - exp10 - 1);
+    }
+
+    wxString s = negative ? wxString("-") : wxString();
+    s += fixed.length() <= sci.length() ? fixed : sci;
+
+    return s;
+}
+
 #endif // !__cpp_lib_to_chars
 
 // ---------------------------------------------------------------------------
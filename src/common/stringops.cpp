@@ -133,6 +133,15 @@ bool wxStringOperationsUtf8::IsValidUtf8String(const char *str, size_t len)
     {
         unsigned char b = *c;
 
+        if ( end != nullptr && b <= 0x7F )
+        {
+            // Skip the entire run of ASCII characters at once, notice that
+            // the loop increments the pointer past the last one of them.
+            c += wxGetASCIIPrefixLength(reinterpret_cast<const char*>(c),
+                                        end - c) - 1;
+            continue;
+        }
+
         if ( end != nullptr )
         {
             // if the string is not null-terminated, verify we have enough
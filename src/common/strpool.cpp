@@ -0,0 +1,137 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        src/common/strpool.cpp
+// Purpose:     wxStringPool implementation
+// Author:      wxWidgets team
+// Created:     2026-10-17
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+// For compilers that support precompilation, includes "wx.h".
+#include "wx/wxprec.h"
+
+#include "wx/strpool.h"
+
+#include <string.h>
+
+// ============================================================================
+// wxStringPool implementation
+// ============================================================================
+
+wxStringPool::wxStringPool(size_t chunkSize)
+    : m_chunkSize(wxMax(chunkSize, 1)),
+      m_current(0)
+{
+}
+
+wxStringCharType* wxStringPool::Allocate(size_t n)
+{
+    // Use the existing chunks, possibly left over after Empty(), if possible.
+    for ( ; m_current < m_chunks.size(); m_current++ )
+    {
+        Chunk& chunk = m_chunks[m_current];
+        if ( chunk.size - chunk.used >= n )
+        {
+            wxStringCharType* const p = chunk.data.get() + chunk.used;
+            chunk.used += n;
+            return p;
+        }
+
+        // Don't waste the rest of the current chunk because of a single long
+        // string, just allocate a separate chunk for it.
+        if ( n > m_chunkSize / 4 )
+            break;
+    }
+
+    Chunk chunk;
+    chunk.size = wxMax(n, m_chunkSize);
+    chunk.data.reset(new wxStringCharType[chunk.size]);
+    chunk.used = n;
+
+    wxStringCharType* const p = chunk.data.get();
+
+    if ( m_current < m_chunks.size() )
+    {
+        // Insert the new chunk before the current one, so that the latter
+        // keeps being used for the next strings.
+        m_chunks.insert(m_chunks.begin() + m_current, std::move(chunk));
+        m_current++;
+    }
+    else
+    {
+        m_chunks.push_back(std::move(chunk));
+    }
+
+    return p;
+}
+
+size_t wxStringPool::Add(const wxStringCharType* s, size_t len)
+{
+    wxStringCharType* const p = Allocate(len + 1);
+    if ( len )
+        memcpy(p, s, len*sizeof(wxStringCharType));
+    p[len] = 0;
+
+    m_strings.push_back(wxPooledString(p, len));
+
+    return m_strings.size() - 1;
+}
+
+void wxStringPool::Reserve(size_t count, size_t totalLength)
+{
+    m_strings.reserve(m_strings.size() + count);
+
+    const size_t needed = totalLength + count;
+    if ( !needed )
+        return;
+
+    // Check if there is enough space remaining in the existing chunks.
+    size_t available = 0;
+    for ( size_t n = m_current; n < m_chunks.size(); n++ )
+    {
+        available += m_chunks[n].size - m_chunks[n].used;
+        if ( available >= needed )
+            return;
+    }
+
+    // There is not, so allocate a single chunk for all the new strings and
+    // make it current, as the remaining space in the previously current one,
+    // if any, is unlikely to be big.
+    Chunk chunk;
+    chunk.size = wxMax(needed, m_chunkSize);
+    chunk.data.reset(new wxStringCharType[chunk.size]);
+    chunk.used = 0;
+
+    m_chunks.push_back(std::move(chunk));
+    m_current = m_chunks.size() - 1;
+}
+
+void wxStringPool::Empty()
+{
+    m_strings.clear();
+
+    for ( auto& chunk : m_chunks )
+        chunk.used = 0;
+
+    m_current = 0;
+}
+
+void wxStringPool::Clear()
+{
+    m_strings.clear();
+    m_strings.shrink_to_fit();
+
+    m_chunks.clear();
+    m_chunks.shrink_to_fit();
+
+    m_current = 0;
+}
+
+size_t wxStringPool::GetMemoryUsage() const
+{
+    size_t size = 0;
+    for ( const auto& chunk : m_chunks )
+        size += chunk.size*sizeof(wxStringCharType);
+
+    return size;
+}
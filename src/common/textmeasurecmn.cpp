@@ -25,6 +25,113 @@
 
 #include "wx/private/textmeasure.h"
 
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+// ============================================================================
+// wxTextMeasureCache: global caches of the text extents
+// ============================================================================
+
+namespace
+{
+
+// LRU cache of the values of type T associated with the strings measured in
+// some context, see wxTextMeasureBase::GetCacheContext().
+template <typename T>
+class wxTextMeasureCache
+{
+public:
+    bool IsEnabled() const { return m_maxEntries != 0; }
+
+    void SetMaxEntries(size_t maxEntries)
+    {
+        m_maxEntries = maxEntries;
+
+        while ( m_entries.size() > m_maxEntries )
+            RemoveLast();
+    }
+
+    void Clear()
+    {
+        m_index.clear();
+        m_entries.clear();
+    }
+
+    // Return the cached value or null if there is none, updating the
+    // statistics in either case.
+    const T* Find(const wxString& key)
+    {
+        const auto it = m_index.find(key);
+        if ( it == m_index.end() )
+        {
+            m_misses++;
+            return nullptr;
+        }
+
+        m_hits++;
+
+        // Move the entry to the front of the list as it's used now.
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+
+        return &it->second->value;
+    }
+
+    void Add(const wxString& key, const T& value)
+    {
+        m_entries.push_front(Entry{key, value});
+        m_index[key] = m_entries.begin();
+
+        while ( m_entries.size() > m_maxEntries )
+            RemoveLast();
+    }
+
+    size_t GetHits() const { return m_hits; }
+    size_t GetMisses() const { return m_misses; }
+
+private:
+    struct Entry
+    {
+        wxString key;
+        T value;
+    };
+
+    typedef std::list<Entry> Entries;
+
+    void RemoveLast()
+    {
+        m_index.erase(m_entries.back().key);
+        m_entries.pop_back();
+    }
+
+    // Cached values, from the most to the least recently used, and the index
+    // allowing to find them quickly.
+    Entries m_entries;
+    std::unordered_map<wxString, typename Entries::iterator> m_index;
+
+    // The cache is disabled by default.
+    size_t m_maxEntries = 0;
+
+    size_t m_hits = 0,
+           m_misses = 0;
+};
+
+// Extents of the strings returned by DoGetTextExtent().
+struct wxTextExtent
+{
+    wxCoord width,
+            height,
+            descent,
+            externalLeading;
+};
+
+wxTextMeasureCache<wxTextExtent> gs_textExtentCache;
+
+// Widths returned by DoGetPartialTextExtents().
+wxTextMeasureCache< std::vector<int> > gs_partialExtentsCache;
+
+} // anonymous namespace
+
 // ============================================================================
 // wxTextMeasureBase implementation
 // ============================================================================
@@ -66,11 +173,152 @@ void wxTextMeasureBase::CallGetTextExtent(const wxString& string,
                                           wxCoord *externalLeading)
 {
     if ( m_useDCImpl )
-        m_dc->GetTextExtent(string, width, height, descent, externalLeading);
+        m_dc->GetTextExtent(string, width, height, descent, externalLeading,
+                            m_font);
+    else if ( gs_textExtentCache.IsEnabled() && !string.empty() )
+        GetTextExtentCached(string, width, height, descent, externalLeading);
     else
         DoGetTextExtent(string, width, height, descent, externalLeading);
 }
 
+const wxString& wxTextMeasureBase::GetCacheContext()
+{
+    if ( m_cacheContext.empty() )
+    {
+        const wxFont font = GetFont();
+        if ( !font.IsOk() )
+        {
+            // We can't identify the font, so the cache can't be used at all.
+            return m_cacheContext;
+        }
+
+        // The key must include everything that can affect the result: the
+        // font, the resolution and the scale used by the DC and also whether
+        // we measure for a window or a DC, as different functions may be used
+        // in these cases.
+        m_cacheContext = font.GetNativeFontInfoDesc();
+        if ( m_win )
+        {
+            m_cacheContext << wxS("|win|") << m_win->GetDPIScaleFactor();
+        }
+        else
+        {
+            const wxSize ppi = m_dc->GetPPI();
+
+            double userScaleX, userScaleY,
+                   logicalScaleX, logicalScaleY;
+            m_dc->GetUserScale(&userScaleX, &userScaleY);
+            m_dc->GetLogicalScale(&logicalScaleX, &logicalScaleY);
+
+            m_cacheContext << wxString::Format
+                              (
+                                wxS("|dc|%d|%d|%g|%g|%g|%g|%g"),
+                                ppi.x, ppi.y,
+                                m_dc->GetContentScaleFactor(),
+                                userScaleX, userScaleY,
+                                logicalScaleX, logicalScaleY
+                              );
+        }
+
+        // Separate the context from the string itself by a character which
+        // can't occur in the former.
+        m_cacheContext << wxUniChar(0);
+    }
+
+    return m_cacheContext;
+}
+
+void wxTextMeasureBase::GetTextExtentCached(const wxString& string,
+                                            wxCoord *width,
+                                            wxCoord *height,
+                                            wxCoord *descent,
+                                            wxCoord *externalLeading)
+{
+    const wxString& context = GetCacheContext();
+    if ( context.empty() )
+    {
+        DoGetTextExtent(string, width, height, descent, externalLeading);
+        return;
+    }
+
+    const wxString key = context + string;
+
+    wxTextExtent extent;
+    if ( const wxTextExtent* const cached = gs_textExtentCache.Find(key) )
+    {
+        extent = *cached;
+    }
+    else
+    {
+        // Always get all the values, even if they're not needed now, as they
+        // might be needed for the next call.
+        DoGetTextExtent(string, &extent.width, &extent.height,
+                        &extent.descent, &extent.externalLeading);
+
+        gs_textExtentCache.Add(key, extent);
+    }
+
+    *width = extent.width;
+    *height = extent.height;
+    if ( descent )
+        *descent = extent.descent;
+    if ( externalLeading )
+        *externalLeading = extent.externalLeading;
+}
+
+bool wxTextMeasureBase::GetPartialTextExtentsCached(const wxString& text,
+                                                    wxArrayInt& widths,
+                                                    double scaleX)
+{
+    const wxString& context = GetCacheContext();
+    if ( context.empty() )
+        return DoGetPartialTextExtents(text, widths, scaleX);
+
+    // The horizontal scale can be different for the calls using the same
+    // context, so it must be part of the key too.
+    wxString key = context;
+    key << scaleX << wxUniChar(0) << text;
+
+    if ( const std::vector<int>* const cached = gs_partialExtentsCache.Find(key) )
+    {
+        for ( size_t n = 0; n < cached->size(); n++ )
+            widths[n] = (*cached)[n];
+
+        return true;
+    }
+
+    if ( !DoGetPartialTextExtents(text, widths, scaleX) )
+        return false;
+
+    gs_partialExtentsCache.Add(key, std::vector<int>(widths.begin(),
+                                                     widths.end()));
+
+    return true;
+}
+
+/* static */
+void wxTextMeasureBase::EnableExtentCache(size_t maxEntries)
+{
+    gs_textExtentCache.SetMaxEntries(maxEntries);
+    gs_partialExtentsCache.SetMaxEntries(maxEntries);
+}
+
+/* static */
+void wxTextMeasureBase::ClearExtentCache()
+{
+    gs_textExtentCache.Clear();
+    gs_partialExtentsCache.Clear();
+}
+
+/* static */
+void wxTextMeasureBase::GetExtentCacheStats(size_t* hits, size_t* misses)
+{
+    if ( hits )
+        *hits = gs_textExtentCache.GetHits() + gs_partialExtentsCache.GetHits();
+    if ( misses )
+        *misses = gs_textExtentCache.GetMisses() + gs_partialExtentsCache.GetMisses();
+}
+
 void wxTextMeasureBase::GetTextExtent(const wxString& string,
                                       wxCoord *width,
                                       wxCoord *height,
@@ -189,6 +437,23 @@ void wxTextMeasureBase::GetMultiLineTextExtent(const wxString& text,
         *heightOneLine = heightLine;
 }
 
+void wxTextMeasureBase::GetTextExtents(size_t n,
+                                       const wxString* strings,
+                                       wxSize* extents)
+{
+    MeasuringGuard guard(*this);
+
+    for ( size_t i = 0; i < n; ++i )
+    {
+        // Don't call CallGetTextExtent() for the empty strings, as
+        // DoGetTextExtent() doesn't handle them.
+        if ( strings[i].empty() )
+            extents[i] = wxSize(0, 0);
+        else
+            CallGetTextExtent(strings[i], &extents[i].x, &extents[i].y);
+    }
+}
+
 wxSize wxTextMeasureBase::GetLargestStringExtent(size_t n,
                                                  const wxString* strings)
 {
@@ -220,6 +485,9 @@ bool wxTextMeasureBase::GetPartialTextExtents(const wxString& text,
 
     widths.Add(0, text.length());
 
+    if ( !m_useDCImpl && gs_partialExtentsCache.IsEnabled() )
+        return GetPartialTextExtentsCached(text, widths, scaleX);
+
     return DoGetPartialTextExtents(text, widths, scaleX);
 }
 
@@ -76,6 +76,8 @@ wxGCC_WARNING_RESTORE(cast-qual)
 #endif
 
 #ifndef WX_PRECOMP
+    #include "wx/event.h"
+    #include "wx/image.h"
     #include "wx/utils.h"                   // Only for wxMin()
 #endif // WX_PRECOMP
 
@@ -87,9 +89,19 @@ wxGCC_WARNING_RESTORE(cast-qual)
 #else
     #define wxNO_SVG_FILE
 #endif
+#include "wx/module.h"
 #include "wx/rawbmp.h"
+#include "wx/thread.h"
 
 #include "wx/private/bmpbndl.h"
+#include "wx/private/parallel.h"
+
+#include <atomic>
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
 
 // ----------------------------------------------------------------------------
 // private helpers
@@ -98,97 +110,426 @@ wxGCC_WARNING_RESTORE(cast-qual)
 namespace
 {
 
-class wxBitmapBundleImplSVG : public wxBitmapBundleImpl
+// Parsed SVG image which can be shared by several bundles.
+class wxSVGParsedImage
 {
 public:
     // Ctor must be passed a valid NSVGimage and takes ownership of it.
-    wxBitmapBundleImplSVG(NSVGimage* svgImage, const wxSize& sizeDef)
-        : m_svgImage(svgImage),
-          m_svgRasterizer(nsvgCreateRasterizer()),
+    explicit wxSVGParsedImage(NSVGimage* svgImage)
+        : m_svgImage(svgImage)
+    {
+    }
+
+    ~wxSVGParsedImage();
+
+    // Rasterize the image into the given buffer of size.x*size.y RGBA
+    // pixels, possibly using several threads for big images.
+    //
+    // This function can be called from any thread.
+    void RasterizeToBuffer(const wxSize& size, unsigned char* buffer) const;
+
+    // Create the bitmap from the buffer filled by RasterizeToBuffer(), this
+    // can only be done in the main thread.
+    static wxBitmap BitmapFromBuffer(const wxSize& size,
+                                     const unsigned char* buffer);
+
+    wxBitmap Rasterize(const wxSize& size) const
+    {
+        wxVector<unsigned char> buffer(size.x*size.y*4);
+        RasterizeToBuffer(size, &buffer[0]);
+        return BitmapFromBuffer(size, &buffer[0]);
+    }
+
+private:
+    // This is only read when rasterizing, so it can be used by several
+    // threads at once, as long as each of them uses its own rasterizer.
+    NSVGimage* const m_svgImage;
+
+    wxDECLARE_NO_COPY_CLASS(wxSVGParsedImage);
+};
+
+// Global cache of the parsed SVG images and the bitmaps rasterized from them.
+//
+// The parsed images are indexed by their SVG data, so that creating a bundle
+// from the same data, e.g. by loading the same file again, doesn't parse it
+// again as long as any bundle using this image still exists or any bitmaps
+// rasterized from it remain in the cache.
+//
+// The bitmaps are kept in LRU order and the least recently used ones are
+// discarded when the total amount of memory used by them exceeds the limit.
+// Note that the most recently used bitmap is always kept, even if it's bigger
+// than the limit, as it's likely to be requested again soon.
+class wxSVGRasterCache
+{
+public:
+    // Return the global cache object, creating it if necessary.
+    static wxSVGRasterCache& Get()
+    {
+        if ( !ms_instance )
+            ms_instance = new wxSVGRasterCache();
+
+        return *ms_instance;
+    }
+
+    static wxSVGRasterCache* GetIfExists() { return ms_instance; }
+
+    // Called on program shutdown to free all cached bitmaps.
+    static void Destroy()
+    {
+        // Reset the pointer before deleting the object to prevent
+        // ~wxSVGParsedImage() called from its dtor from accessing it.
+        wxSVGRasterCache* const instance = ms_instance;
+        ms_instance = nullptr;
+        delete instance;
+    }
+
+    // Return the existing image for the given data or null.
+    std::shared_ptr<wxSVGParsedImage> FindImage(const std::string& data) const
+    {
+        const auto it = m_images.find(data);
+        return it == m_images.end() ? nullptr : it->second.lock();
+    }
+
+    void AddImage(const std::string& data,
+                  const std::shared_ptr<wxSVGParsedImage>& image)
+    {
+        m_images[data] = image;
+    }
+
+    // Forget about all the images which don't exist any longer.
+    void RemoveExpiredImages()
+    {
+        for ( auto it = m_images.begin(); it != m_images.end(); )
+        {
+            if ( it->second.expired() )
+                it = m_images.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    // Return the bitmap of the given size, rasterizing it if necessary.
+    wxBitmap GetBitmap(const std::shared_ptr<wxSVGParsedImage>& image,
+                       const wxSize& size);
+
+    // Add the bitmap rasterized from the given image to the cache.
+    void AddBitmap(const std::shared_ptr<wxSVGParsedImage>& image,
+                   const wxBitmap& bitmap);
+
+    void SetLimit(size_t maxBytes)
+    {
+        m_limit = maxBytes;
+
+        Trim(m_limit);
+    }
+
+    size_t GetLimit() const { return m_limit; }
+
+    size_t GetSize() const { return m_size; }
+
+    // Discard the least recently used bitmaps until the total size of the
+    // remaining ones is not greater than the given value.
+    void Trim(size_t maxBytes)
+    {
+        while ( m_size > maxBytes )
+            RemoveLast();
+    }
+
+private:
+    wxSVGRasterCache() = default;
+
+    struct Entry
+    {
+        // This keeps the image alive while any bitmaps created from it are
+        // cached.
+        std::shared_ptr<wxSVGParsedImage> image;
+        wxSize size;
+        wxBitmap bitmap;
+        size_t bytes;
+    };
+
+    typedef std::list<Entry> Entries;
+
+    struct Key
+    {
+        const wxSVGParsedImage* image;
+        int width,
+            height;
+
+        bool operator<(const Key& other) const
+        {
+            if ( image != other.image )
+                return image < other.image;
+            if ( width != other.width )
+                return width < other.width;
+            return height < other.height;
+        }
+    };
+
+    void RemoveLast()
+    {
+        const Entry& entry = m_entries.back();
+
+        m_size -= entry.bytes;
+        m_index.erase(Key{entry.image.get(), entry.size.x, entry.size.y});
+
+        // Note that this may destroy the image and call our
+        // RemoveExpiredImages(), which is fine as it doesn't use the entries.
+        m_entries.pop_back();
+    }
+
+    static wxSVGRasterCache* ms_instance;
+
+    // Parsed images indexed by their SVG data.
+    std::unordered_map< std::string, std::weak_ptr<wxSVGParsedImage> > m_images;
+
+    // Cached bitmaps, from the most to the least recently used, and the index
+    // allowing to find them quickly.
+    Entries m_entries;
+    std::map<Key, Entries::iterator> m_index;
+
+    // Total size of all bitmaps in m_entries and the maximal allowed size.
+    size_t m_size = 0;
+    size_t m_limit = 16*1024*1024;
+
+    wxDECLARE_NO_COPY_CLASS(wxSVGRasterCache);
+};
+
+wxSVGRasterCache* wxSVGRasterCache::ms_instance = nullptr;
+
+#if wxUSE_THREADS
+
+// Thread used for rasterizing a bitmap in background.
+class wxSVGRasterThread : public wxThread
+{
+public:
+    wxSVGRasterThread(const std::shared_ptr<wxSVGParsedImage>& image,
+                      const wxSize& size,
+                      wxEvtHandler* handler,
+                      int id)
+        : wxThread(wxTHREAD_JOINABLE),
+          m_image(image),
+          m_size(size),
+          m_buffer(size.x*size.y*4),
+          m_handler(handler),
+          m_id(id),
+          m_done(false)
+    {
+    }
+
+    const wxSize& GetSize() const { return m_size; }
+
+    // Once this returns true, the buffer may be used from the main thread.
+    bool IsDone() const { return m_done; }
+
+    const unsigned char* GetBuffer() const { return &m_buffer[0]; }
+
+protected:
+    virtual ExitCode Entry() override
+    {
+        m_image->RasterizeToBuffer(m_size, &m_buffer[0]);
+
+        m_done = true;
+
+        if ( m_handler )
+            wxQueueEvent(m_handler, new wxThreadEvent(wxEVT_THREAD, m_id));
+
+        return nullptr;
+    }
+
+private:
+    const std::shared_ptr<wxSVGParsedImage> m_image;
+    const wxSize m_size;
+    wxVector<unsigned char> m_buffer;
+
+    wxEvtHandler* const m_handler;
+    const int m_id;
+
+    std::atomic<bool> m_done;
+};
+
+#endif // wxUSE_THREADS
+
+class wxBitmapBundleImplSVG : public wxBitmapBundleImpl
+{
+public:
+    wxBitmapBundleImplSVG(const std::shared_ptr<wxSVGParsedImage>& image,
+                          const wxSize& sizeDef)
+        : m_image(image),
           m_sizeDef(sizeDef)
     {
     }
 
+#if wxUSE_THREADS
     ~wxBitmapBundleImplSVG()
     {
-        nsvgDeleteRasterizer(m_svgRasterizer);
-        nsvgDelete(m_svgImage);
+        // We can't interrupt the rasterization, so wait until it finishes.
+        if ( m_thread )
+            m_thread->Wait();
     }
 
+    // Start rasterizing the bitmap of the given size in background.
+    void StartRasterizing(const wxSize& size, wxEvtHandler* handler, int id);
+#endif // wxUSE_THREADS
+
     virtual wxSize GetDefaultSize() const override;
     virtual wxSize GetPreferredBitmapSizeAtScale(double scale) const override;
     virtual wxBitmap GetBitmap(const wxSize& size) override;
 
 private:
-    wxBitmap DoRasterize(const wxSize& size);
-
-    NSVGimage* const m_svgImage;
-    NSVGrasterizer* const m_svgRasterizer;
+    const std::shared_ptr<wxSVGParsedImage> m_image;
 
     const wxSize m_sizeDef;
 
-    // Cache the last used bitmap (may be invalid if not used yet).
-    //
-    // Note that we cache only the last bitmap and not all the bitmaps ever
-    // requested from GetBitmap() for the different sizes because there would
-    // be no way to clear such cache and its growth could be unbounded,
-    // resulting in too many bitmap objects being used in an application using
-    // SVG for all of its icons.
-    wxBitmap m_cachedBitmap;
+#if wxUSE_THREADS
+    // The thread rasterizing the bitmap in background, if any, and the
+    // transparent bitmap returned instead of it until it finishes.
+    std::unique_ptr<wxSVGRasterThread> m_thread;
+    wxBitmap m_placeholder;
+#endif // wxUSE_THREADS
 
     wxDECLARE_NO_COPY_CLASS(wxBitmapBundleImplSVG);
 };
 
+class wxSVGRasterCacheModule : public wxModule
+{
+public:
+    wxSVGRasterCacheModule() { }
+
+    virtual bool OnInit() override { return true; }
+    virtual void OnExit() override { wxSVGRasterCache::Destroy(); }
+
+private:
+    wxDECLARE_DYNAMIC_CLASS(wxSVGRasterCacheModule);
+};
+
+wxIMPLEMENT_DYNAMIC_CLASS(wxSVGRasterCacheModule, wxModule);
+
 } // anonymous namespace
 
 // ============================================================================
-// wxBitmapBundleImplSVG implementation
+// wxSVGRasterCache implementation
 // ============================================================================
 
-wxSize wxBitmapBundleImplSVG::GetDefaultSize() const
+wxBitmap
+wxSVGRasterCache::GetBitmap(const std::shared_ptr<wxSVGParsedImage>& image,
+                            const wxSize& size)
 {
-    return m_sizeDef;
+    const Key key{image.get(), size.x, size.y};
+
+    const auto it = m_index.find(key);
+    if ( it != m_index.end() )
+    {
+        // Move the entry to the front of the list as it's used now.
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+
+        return it->second->bitmap;
+    }
+
+    const wxBitmap bitmap = image->Rasterize(size);
+
+    AddBitmap(image, bitmap);
+
+    return bitmap;
 }
 
-wxSize wxBitmapBundleImplSVG::GetPreferredBitmapSizeAtScale(double scale) const
+void
+wxSVGRasterCache::AddBitmap(const std::shared_ptr<wxSVGParsedImage>& image,
+                            const wxBitmap& bitmap)
 {
-    // We consider that we can render at any scale.
-    return m_sizeDef*scale;
+    const wxSize size = bitmap.GetSize();
+    const Key key{image.get(), size.x, size.y};
+
+    // This can happen if the bitmap was rasterized in background while the
+    // same size was also requested synchronously, just keep the old one.
+    if ( m_index.find(key) != m_index.end() )
+        return;
+
+    const size_t bytes = static_cast<size_t>(size.x)*size.y*4;
+    m_entries.push_front(Entry{image, size, bitmap, bytes});
+    m_index[key] = m_entries.begin();
+    m_size += bytes;
+
+    while ( m_size > m_limit && m_entries.size() > 1 )
+        RemoveLast();
 }
 
-wxBitmap wxBitmapBundleImplSVG::GetBitmap(const wxSize& size)
+// ============================================================================
+// wxSVGParsedImage implementation
+// ============================================================================
+
+wxSVGParsedImage::~wxSVGParsedImage()
 {
-    if ( !m_cachedBitmap.IsOk() || m_cachedBitmap.GetSize() != size )
-    {
-        m_cachedBitmap = DoRasterize(size);
-    }
+    nsvgDelete(m_svgImage);
 
-    return m_cachedBitmap;
+    if ( wxSVGRasterCache* const cache = wxSVGRasterCache::GetIfExists() )
+        cache->RemoveExpiredImages();
 }
 
-wxBitmap wxBitmapBundleImplSVG::DoRasterize(const wxSize& size)
+void
+wxSVGParsedImage::RasterizeToBuffer(const wxSize& size,
+                                    unsigned char* buffer) const
 {
-    wxVector<unsigned char> buffer(size.x*size.y*4);
-    nsvgRasterize
-    (
-        m_svgRasterizer,
-        m_svgImage,
-        0.0, 0.0,           // no offset
-        wxMin
-        (
-            size.x/m_svgImage->width,
-            size.y/m_svgImage->height
-        ),                  // scale
-        &buffer[0],
-        size.x, size.y,
-        size.x*4            // stride -- we have no gaps between lines
-    );
+    const float scale = wxMin
+                        (
+                            size.x/m_svgImage->width,
+                            size.y/m_svgImage->height
+                        );
+    const int stride = size.x*4;    // we have no gaps between lines
+
+    // Don't use threads for bands with fewer pixels than this, the overhead
+    // of creating a thread and of processing all the shapes in each band
+    // would outweigh any gains.
+    static const int MIN_PIXELS_PER_BAND = 65536;
+
+#if wxUSE_IMAGE
+    const unsigned int maxThreads = wxImage::GetMaxThreads();
+#else
+    const unsigned int maxThreads = 1;
+#endif
+
+    // Split the image in horizontal bands, each of which is rasterized
+    // independently by shifting the image upwards, so that the band top is
+    // at 0, and limiting the output height to the band height. As NanoSVG
+    // rasterizes each scanline independently, this gives the same result as
+    // rasterizing the whole image at once, except that shifting the floating
+    // point coordinates of the edges may round them differently and so change
+    // the values of the anti-aliased pixels by 1.
+    wxParallelForBands(size.y, maxThreads,
+                       wxMax(1, MIN_PIXELS_PER_BAND / wxMax(1, size.x)),
+        [this, scale, stride, buffer, size](int start, int end)
+        {
+            // The rasterizer contains the scratch data used while
+            // rasterizing, so each thread needs its own one.
+            NSVGrasterizer* const rasterizer = nsvgCreateRasterizer();
+            if ( !rasterizer )
+                return;
+
+            nsvgRasterize
+            (
+                rasterizer,
+                m_svgImage,
+                0.0f, static_cast<float>(-start),
+                scale,
+                buffer + static_cast<size_t>(start)*stride,
+                size.x, end - start,
+                stride
+            );
+
+            nsvgDeleteRasterizer(rasterizer);
+        });
+}
 
+/* static */
+wxBitmap
+wxSVGParsedImage::BitmapFromBuffer(const wxSize& size,
+                                   const unsigned char* buffer)
+{
     wxBitmap bitmap(size, 32);
     wxAlphaPixelData bmpdata(bitmap);
     wxAlphaPixelData::Iterator dst(bmpdata);
 
-    const unsigned char* src = &buffer[0];
+    const unsigned char* src = buffer;
     for ( int y = 0; y < size.y; ++y )
     {
         dst.MoveTo(bmpdata, 0, y);
@@ -222,44 +563,120 @@ wxBitmap wxBitmapBundleImplSVG::DoRasterize(const wxSize& size)
     return bitmap;
 }
 
-/* static */
-wxBitmapBundle wxBitmapBundle::FromSVG(char* data, const wxSize& sizeDef)
+// ============================================================================
+// wxBitmapBundleImplSVG implementation
+// ============================================================================
+
+wxSize wxBitmapBundleImplSVG::GetDefaultSize() const
 {
-    NSVGimage* const svgImage = nsvgParse(data, "px", 96);
-    if ( !svgImage )
-        return wxBitmapBundle();
+    return m_sizeDef;
+}
 
-    // Somewhat unexpectedly, a non-null but empty image is returned even if
-    // the data is not SVG at all, e.g. without this check creating a bundle
-    // from any random file with FromSVGFile() would "work".
-    if ( svgImage->width == 0 && svgImage->height == 0 && !svgImage->shapes )
+wxSize wxBitmapBundleImplSVG::GetPreferredBitmapSizeAtScale(double scale) const
+{
+    // We consider that we can render at any scale.
+    return m_sizeDef*scale;
+}
+
+wxBitmap wxBitmapBundleImplSVG::GetBitmap(const wxSize& size)
+{
+#if wxUSE_THREADS
+    if ( m_thread && size == m_thread->GetSize() )
     {
-        nsvgDelete(svgImage);
-        return wxBitmapBundle();
+        if ( !m_thread->IsDone() )
+        {
+            // Don't block waiting for the thread, return a transparent bitmap
+            // for now, the real one will be returned once it's ready.
+            if ( !m_placeholder.IsOk() )
+            {
+                wxVector<unsigned char> buffer(size.x*size.y*4);
+                m_placeholder = wxSVGParsedImage::BitmapFromBuffer(size,
+                                                                   &buffer[0]);
+            }
+
+            return m_placeholder;
+        }
+
+        m_thread->Wait();
+
+        const wxBitmap
+            bitmap = wxSVGParsedImage::BitmapFromBuffer(size,
+                                                        m_thread->GetBuffer());
+        wxSVGRasterCache::Get().AddBitmap(m_image, bitmap);
+
+        m_thread.reset();
+        m_placeholder = wxBitmap();
     }
+#endif // wxUSE_THREADS
 
-    return wxBitmapBundle(new wxBitmapBundleImplSVG(svgImage, sizeDef));
+    return wxSVGRasterCache::Get().GetBitmap(m_image, size);
 }
 
-/* static */
-wxBitmapBundle wxBitmapBundle::FromSVG(const char* data, const wxSize& sizeDef)
+#if wxUSE_THREADS
+
+void
+wxBitmapBundleImplSVG::StartRasterizing(const wxSize& size,
+                                        wxEvtHandler* handler,
+                                        int id)
 {
-    wxCharBuffer copy(data);
+    std::unique_ptr<wxSVGRasterThread>
+        thread(new wxSVGRasterThread(m_image, size, handler, id));
+    if ( thread->Create() != wxTHREAD_NO_ERROR ||
+            thread->Run() != wxTHREAD_NO_ERROR )
+    {
+        // Rasterize the bitmap synchronously, as this is better than not
+        // rasterizing it at all, and still notify the handler about it.
+        wxSVGRasterCache::Get().GetBitmap(m_image, size);
 
-    return FromSVG(copy.data(), sizeDef);
+        if ( handler )
+            wxQueueEvent(handler, new wxThreadEvent(wxEVT_THREAD, id));
+
+        return;
+    }
+
+    m_thread = std::move(thread);
 }
 
-/* static */
-wxBitmapBundle wxBitmapBundle::FromSVG(const wxByte* data, size_t len, const wxSize& sizeDef)
+#endif // wxUSE_THREADS
+
+namespace
 {
-    wxCharBuffer copy(len);
-    memcpy(copy.data(), data, len);
 
-    return FromSVG(copy.data(), sizeDef);
+// Common part of FromSVG() and FromSVGAsync(): return the new bundle
+// implementation object or null if the data couldn't be parsed.
+wxBitmapBundleImplSVG* CreateSVGImpl(char* data, const wxSize& sizeDef)
+{
+    // Check if we had already parsed the same data before: notice that we
+    // must copy it before parsing it as it's modified by the parser.
+    const std::string key(data);
+
+    wxSVGRasterCache& cache = wxSVGRasterCache::Get();
+
+    std::shared_ptr<wxSVGParsedImage> image = cache.FindImage(key);
+    if ( image )
+        return new wxBitmapBundleImplSVG(image, sizeDef);
+
+    NSVGimage* const svgImage = nsvgParse(data, "px", 96);
+    if ( !svgImage )
+        return nullptr;
+
+    // Somewhat unexpectedly, a non-null but empty image is returned even if
+    // the data is not SVG at all, e.g. without this check creating a bundle
+    // from any random file with FromSVGFile() would "work".
+    if ( svgImage->width == 0 && svgImage->height == 0 && !svgImage->shapes )
+    {
+        nsvgDelete(svgImage);
+        return nullptr;
+    }
+
+    image = std::make_shared<wxSVGParsedImage>(svgImage);
+    cache.AddImage(key, image);
+
+    return new wxBitmapBundleImplSVG(image, sizeDef);
 }
 
-/* static */
-wxBitmapBundle wxBitmapBundle::FromSVGFile(const wxString& path, const wxSize& sizeDef)
+// Read the entire contents of the given file into the buffer.
+bool ReadSVGFile(const wxString& path, wxCharBuffer& buf)
 {
     // There is nsvgParseFromFile(), but it doesn't work with Unicode filenames
     // under MSW and does exactly the same thing that we do here in any case,
@@ -277,15 +694,117 @@ wxBitmapBundle wxBitmapBundle::FromSVGFile(const wxString& path, const wxSize& s
         {
             const size_t len = static_cast<size_t>(lenAsOfs);
 
-            wxCharBuffer buf(len);
-            char* const ptr = buf.data();
-            if ( file.Read(ptr, len) == len )
-                return wxBitmapBundle::FromSVG(ptr, sizeDef);
+            buf = wxCharBuffer(len);
+            if ( file.Read(buf.data(), len) == len )
+                return true;
         }
     }
 #endif // !wxNO_SVG_FILE
 
-    return wxBitmapBundle();
+    return false;
+}
+
+} // anonymous namespace
+
+/* static */
+wxBitmapBundle wxBitmapBundle::FromSVG(char* data, const wxSize& sizeDef)
+{
+    wxBitmapBundleImplSVG* const impl = CreateSVGImpl(data, sizeDef);
+    if ( !impl )
+        return wxBitmapBundle();
+
+    return wxBitmapBundle(impl);
+}
+
+/* static */
+wxBitmapBundle wxBitmapBundle::FromSVG(const char* data, const wxSize& sizeDef)
+{
+    wxCharBuffer copy(data);
+
+    return FromSVG(copy.data(), sizeDef);
+}
+
+/* static */
+wxBitmapBundle wxBitmapBundle::FromSVG(const wxByte* data, size_t len, const wxSize& sizeDef)
+{
+    wxCharBuffer copy(len);
+    memcpy(copy.data(), data, len);
+
+    return FromSVG(copy.data(), sizeDef);
+}
+
+/* static */
+wxBitmapBundle wxBitmapBundle::FromSVGFile(const wxString& path, const wxSize& sizeDef)
+{
+    wxCharBuffer buf;
+    if ( !ReadSVGFile(path, buf) )
+        return wxBitmapBundle();
+
+    return wxBitmapBundle::FromSVG(buf.data(), sizeDef);
+}
+
+#if wxUSE_THREADS
+
+/* static */
+wxBitmapBundle
+wxBitmapBundle::FromSVGAsync(const char* data,
+                             const wxSize& sizeDef,
+                             const wxSize& size,
+                             wxEvtHandler* handler,
+                             int id)
+{
+    wxCharBuffer copy(data);
+
+    wxBitmapBundleImplSVG* const impl = CreateSVGImpl(copy.data(), sizeDef);
+    if ( !impl )
+        return wxBitmapBundle();
+
+    impl->StartRasterizing(size, handler, id);
+
+    return wxBitmapBundle(impl);
+}
+
+/* static */
+wxBitmapBundle
+wxBitmapBundle::FromSVGFileAsync(const wxString& path,
+                                 const wxSize& sizeDef,
+                                 const wxSize& size,
+                                 wxEvtHandler* handler,
+                                 int id)
+{
+    wxCharBuffer buf;
+    if ( !ReadSVGFile(path, buf) )
+        return wxBitmapBundle();
+
+    return FromSVGAsync(buf.data(), sizeDef, size, handler, id);
+}
+
+#endif // wxUSE_THREADS
+
+/* static */
+void wxBitmapBundle::SetSVGCacheLimit(size_t maxBytes)
+{
+    wxSVGRasterCache::Get().SetLimit(maxBytes);
+}
+
+/* static */
+size_t wxBitmapBundle::GetSVGCacheLimit()
+{
+    return wxSVGRasterCache::Get().GetLimit();
+}
+
+/* static */
+size_t wxBitmapBundle::GetSVGCacheSize()
+{
+    wxSVGRasterCache* const cache = wxSVGRasterCache::GetIfExists();
+    return cache ? cache->GetSize() : 0;
+}
+
+/* static */
+void wxBitmapBundle::TrimSVGCache(size_t maxBytes)
+{
+    if ( wxSVGRasterCache* const cache = wxSVGRasterCache::GetIfExists() )
+        cache->Trim(maxBytes);
 }
 
 #endif // wxHAS_SVG
@@ -30,6 +30,10 @@
 #include "wx/filename.h"
 #include "wx/stdpaths.h"
 
+#if wxUSE_ZLIB
+    #include "wx/zstream.h"
+#endif
+
 #ifdef __WXMSW__
 
 #ifdef DrawText
@@ -101,61 +105,6 @@ static const char *wxPostScriptHeaderEllipticArc=
 "  { fill }{ stroke } ifelse\n" // -> fill or stroke
 "} def\n";
 
-static const char *wxPostScriptHeaderColourImage = "\
-% define 'colorimage' if it isn't defined\n\
-%   ('colortogray' and 'mergeprocs' come from xwd2ps\n\
-%     via xgrab)\n\
-/colorimage where   % do we know about 'colorimage'?\n\
-  { pop }           % yes: pop off the 'dict' returned\n\
-  {                 % no:  define one\n\
-    /colortogray {  % define an RGB->I function\n\
-      /rgbdata exch store    % call input 'rgbdata'\n\
-      rgbdata length 3 idiv\n\
-      /npixls exch store\n\
-      /rgbindx 0 store\n\
-      0 1 npixls 1 sub {\n\
-        grays exch\n\
-        rgbdata rgbindx       get 20 mul    % Red\n\
-        rgbdata rgbindx 1 add get 32 mul    % Green\n\
-        rgbdata rgbindx 2 add get 12 mul    % Blue\n\
-        add add 64 idiv      % I = .5G + .31R + .18B\n\
-        put\n\
-        /rgbindx rgbindx 3 add store\n\
-      } for\n\
-      grays 0 npixls getinterval\n\
-    } bind def\n\
-\n\
-    % Utility procedure for colorimage operator.\n\
-    % This procedure takes two procedures off the\n\
-    % stack and merges them into a single procedure.\n\
-\n\
-    /mergeprocs { % def\n\
-      dup length\n\
-      3 -1 roll\n\
-      dup\n\
-      length\n\
-      dup\n\
-      5 1 roll\n\
-      3 -1 roll\n\
-      add\n\
-      array cvx\n\
-      dup\n\
-      3 -1 roll\n\
-      0 exch\n\
-      putinterval\n\
-      dup\n\
-      4 2 roll\n\
-      putinterval\n\
-    } bind def\n\
-\n\
-    /colorimage { % def\n\
-      pop pop     % remove 'false 3' operands\n\
-      {colortogray} mergeprocs\n\
-      image\n\
-    } bind def\n\
-  } ifelse          % end of 'false' case\n\
-";
-
 static const char wxPostScriptHeaderReencodeISO1[] =
     "\n/reencodeISO {\n"
 "dup dup findfont dup length dict begin\n"
@@ -215,6 +164,129 @@ static const char *wxPostScriptHeaderStrSplit =
 //-------------------------------------------------------------------------------
 
 
+// Size of the buffer used for the output, it is flushed when it becomes
+// bigger than this.
+static const size_t wxPS_BUFFER_SIZE = 64*1024;
+
+namespace
+{
+
+// Output stream encoding the data written to it using ASCII85 encoding, as
+// understood by ASCII85Decode PostScript filter, and writing the result to the
+// PostScript DC.
+//
+// This encoding is more compact than the hexadecimal one, as it only uses 5
+// characters for every 4 bytes instead of 8 of them.
+class wxPSASCII85OutputStream : public wxOutputStream
+{
+public:
+    explicit wxPSASCII85OutputStream(wxPostScriptDCImpl& dc)
+        : m_dc(dc)
+    {
+        m_tupleLen = 0;
+        m_lineLen = 0;
+    }
+
+    // Must be called after writing all the data to output the last, possibly
+    // incomplete, group of bytes and the end of data marker.
+    void Finish()
+    {
+        if ( m_tupleLen )
+        {
+            // Incomplete group is padded with zeroes and only the first
+            // m_tupleLen + 1 characters of it are output.
+            for ( size_t n = m_tupleLen; n < 4; n++ )
+                m_tuple[n] = 0;
+
+            EncodeTuple(m_tupleLen + 1);
+            m_tupleLen = 0;
+        }
+
+        m_encoded += "~>\n";
+        FlushEncoded();
+    }
+
+protected:
+    virtual size_t OnSysWrite(const void *buffer, size_t size) override
+    {
+        const unsigned char* p = static_cast<const unsigned char*>(buffer);
+        for ( size_t n = 0; n < size; n++ )
+        {
+            m_tuple[m_tupleLen++] = p[n];
+            if ( m_tupleLen == 4 )
+            {
+                EncodeTuple(5);
+                m_tupleLen = 0;
+            }
+        }
+
+        FlushEncoded();
+
+        return size;
+    }
+
+private:
+    // Encode the current tuple and output the given number of characters.
+    void EncodeTuple(size_t numChars)
+    {
+        wxUint32 value = (wxUint32(m_tuple[0]) << 24) |
+                         (wxUint32(m_tuple[1]) << 16) |
+                         (wxUint32(m_tuple[2]) << 8) |
+                          wxUint32(m_tuple[3]);
+
+        if ( value == 0 && numChars == 5 )
+        {
+            // Special abbreviation for the (common) all zeroes case.
+            AddChar('z');
+            return;
+        }
+
+        char chars[5];
+        for ( int n = 4; n >= 0; n-- )
+        {
+            chars[n] = static_cast<char>('!' + value % 85);
+            value /= 85;
+        }
+
+        for ( size_t n = 0; n < numChars; n++ )
+            AddChar(chars[n]);
+    }
+
+    void AddChar(char ch)
+    {
+        m_encoded += ch;
+
+        // Keep the lines reasonably short, as required by DSC.
+        if ( ++m_lineLen == 76 )
+        {
+            m_encoded += '\n';
+            m_lineLen = 0;
+        }
+    }
+
+    void FlushEncoded()
+    {
+        m_dc.PsWrite(m_encoded.data(), m_encoded.length());
+        m_encoded.clear();
+    }
+
+    wxPostScriptDCImpl& m_dc;
+
+    // The bytes not encoded yet.
+    unsigned char m_tuple[4];
+    size_t m_tupleLen;
+
+    // The encoded data not written to the DC yet.
+    std::string m_encoded;
+
+    // The length of the current line of the encoded data.
+    size_t m_lineLen;
+
+    wxDECLARE_NO_COPY_CLASS(wxPSASCII85OutputStream);
+};
+
+} // anonymous namespace
+
 wxIMPLEMENT_DYNAMIC_CLASS(wxPostScriptDC, wxDC);
 
 wxPostScriptDC::wxPostScriptDC()
@@ -307,8 +379,14 @@ void wxPostScriptDCImpl::Init()
 
 wxPostScriptDCImpl::~wxPostScriptDCImpl ()
 {
+    // Don't lose the buffered output if EndDoc() wasn't called.
+    if ( m_printData.GetPrintMode() == wxPRINT_MODE_STREAM )
+        PsFlush();
+
     if (m_pstream)
     {
+        PsFlush();
+
         fclose( m_pstream );
         m_pstream = nullptr;
     }
@@ -974,51 +1052,46 @@ void wxPostScriptDCImpl::DoDrawBitmap( const wxBitmap& bitmap, wxCoord x, wxCoor
     double xx = XLOG2DEV(x);
     double yy = YLOG2DEV(y + bitmap.GetHeight());
 
+    // The image data follows the procedure below in ASCII85 encoding and,
+    // if possible, compressed. Notice that the procedure is needed to consume
+    // the rest of the data, including the end of data marker, after the image
+    // is drawn, as the image operator itself doesn't do it.
     wxString buffer;
     buffer.Printf( "/origstate save def\n"
                    "20 dict begin\n"
-                   "/pix %d string def\n"
-                   "/grays %d string def\n"
-                   "/npixels 0 def\n"
-                   "/rgbindx 0 def\n"
                    "%f %f translate\n"
                    "%f %f scale\n"
-                   "%d %d 8\n"
-                   "[%d 0 0 %d 0 %d]\n"
-                   "{currentfile pix readhexstring pop}\n"
-                   "false 3 colorimage\n",
-            w, w, xx, yy, ww, hh, w, h, w, -h, h );
+                   "/DeviceRGB setcolorspace\n"
+                   "/imagedata currentfile /ASCII85Decode filter def\n"
+                   "{\n"
+                   "<<\n"
+                   "  /ImageType 1\n"
+                   "  /Width %d\n"
+                   "  /Height %d\n"
+                   "  /BitsPerComponent 8\n"
+                   "  /Decode [0 1 0 1 0 1]\n"
+                   "  /ImageMatrix [%d 0 0 %d 0 %d]\n"
+#if wxUSE_ZLIB
+                   "  /DataSource imagedata /FlateDecode filter\n"
+#else
+                   "  /DataSource imagedata\n"
+#endif
+                   ">> image\n"
+                   "imagedata flushfile\n"
+                   "} exec\n",
+            xx, yy, ww, hh, w, h, w, -h, h );
     buffer.Replace( ",", "." );
     PsPrint( buffer );
 
-    unsigned char* data = image.GetData();
-
-    // size of the buffer = width*rgb(3)*hexa(2)+'\n'
-    wxCharBuffer charbuffer(w*6 + 1);
-
-    //rows
-    for (int j = 0; j < h; j++)
-    {
-        char* bufferindex = charbuffer.data();
-
-        //cols
-        for (int i = 0; i < w*3; i++)
-        {
-            char c1, c2;
-            wxDecToHex(*data, &c1, &c2);
-            *(bufferindex++) = c1;
-            *(bufferindex++) = c2;
-
-            data++;
-        }
-        *(bufferindex++) = '\n';
-        *bufferindex = 0;
-
-        if (m_pstream)
-            fwrite( charbuffer, 1, strlen( charbuffer ), m_pstream );
-        else
-            PsPrint( charbuffer );
-    }
+    wxPSASCII85OutputStream ascii85(*this);
+#if wxUSE_ZLIB
+    wxZlibOutputStream zstream(ascii85, wxZ_DEFAULT_COMPRESSION, wxZLIB_ZLIB);
+    zstream.Write(image.GetData(), 3*w*h);
+    zstream.Close();
+#else
+    ascii85.Write(image.GetData(), 3*w*h);
+#endif
+    ascii85.Finish();
 
     PsPrint( "end\n" );
     PsPrint( "origstate restore\n" );
@@ -1667,10 +1740,23 @@ bool wxPostScriptDCImpl::StartDoc( const wxString& WXUNUSED(message) )
 
     wxString buffer;
 
+    // Images are encoded using filters which are only available in the
+    // later versions of the language, so declare the version of the DSC
+    // corresponding to the language level used.
+#if wxUSE_ZLIB
+    PsPrint( "%!PS-Adobe-3.0\n" );
+#else
     PsPrint( "%!PS-Adobe-2.0\n" );
+#endif
 
     PsPrint( "%%Creator: wxWidgets PostScript renderer\n" );
 
+#if wxUSE_ZLIB
+    PsPrint( "%%LanguageLevel: 3\n" );
+#else
+    PsPrint( "%%LanguageLevel: 2\n" );
+#endif
+
     buffer.Printf( "%%%%CreationDate: %s\n", wxNow() );
     PsPrint( buffer );
 
@@ -1708,7 +1794,6 @@ bool wxPostScriptDCImpl::StartDoc( const wxString& WXUNUSED(message) )
     PsPrint( wxPostScriptHeaderConicTo );
     PsPrint( wxPostScriptHeaderEllipse );
     PsPrint( wxPostScriptHeaderEllipticArc );
-    PsPrint( wxPostScriptHeaderColourImage );
     PsPrint( wxPostScriptHeaderReencodeISO1 );
     PsPrint( wxPostScriptHeaderReencodeISO2 );
     PsPrint( wxPostScriptHeaderStrSplit );
@@ -1739,6 +1824,8 @@ void wxPostScriptDCImpl::EndDoc ()
         PsPrint( "grestore\n" );
     }
 
+    PsFlush();
+
     if ( m_pstream ) {
         fclose( m_pstream );
         m_pstream = nullptr;
@@ -1878,6 +1965,10 @@ void wxPostScriptDCImpl::EndPage ()
     wxCHECK_RET( m_ok , wxT("invalid postscript dc") );
 
     PsPrint( "showpage\n" );
+
+    // Don't keep the data of the completed pages in memory, this allows the
+    // consumer of the output to start processing them.
+    PsFlush();
 }
 
 bool wxPostScriptDCImpl::DoBlit( wxCoord xdest, wxCoord ydest,
@@ -1914,8 +2005,31 @@ wxCoord wxPostScriptDCImpl::GetCharHeight() const
 
 void wxPostScriptDCImpl::PsPrint( const wxString& str )
 {
-    const wxCharBuffer psdata(str.utf8_str());
+    const wxScopedCharBuffer psdata(str.utf8_str());
+
+    PsWrite( psdata.data(), psdata.length() );
+}
+
+void wxPostScriptDCImpl::PsWrite( const char* psdata, size_t len )
+{
+    m_psBuffer.append( psdata, len );
+
+    if ( m_psBuffer.length() >= wxPS_BUFFER_SIZE )
+        PsFlush();
+}
 
+void wxPostScriptDCImpl::PsFlush()
+{
+    if ( m_psBuffer.empty() )
+        return;
+
+    PsWriteUnbuffered( m_psBuffer.data(), m_psBuffer.length() );
+
+    m_psBuffer.clear();
+}
+
+void wxPostScriptDCImpl::PsWriteUnbuffered( const char* psdata, size_t len )
+{
     switch (m_printData.GetPrintMode())
     {
 #if wxUSE_STREAMS
@@ -1930,7 +2044,7 @@ void wxPostScriptDCImpl::PsPrint( const wxString& str )
                 wxCHECK_RET( data, wxS("Cannot obtain output stream") );
                 wxOutputStream* outputstream = data->GetOutputStream();
                 wxCHECK_RET( outputstream, wxT("invalid outputstream") );
-                outputstream->Write( psdata, strlen( psdata ) );
+                outputstream->Write( psdata, len );
             }
             break;
 #endif // wxUSE_STREAMS
@@ -1938,7 +2052,7 @@ void wxPostScriptDCImpl::PsPrint( const wxString& str )
         // save data into file
         default:
             wxCHECK_RET( m_pstream, wxT("invalid postscript dc") );
-            fwrite( psdata, 1, strlen( psdata ), m_pstream );
+            fwrite( psdata, 1, len, m_pstream );
     }
 }
 
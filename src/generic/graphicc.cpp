@@ -184,8 +184,19 @@ public :
 
     virtual bool Contains( wxDouble x, wxDouble y, wxPolygonFillMode fillStyle = wxWINDING_RULE) const override;
 
+    // returns the path data which remains owned by this object and is only
+    // valid until the path is modified
+    const cairo_path_t* GetCairoPath() const;
+
 private :
+    // must be called whenever the path is modified
+    void InvalidateCairoPath();
+
     cairo_t* m_pathContext;
+
+    // the copy of the path returned by GetCairoPath(), created on demand and
+    // reused as long as the path doesn't change
+    mutable cairo_path_t* m_cairoPath;
 };
 
 class WXDLLIMPEXP_CORE wxCairoMatrixData : public wxGraphicsMatrixData
@@ -481,8 +492,13 @@ public:
 
     virtual void StrokePath( const wxGraphicsPath& p ) override;
     virtual void FillPath( const wxGraphicsPath& p , wxPolygonFillMode fillStyle = wxWINDING_RULE ) override;
+    virtual void DrawPathInstances( const wxGraphicsPath& path,
+                                    size_t n, const wxPoint2DDouble *offsets,
+                                    wxPolygonFillMode fillStyle = wxWINDING_RULE ) override;
     virtual void ClearRectangle( wxDouble x, wxDouble y, wxDouble w, wxDouble h ) override;
     virtual void DrawRectangle( wxDouble x, wxDouble y, wxDouble w, wxDouble h) override;
+    virtual void DrawRectangles( size_t n, const wxRect2DDouble *rects ) override;
+    virtual void DrawEllipses( size_t n, const wxRect2DDouble *rects ) override;
 
     virtual void Translate( wxDouble dx , wxDouble dy ) override;
     virtual void Scale( wxDouble xScale , wxDouble yScale ) override;
@@ -499,6 +515,8 @@ public:
 
     virtual void DrawBitmap( const wxGraphicsBitmap &bmp, wxDouble x, wxDouble y, wxDouble w, wxDouble h ) override;
     virtual void DrawBitmap( const wxBitmap &bmp, wxDouble x, wxDouble y, wxDouble w, wxDouble h ) override;
+    virtual void DrawBitmaps( const wxGraphicsBitmap &bmp, const wxRect2DDouble& rect,
+                              size_t n, const wxGraphicsMatrix *transforms ) override;
     virtual void DrawIcon( const wxIcon &icon, wxDouble x, wxDouble y, wxDouble w, wxDouble h ) override;
     virtual void PushState() override;
     virtual void PopState() override;
@@ -517,6 +535,8 @@ public:
 
 protected:
     virtual void DoDrawText( const wxString &str, wxDouble x, wxDouble y ) override;
+    virtual void DoDrawTexts( size_t n, const wxString* strings,
+                              const wxPoint2DDouble* positions ) override;
 
     void Init(cairo_t *context, bool storeInitClip = false);
 
@@ -776,13 +796,23 @@ void wxCairoPenBrushBaseData::Apply( wxGraphicsContext* context )
 {
     cairo_t* const ctext = (cairo_t*) context->GetNativeContext();
 
-    if ( m_hatchStyle != wxHATCHSTYLE_INVALID && !m_pattern )
-        InitHatchPattern(ctext);
+    if ( !m_pattern )
+    {
+        if ( m_hatchStyle != wxHATCHSTYLE_INVALID )
+        {
+            InitHatchPattern(ctext);
+        }
+        else
+        {
+            // Create the solid pattern once instead of letting
+            // cairo_set_source_rgba() allocate a new one every time we're
+            // used, setting an existing pattern only increments its
+            // reference count.
+            m_pattern = cairo_pattern_create_rgba(m_red, m_green, m_blue, m_alpha);
+        }
+    }
 
-    if ( m_pattern )
-        cairo_set_source(ctext, m_pattern);
-    else
-        cairo_set_source_rgba(ctext, m_red, m_green, m_blue, m_alpha);
+    cairo_set_source(ctext, m_pattern);
 }
 
 void wxCairoPenBrushBaseData::AddGradientStops(const wxGraphicsGradientStops& stops)
@@ -1253,6 +1283,8 @@ void wxCairoFontData::Apply( wxGraphicsContext* context )
 wxCairoPathData::wxCairoPathData( wxGraphicsRenderer* renderer, cairo_t* pathcontext)
     : wxGraphicsPathData(renderer)
 {
+    m_cairoPath = nullptr;
+
     if (pathcontext)
     {
         m_pathContext = pathcontext;
@@ -1267,6 +1299,7 @@ wxCairoPathData::wxCairoPathData( wxGraphicsRenderer* renderer, cairo_t* pathcon
 
 wxCairoPathData::~wxCairoPathData()
 {
+    InvalidateCairoPath();
     cairo_destroy(m_pathContext);
 }
 
@@ -1276,12 +1309,29 @@ wxGraphicsObjectRefData *wxCairoPathData::Clone() const
     cairo_t* pathcontext = cairo_create(surface);
     cairo_surface_destroy (surface);
 
-    cairo_path_t* path = cairo_copy_path(m_pathContext);
-    cairo_append_path(pathcontext, path);
-    cairo_path_destroy(path);
+    cairo_append_path(pathcontext, GetCairoPath());
     return new wxCairoPathData( GetRenderer() ,pathcontext);
 }
 
+const cairo_path_t* wxCairoPathData::GetCairoPath() const
+{
+    // Copying the path is relatively expensive, so do it only once instead
+    // of doing it every time the path is drawn.
+    if ( !m_cairoPath )
+        m_cairoPath = cairo_copy_path(m_pathContext);
+
+    return m_cairoPath;
+}
+
+void wxCairoPathData::InvalidateCairoPath()
+{
+    if ( m_cairoPath )
+    {
+        cairo_path_destroy(m_cairoPath);
+        m_cairoPath = nullptr;
+    }
+}
+
 
 void* wxCairoPathData::GetNativePath() const
 {
@@ -1300,28 +1350,34 @@ void wxCairoPathData::UnGetNativePath(void *p) const
 void wxCairoPathData::MoveToPoint( wxDouble x , wxDouble y )
 {
     cairo_move_to(m_pathContext,x,y);
+    InvalidateCairoPath();
 }
 
 void wxCairoPathData::AddLineToPoint( wxDouble x , wxDouble y )
 {
     cairo_line_to(m_pathContext,x,y);
+    InvalidateCairoPath();
 }
 
 void wxCairoPathData::AddPath( const wxGraphicsPathData* path )
 {
-    cairo_path_t* p = (cairo_path_t*)path->GetNativePath();
-    cairo_append_path(m_pathContext, p);
-    UnGetNativePath(p);
+    // Note that the path may be this one, so invalidate the cached data only
+    // after using it.
+    cairo_append_path(m_pathContext,
+                      static_cast<const wxCairoPathData*>(path)->GetCairoPath());
+    InvalidateCairoPath();
 }
 
 void wxCairoPathData::CloseSubpath()
 {
     cairo_close_path(m_pathContext);
+    InvalidateCairoPath();
 }
 
 void wxCairoPathData::AddCurveToPoint( wxDouble cx1, wxDouble cy1, wxDouble cx2, wxDouble cy2, wxDouble x, wxDouble y )
 {
     cairo_curve_to(m_pathContext,cx1,cy1,cx2,cy2,x,y);
+    InvalidateCairoPath();
 }
 
 // gets the last point of the current path, (0,0) if not yet set
@@ -1344,6 +1400,7 @@ void wxCairoPathData::AddArc( wxDouble x, wxDouble y, wxDouble r, double startAn
         cairo_arc(m_pathContext,x,y,r,startAngle,endAngle);
     else
         cairo_arc_negative(m_pathContext,x,y,r,startAngle,endAngle);
+    InvalidateCairoPath();
 }
 
 // transforms each point of this path by the matrix
@@ -1354,6 +1411,9 @@ void wxCairoPathData::Transform( const wxGraphicsMatrixData* matrix )
     cairo_matrix_t m = *((cairo_matrix_t*) matrix->GetNativeMatrix());
     cairo_matrix_invert( &m );
     cairo_transform(m_pathContext,&m);
+
+    // the path coordinates are returned in the new user space
+    InvalidateCairoPath();
 }
 
 // gets the bounding box enclosing all points (possibly including control points)
@@ -1406,6 +1466,7 @@ bool wxCairoPathData::Contains( wxDouble x, wxDouble y, wxPolygonFillMode fillSt
 void wxCairoPathData::AddRectangle(wxDouble x, wxDouble y, wxDouble w, wxDouble h)
 {
     cairo_rectangle(m_pathContext, x, y, w, h);
+    InvalidateCairoPath();
 }
 
 void wxCairoPathData::AddCircle(wxDouble x, wxDouble y, wxDouble r)
@@ -1413,22 +1474,35 @@ void wxCairoPathData::AddCircle(wxDouble x, wxDouble y, wxDouble r)
     cairo_move_to(m_pathContext, x+r, y);
     cairo_arc(m_pathContext, x, y, r, 0.0, 2*M_PI);
     cairo_close_path(m_pathContext);
+    InvalidateCairoPath();
 }
 
-void wxCairoPathData::AddEllipse(wxDouble x, wxDouble y, wxDouble w, wxDouble h)
+namespace
+{
+
+// Append an ellipse fitting the given rectangle to the current path.
+void AppendEllipse(cairo_t* cr, wxDouble x, wxDouble y, wxDouble w, wxDouble h)
 {
     if (w <= 0 || h <= 0)
         return;
 
-    cairo_move_to(m_pathContext, x+w, y+h/2.0);
+    cairo_move_to(cr, x+w, y+h/2.0);
     w /= 2.0;
     h /= 2.0;
-    cairo_save(m_pathContext);
-    cairo_translate(m_pathContext, x+w, y+h);
-    cairo_scale(m_pathContext, w, h);
-    cairo_arc(m_pathContext, 0.0, 0.0, 1.0, 0.0, 2*M_PI);
-    cairo_restore(m_pathContext);
-    cairo_close_path(m_pathContext);
+    cairo_save(cr);
+    cairo_translate(cr, x+w, y+h);
+    cairo_scale(cr, w, h);
+    cairo_arc(cr, 0.0, 0.0, 1.0, 0.0, 2*M_PI);
+    cairo_restore(cr);
+    cairo_close_path(cr);
+}
+
+} // anonymous namespace
+
+void wxCairoPathData::AddEllipse(wxDouble x, wxDouble y, wxDouble w, wxDouble h)
+{
+    AppendEllipse(m_pathContext, x, y, w, h);
+    InvalidateCairoPath();
 }
 
 //-----------------------------------------------------------------------------
@@ -2755,16 +2829,44 @@ void wxCairoContext::GetClipBox(wxDouble* x, wxDouble* y, wxDouble* w, wxDouble*
         *h = y2 - y1;
 }
 
+namespace
+{
+
+inline const cairo_path_t* GetCairoPath(const wxGraphicsPath& path)
+{
+    return static_cast<const wxCairoPathData*>(path.GetPathData())->GetCairoPath();
+}
+
+// Append the path translated by each of the offsets to the current path.
+void
+AppendPathInstances(cairo_t* cr,
+                    const cairo_path_t* cp,
+                    size_t n,
+                    const wxPoint2DDouble *offsets)
+{
+    cairo_matrix_t m;
+    cairo_get_matrix(cr, &m);
+
+    for ( size_t i = 0; i < n; ++i )
+    {
+        // The path is transformed using the matrix in effect when it's
+        // appended, so temporarily add the offset to it.
+        cairo_translate(cr, offsets[i].m_x, offsets[i].m_y);
+        cairo_append_path(cr, cp);
+        cairo_set_matrix(cr, &m);
+    }
+}
+
+} // anonymous namespace
+
 void wxCairoContext::StrokePath( const wxGraphicsPath& path )
 {
     if ( !m_pen.IsNull() )
     {
         OffsetHelper helper(ShouldOffset(), m_context, m_pen);
-        cairo_path_t* cp = (cairo_path_t*) path.GetNativePath() ;
-        cairo_append_path(m_context,cp);
+        cairo_append_path(m_context, GetCairoPath(path));
         ((wxCairoPenData*)m_pen.GetRefData())->Apply(this);
         cairo_stroke(m_context);
-        path.UnGetNativePath(cp);
     }
 }
 
@@ -2773,12 +2875,40 @@ void wxCairoContext::FillPath( const wxGraphicsPath& path , wxPolygonFillMode fi
     if ( !m_brush.IsNull() )
     {
         OffsetHelper helper(ShouldOffset(), m_context, m_pen);
-        cairo_path_t* cp = (cairo_path_t*) path.GetNativePath() ;
-        cairo_append_path(m_context,cp);
+        cairo_append_path(m_context, GetCairoPath(path));
+        ((wxCairoBrushData*)m_brush.GetRefData())->Apply(this);
+        cairo_set_fill_rule(m_context,fillStyle==wxODDEVEN_RULE ? CAIRO_FILL_RULE_EVEN_ODD : CAIRO_FILL_RULE_WINDING);
+        cairo_fill(m_context);
+    }
+}
+
+void wxCairoContext::DrawPathInstances( const wxGraphicsPath& path,
+                                        size_t n,
+                                        const wxPoint2DDouble *offsets,
+                                        wxPolygonFillMode fillStyle )
+{
+    wxCHECK_RET( !n || offsets, wxS("Offsets must be specified") );
+
+    if ( !n )
+        return;
+
+    const cairo_path_t* const cp = GetCairoPath(path);
+
+    if ( !m_brush.IsNull() )
+    {
+        OffsetHelper helper(ShouldOffset(), m_context, m_pen);
+        AppendPathInstances(m_context, cp, n, offsets);
         ((wxCairoBrushData*)m_brush.GetRefData())->Apply(this);
         cairo_set_fill_rule(m_context,fillStyle==wxODDEVEN_RULE ? CAIRO_FILL_RULE_EVEN_ODD : CAIRO_FILL_RULE_WINDING);
         cairo_fill(m_context);
-        path.UnGetNativePath(cp);
+    }
+
+    if ( !m_pen.IsNull() )
+    {
+        OffsetHelper helper(ShouldOffset(), m_context, m_pen);
+        AppendPathInstances(m_context, cp, n, offsets);
+        ((wxCairoPenData*)m_pen.GetRefData())->Apply(this);
+        cairo_stroke(m_context);
     }
 }
 
@@ -2808,6 +2938,55 @@ void wxCairoContext::DrawRectangle( wxDouble x, wxDouble y, wxDouble w, wxDouble
     }
 }
 
+void wxCairoContext::DrawRectangles( size_t n, const wxRect2DDouble *rects )
+{
+    wxCHECK_RET( !n || rects, wxS("Rectangles must be specified") );
+
+    if ( !m_brush.IsNull() )
+    {
+        ((wxCairoBrushData*)m_brush.GetRefData())->Apply(this);
+        for ( size_t i = 0; i < n; ++i )
+            cairo_rectangle(m_context, rects[i].m_x, rects[i].m_y,
+                            rects[i].m_width, rects[i].m_height);
+        cairo_set_fill_rule(m_context, CAIRO_FILL_RULE_WINDING);
+        cairo_fill(m_context);
+    }
+    if ( !m_pen.IsNull() )
+    {
+        OffsetHelper helper(ShouldOffset(), m_context, m_pen);
+        ((wxCairoPenData*)m_pen.GetRefData())->Apply(this);
+        for ( size_t i = 0; i < n; ++i )
+            cairo_rectangle(m_context, rects[i].m_x, rects[i].m_y,
+                            rects[i].m_width, rects[i].m_height);
+        cairo_stroke(m_context);
+    }
+}
+
+void wxCairoContext::DrawEllipses( size_t n, const wxRect2DDouble *rects )
+{
+    wxCHECK_RET( !n || rects, wxS("Rectangles must be specified") );
+
+    if ( !m_brush.IsNull() )
+    {
+        OffsetHelper helper(ShouldOffset(), m_context, m_pen);
+        for ( size_t i = 0; i < n; ++i )
+            AppendEllipse(m_context, rects[i].m_x, rects[i].m_y,
+                          rects[i].m_width, rects[i].m_height);
+        ((wxCairoBrushData*)m_brush.GetRefData())->Apply(this);
+        cairo_set_fill_rule(m_context, CAIRO_FILL_RULE_WINDING);
+        cairo_fill(m_context);
+    }
+    if ( !m_pen.IsNull() )
+    {
+        OffsetHelper helper(ShouldOffset(), m_context, m_pen);
+        for ( size_t i = 0; i < n; ++i )
+            AppendEllipse(m_context, rects[i].m_x, rects[i].m_y,
+                          rects[i].m_width, rects[i].m_height);
+        ((wxCairoPenData*)m_pen.GetRefData())->Apply(this);
+        cairo_stroke(m_context);
+    }
+}
+
 void wxCairoContext::Rotate( wxDouble angle )
 {
     cairo_rotate(m_context,angle);
@@ -2926,6 +3105,47 @@ void wxCairoContext::DrawBitmap(const wxGraphicsBitmap &bmp, wxDouble x, wxDoubl
     PopState();
 }
 
+void wxCairoContext::DrawBitmaps( const wxGraphicsBitmap &bmp,
+                                  const wxRect2DDouble& rect,
+                                  size_t n,
+                                  const wxGraphicsMatrix *transforms )
+{
+    wxCHECK_RET( !n || transforms, wxS("Transforms must be specified") );
+
+    if ( !n )
+        return;
+
+    wxCairoBitmapData* data = static_cast<wxCairoBitmapData*>(bmp.GetRefData());
+    cairo_pattern_t* pattern = data->GetCairoPattern();
+    const wxSize size = data->GetSize();
+
+    const wxDouble scaleX = rect.m_width / size.GetWidth();
+    const wxDouble scaleY = rect.m_height / size.GetHeight();
+
+    // Save the state only once for all bitmaps and just reset the matrix
+    // before drawing each of them.
+    cairo_matrix_t base;
+    cairo_get_matrix(m_context, &base);
+    cairo_save(m_context);
+
+    for ( size_t i = 0; i < n; ++i )
+    {
+        cairo_set_matrix(m_context, &base);
+        cairo_transform(m_context,
+                        (const cairo_matrix_t*) transforms[i].GetNativeMatrix());
+        cairo_translate(m_context, rect.m_x, rect.m_y);
+        cairo_scale(m_context, scaleX, scaleY);
+
+        // The pattern is locked to the user space in effect when it's set,
+        // so it has to be set again after changing the matrix.
+        cairo_set_source(m_context, pattern);
+        cairo_rectangle(m_context, 0, 0, size.GetWidth(), size.GetHeight());
+        cairo_fill(m_context);
+    }
+
+    cairo_restore(m_context);
+}
+
 void wxCairoContext::DrawIcon( const wxIcon &icon, wxDouble x, wxDouble y, wxDouble w, wxDouble h )
 {
     // An icon is a bitmap on wxGTK, so do this the easy way.  When we want to
@@ -2936,49 +3156,84 @@ void wxCairoContext::DrawIcon( const wxIcon &icon, wxDouble x, wxDouble y, wxDou
 
 
 void wxCairoContext::DoDrawText(const wxString& str, wxDouble x, wxDouble y)
+{
+    const wxPoint2DDouble pt(x, y);
+    DoDrawTexts(1, &str, &pt);
+}
+
+void wxCairoContext::DoDrawTexts(size_t n,
+                                 const wxString* strings,
+                                 const wxPoint2DDouble* positions)
 {
     wxCHECK_RET( !m_font.IsNull(),
                  wxT("wxCairoContext::DrawText - no valid font set") );
-
-    if ( str.empty())
-        return;
-
-    const wxCharBuffer data = str.utf8_str();
-    if ( !data )
-        return;
+    wxCHECK_RET( !n || (strings && positions),
+                 wxS("Strings and positions must be specified") );
 
     wxCairoFontData* const
         fontData = static_cast<wxCairoFontData*>(m_font.GetRefData());
 
-    fontData->Apply(this);
+    // Only apply the font, and create the layout, once for all the strings.
+    bool fontApplied = false;
 
 #ifdef __WXGTK__
     const wxFont& font = fontData->GetFont();
-    if ( font.IsOk() )
+    wxGtkObject<PangoLayout> layout;
+#endif // __WXGTK__
+
+    for ( size_t i = 0; i < n; ++i )
     {
-        wxGtkObject<PangoLayout> layout(pango_cairo_create_layout (m_context));
-        ApplyFont(layout, font);
-        pango_layout_set_text(layout, data, data.length());
+        const wxString& str = strings[i];
+        if ( str.empty() )
+            continue;
 
-        // Note that Pango attributes don't depend on font size, so we don't
-        // need to use the scaled font here.
-        font.GTKSetPangoAttrs(layout);
+        const wxCharBuffer data = str.utf8_str();
+        if ( !data )
+            continue;
 
-        cairo_move_to(m_context, x, y);
-        pango_cairo_show_layout (m_context, layout);
+        const wxDouble x = positions[i].m_x,
+                       y = positions[i].m_y;
 
-        // Don't use Cairo text API, we already did everything.
-        return;
-    }
+        if ( !fontApplied )
+        {
+            fontData->Apply(this);
+
+#ifdef __WXGTK__
+            if ( font.IsOk() )
+            {
+                *layout.Out() = pango_cairo_create_layout(m_context);
+                ApplyFont(layout, font);
+            }
 #endif // __WXGTK__
 
-    // Cairo's x,y for drawing text is at the baseline, so we need to adjust
-    // the position we move to by the ascent.
-    cairo_font_extents_t fe;
-    cairo_font_extents(m_context, &fe);
-    cairo_move_to(m_context, x, y+fe.ascent);
+            fontApplied = true;
+        }
+
+#ifdef __WXGTK__
+        if ( font.IsOk() )
+        {
+            pango_layout_set_text(layout, data, data.length());
 
-    cairo_show_text(m_context, data);
+            // Note that Pango attributes don't depend on font size, so we
+            // don't need to use the scaled font here.
+            font.GTKSetPangoAttrs(layout);
+
+            cairo_move_to(m_context, x, y);
+            pango_cairo_show_layout (m_context, layout);
+
+            // Don't use Cairo text API, we already did everything.
+            continue;
+        }
+#endif // __WXGTK__
+
+        // Cairo's x,y for drawing text is at the baseline, so we need to
+        // adjust the position we move to by the ascent.
+        cairo_font_extents_t fe;
+        cairo_font_extents(m_context, &fe);
+        cairo_move_to(m_context, x, y+fe.ascent);
+
+        cairo_show_text(m_context, data);
+    }
 }
 
 void wxCairoContext::GetTextExtent( const wxString &str, wxDouble *width, wxDouble *height,
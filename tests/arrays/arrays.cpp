@@ -18,6 +18,7 @@
 #endif // WX_PRECOMP
 
 #include "wx/dynarray.h"
+#include "wx/strpool.h"
 
 // ----------------------------------------------------------------------------
 // helpers for testing values and sizes
@@ -413,6 +414,77 @@ TEST_CASE("wxSortedArrayString", "[dynarray]")
     CHECK( ad.Index("z") == wxNOT_FOUND );
 }
 
+TEST_CASE("wxStringPool", "[dynarray][strpool]")
+{
+    // Use small chunks to test allocating several of them.
+    wxStringPool pool(16);
+    CHECK( pool.IsEmpty() );
+
+    CHECK( pool.Add("first") == 0 );
+    CHECK( pool.Add("") == 1 );
+    CHECK( pool.Add(wxString::FromUTF8("\xd0\xb2\xd1\x82\xd0\xbe\xd1\x80\xd0\xbe\xd0\xb9")) == 2 );
+    CHECK( pool.Add("this one is longer than the chunk") == 3 );
+    CHECK( pool.Add("last") == 4 );
+
+    REQUIRE( pool.GetCount() == 5 );
+    CHECK( pool[0] == "first" );
+    CHECK( pool[1].empty() );
+    CHECK( pool[2] == wxString::FromUTF8("\xd0\xb2\xd1\x82\xd0\xbe\xd1\x80\xd0\xbe\xd0\xb9") );
+    CHECK( pool[3].ToString() == "this one is longer than the chunk" );
+    CHECK( wxString(pool[4]) == "last" );
+    CHECK( pool[4] != pool[0] );
+
+    // The views must remain valid when more strings are added.
+    const wxPooledString first = pool[0];
+    for ( int n = 0; n < 100; n++ )
+        pool.Add(wxString::Format("string %d", n));
+    CHECK( first == "first" );
+    CHECK( pool[104] == "string 99" );
+
+    SECTION("Append")
+    {
+        wxArrayString a;
+        for ( int n = 0; n < 100; n++ )
+            a.push_back(wxString::Format("item %d", n));
+
+        pool.Append(a);
+        REQUIRE( pool.GetCount() == 205 );
+        CHECK( pool[105] == "item 0" );
+        CHECK( pool[204] == "item 99" );
+        CHECK( first == "first" );
+
+        size_t n = 0;
+        for ( const auto& s : pool )
+        {
+            if ( n++ == 105 )
+                CHECK( s == "item 0" );
+        }
+        CHECK( n == 205 );
+    }
+
+    SECTION("Empty")
+    {
+        const size_t memory = pool.GetMemoryUsage();
+        pool.Empty();
+        CHECK( pool.IsEmpty() );
+        CHECK( pool.GetMemoryUsage() == memory );
+
+        pool.Add("again");
+        CHECK( pool[0] == "again" );
+        CHECK( pool.GetMemoryUsage() == memory );
+    }
+
+    SECTION("Clear")
+    {
+        pool.Clear();
+        CHECK( pool.IsEmpty() );
+        CHECK( pool.GetMemoryUsage() == 0 );
+
+        pool.Add("again");
+        CHECK( pool[0] == "again" );
+    }
+}
+
 TEST_CASE("Arrays::Split", "[dynarray]")
 {
     // test wxSplit:
@@ -66,6 +66,12 @@ public:
     int GetNumericParameter() const { return m_numParam; }
     const wxString& GetStringParameter() const { return m_strParam; }
 
+    void SetItemsPerRun(long items, const char* name)
+    {
+        m_itemsPerRun = items;
+        m_itemsName = name;
+    }
+
 private:
     // output the results of a single benchmark if successful or just return
     // false if anything went wrong
@@ -80,6 +86,10 @@ private:
          m_runTime, // minimum time to run a single benchmark if m_numRuns == 0
          m_numParam;
     wxString m_strParam;
+
+    // number of items processed by each run of the current benchmark, if set
+    long m_itemsPerRun;
+    const char* m_itemsName;
 };
 
 wxIMPLEMENT_APP_CONSOLE(BenchApp);
@@ -102,6 +112,11 @@ wxString Bench::GetStringParameter(const wxString& defVal)
     return !val.empty() ? val : defVal;
 }
 
+void Bench::SetItemsPerRun(long items, const char* name)
+{
+    wxGetApp().SetItemsPerRun(items, name);
+}
+
 // ============================================================================
 // BenchApp implementation
 // ============================================================================
@@ -111,6 +126,8 @@ BenchApp::BenchApp()
     m_numRuns = 0; // this means to use m_runTime
     m_runTime = 500; // default minimum
     m_numParam = 0;
+    m_itemsPerRun = 0;
+    m_itemsName = nullptr;
 }
 
 bool BenchApp::OnInit()
@@ -282,6 +299,8 @@ int BenchApp::OnRun()
 
 bool BenchApp::RunSingleBenchmark(Bench::Function* func)
 {
+    SetItemsPerRun(0, nullptr);
+
     if ( !func->Init() )
         return false;
 
@@ -349,7 +368,7 @@ bool BenchApp::RunSingleBenchmark(Bench::Function* func)
     // much sense.
     if ( n == 1 )
     {
-        wxPrintf("single run took %.0fus\n", m);
+        wxPrintf("single run took %.0fus", m);
     }
     else
     {
@@ -357,11 +376,16 @@ bool BenchApp::RunSingleBenchmark(Bench::Function* func)
 
         wxPrintf
         (
-            "%12ld runs, %.0fus avg, %.0f std dev (%.0f/%.0f min/max)\n",
+            "%12ld runs, %.0fus avg, %.0f std dev (%.0f/%.0f min/max)",
             n, m, s, timeMin, timeMax
         );
     }
 
+    if ( m_itemsPerRun && m > 0 )
+        wxPrintf(", %.0f %s/sec", m_itemsPerRun*1e6/m, m_itemsName);
+
+    wxPrintf("\n");
+
     fflush(stdout);
 
     return true;
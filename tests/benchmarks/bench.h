@@ -93,6 +93,15 @@ long GetNumericParameter(long defValue = 1);
  */
 wxString GetStringParameter(const wxString& defValue = wxString());
 
+/**
+    Set the number of items processed by each run of the current benchmark.
+
+    If this is called, typically from the benchmark initialization function,
+    the number of items processed per second is shown in addition to the run
+    time, using the provided name for the items, e.g. "primitives".
+ */
+void SetItemsPerRun(long items, const char* name);
+
 } // namespace Bench
 
 /**
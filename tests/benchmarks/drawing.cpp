@@ -0,0 +1,384 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        tests/benchmarks/drawing.cpp
+// Purpose:     Offscreen wxDC and wxGraphicsContext drawing benchmarks
+// Author:      wxWidgets team
+// Created:     2026-10-17
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+// These benchmarks draw the same workloads on several kinds of offscreen
+// targets, so that they can be run without showing any windows, e.g. under
+// a virtual X server in CI builds. The image-based graphics context doesn't
+// use the display at all.
+//
+// Every run draws N primitives, as specified by the numeric parameter (1000
+// by default), and the number of primitives drawn per second is shown in
+// addition to the run time.
+//
+// Before running each benchmark, the workload is drawn once and the result
+// is compared with the one produced by the reference image-based graphics
+// context to check that the target draws something sensible. The percentage
+// of pixels significantly different from the reference is printed: this can
+// be compared between runs to detect rendering changes, but notice that it
+// is never 0 for wxMemoryDC, which doesn't use anti-aliasing.
+
+#include "wx/bitmap.h"
+#include "wx/dcgraph.h"
+#include "wx/dcmemory.h"
+#include "wx/graphics.h"
+#include "wx/image.h"
+
+#include "bench.h"
+
+#include <map>
+#include <memory>
+
+#if wxUSE_GRAPHICS_CONTEXT
+
+namespace
+{
+
+const int TARGET_WIDTH = 512;
+const int TARGET_HEIGHT = 512;
+
+// Number of primitives drawn during a single run.
+int GetPrimitivesCount()
+{
+    return Bench::GetNumericParameter(1000);
+}
+
+// Simple linear congruential generator: we don't need good random numbers,
+// but we do need the same ones on all platforms to draw the same things.
+class RandomGenerator
+{
+public:
+    RandomGenerator() : m_state(12345) { }
+
+    int Get(int max)
+    {
+        m_state = m_state * 1103515245 + 12345;
+        return static_cast<int>((m_state >> 16) % static_cast<unsigned>(max));
+    }
+
+    wxPoint GetPoint()
+    {
+        const int x = Get(TARGET_WIDTH);
+        return wxPoint(x, Get(TARGET_HEIGHT));
+    }
+
+    wxColour GetColour()
+    {
+        const int r = Get(256);
+        const int g = Get(256);
+        return wxColour(r, g, Get(256));
+    }
+
+private:
+    wxUint32 m_state;
+};
+
+// ----------------------------------------------------------------------------
+// Workloads
+// ----------------------------------------------------------------------------
+
+typedef void (*DrawFunc)(wxDC& dc, int count);
+
+void DrawLines(wxDC& dc, int count)
+{
+    RandomGenerator rng;
+    for ( int n = 0; n < count; n++ )
+    {
+        dc.SetPen(wxPen(rng.GetColour()));
+        dc.DrawLine(rng.GetPoint(), rng.GetPoint());
+    }
+}
+
+void DrawPolygons(wxDC& dc, int count)
+{
+    RandomGenerator rng;
+    dc.SetPen(*wxBLACK_PEN);
+    for ( int n = 0; n < count; n++ )
+    {
+        dc.SetBrush(wxBrush(rng.GetColour()));
+
+        const wxPoint centre = rng.GetPoint();
+        const wxPoint points[] =
+        {
+            wxPoint(centre.x, centre.y - 20),
+            wxPoint(centre.x + 19, centre.y - 6),
+            wxPoint(centre.x + 12, centre.y + 16),
+            wxPoint(centre.x - 12, centre.y + 16),
+            wxPoint(centre.x - 19, centre.y - 6),
+        };
+
+        dc.DrawPolygon(WXSIZEOF(points), points);
+    }
+}
+
+void DrawTexts(wxDC& dc, int count)
+{
+    RandomGenerator rng;
+    dc.SetFont(*wxNORMAL_FONT);
+    for ( int n = 0; n < count; n++ )
+    {
+        dc.SetTextForeground(rng.GetColour());
+        dc.DrawText("Hello, world!", rng.GetPoint());
+    }
+}
+
+// The bitmap drawn by DrawBitmaps(): it's created by InitTarget() and
+// destroyed by DoneTarget(), as it can't outlive the application object.
+wxBitmap gs_bitmap;
+
+wxBitmap CreateTestBitmap()
+{
+    wxImage image(32, 32);
+    for ( int y = 0; y < 32; y++ )
+    {
+        for ( int x = 0; x < 32; x++ )
+            image.SetRGB(x, y, x*8, y*8, (x + y)*4);
+    }
+
+    return wxBitmap(image);
+}
+
+void DrawBitmaps(wxDC& dc, int count)
+{
+    RandomGenerator rng;
+    for ( int n = 0; n < count; n++ )
+        dc.DrawBitmap(gs_bitmap, rng.GetPoint());
+}
+
+void DrawGradients(wxDC& dc, int count)
+{
+    RandomGenerator rng;
+    for ( int n = 0; n < count; n++ )
+    {
+        const wxPoint pt = rng.GetPoint();
+        const wxColour from = rng.GetColour();
+        dc.GradientFillLinear(wxRect(pt, wxSize(48, 32)), from, rng.GetColour());
+    }
+}
+
+// ----------------------------------------------------------------------------
+// Targets
+// ----------------------------------------------------------------------------
+
+enum TargetKind
+{
+    Target_MemoryDC,    // wxMemoryDC using the native drawing API
+    Target_GCDC,        // wxGCDC using the default renderer on a bitmap
+    Target_ImageGC      // wxGCDC using wxGraphicsContext drawing on wxImage
+};
+
+// The object encapsulating the DC used for drawing on one of the targets.
+class DrawingTarget
+{
+public:
+    explicit DrawingTarget(TargetKind kind)
+        : m_kind(kind)
+    {
+        if ( m_kind == Target_ImageGC )
+        {
+            m_image.Create(TARGET_WIDTH, TARGET_HEIGHT);
+            m_image.SetRGB(wxRect(0, 0, TARGET_WIDTH, TARGET_HEIGHT),
+                           255, 255, 255);
+            m_dc.reset(new wxGCDC(wxGraphicsContext::Create(m_image)));
+            return;
+        }
+
+        m_bitmap.Create(TARGET_WIDTH, TARGET_HEIGHT, 24);
+        m_memdc.SelectObject(m_bitmap);
+        m_memdc.SetBackground(*wxWHITE_BRUSH);
+        m_memdc.Clear();
+
+        if ( m_kind == Target_GCDC )
+            m_dc.reset(new wxGCDC(m_memdc));
+    }
+
+    ~DrawingTarget()
+    {
+        m_dc.reset();
+        m_memdc.SelectObject(wxNullBitmap);
+    }
+
+    bool IsOk() const
+    {
+        return m_kind == Target_MemoryDC ? m_memdc.IsOk()
+                                         : m_dc && m_dc->IsOk();
+    }
+
+    wxDC& GetDC()
+    {
+        if ( m_kind == Target_MemoryDC )
+            return m_memdc;
+
+        return *m_dc;
+    }
+
+    // Finish drawing and return the image with the result: this object can't
+    // be used any more after calling this function.
+    wxImage Finish()
+    {
+        m_dc.reset();
+
+        if ( m_kind == Target_ImageGC )
+            return m_image;
+
+        m_memdc.SelectObject(wxNullBitmap);
+        return m_bitmap.ConvertToImage();
+    }
+
+private:
+    const TargetKind m_kind;
+
+    wxImage m_image;
+    wxBitmap m_bitmap;
+    wxMemoryDC m_memdc;
+
+    // The DC used for drawing on the targets other than Target_MemoryDC.
+    std::unique_ptr<wxDC> m_dc;
+
+    wxDECLARE_NO_COPY_CLASS(DrawingTarget);
+};
+
+// Draw the workload on a new target of the given kind and return the result.
+wxImage RenderOnce(TargetKind kind, DrawFunc func)
+{
+    DrawingTarget target(kind);
+    if ( !target.IsOk() )
+        return wxImage();
+
+    // Use fewer primitives than in the benchmark to keep the image readable.
+    func(target.GetDC(), 50);
+
+    return target.Finish();
+}
+
+// Return the percentage of pixels differing from the reference by more than
+// the given tolerance in any channel.
+double GetPercentDifferent(const wxImage& image, const wxImage& ref, int tolerance)
+{
+    const unsigned char* p = image.GetData();
+    const unsigned char* q = ref.GetData();
+    const int numPixels = image.GetWidth()*image.GetHeight();
+
+    int numDifferent = 0;
+    for ( int n = 0; n < numPixels; n++, p += 3, q += 3 )
+    {
+        if ( abs(p[0] - q[0]) > tolerance ||
+                abs(p[1] - q[1]) > tolerance ||
+                    abs(p[2] - q[2]) > tolerance )
+        {
+            numDifferent++;
+        }
+    }
+
+    return 100.0*numDifferent/numPixels;
+}
+
+// Check that the target produces the same, up to anti-aliasing differences,
+// results as the reference one and print the difference.
+bool CheckRendering(const char* name, TargetKind kind, DrawFunc func)
+{
+    const wxImage image = RenderOnce(kind, func);
+    if ( !image.IsOk() )
+    {
+        wxFprintf(stderr, "%s: failed to create the target\n", name);
+        return false;
+    }
+
+    // Something must have been drawn.
+    wxImage blank(TARGET_WIDTH, TARGET_HEIGHT);
+    blank.SetRGB(wxRect(0, 0, TARGET_WIDTH, TARGET_HEIGHT), 255, 255, 255);
+    if ( GetPercentDifferent(image, blank, 0) == 0 )
+    {
+        wxFprintf(stderr, "%s: nothing was drawn\n", name);
+        return false;
+    }
+
+    if ( kind != Target_ImageGC )
+    {
+        // Cache the reference images, indexed by the workload function, as
+        // they're used by several targets.
+        static std::map<DrawFunc, wxImage> s_refs;
+
+        wxImage& ref = s_refs[func];
+        if ( !ref.IsOk() )
+            ref = RenderOnce(Target_ImageGC, func);
+
+        if ( ref.IsOk() )
+        {
+            wxPrintf("%-30s%.2f%% pixels differ from the reference\n",
+                     wxString(name) + ':',
+                     GetPercentDifferent(image, ref, 64));
+        }
+    }
+
+    return true;
+}
+
+std::unique_ptr<DrawingTarget> gs_target;
+
+void DoneTarget()
+{
+    gs_target.reset();
+    gs_bitmap = wxBitmap();
+}
+
+bool InitTarget(const char* name, TargetKind kind, DrawFunc func)
+{
+    gs_bitmap = CreateTestBitmap();
+
+    if ( !CheckRendering(name, kind, func) )
+    {
+        DoneTarget();
+        return false;
+    }
+
+    gs_target.reset(new DrawingTarget(kind));
+    if ( !gs_target->IsOk() )
+    {
+        DoneTarget();
+        return false;
+    }
+
+    Bench::SetItemsPerRun(GetPrimitivesCount(), "primitives");
+
+    return true;
+}
+
+bool RunWorkload(DrawFunc func)
+{
+    func(gs_target->GetDC(), GetPrimitivesCount());
+
+    return true;
+}
+
+} // anonymous namespace
+
+#define DRAWING_BENCHMARK(workload, target)                                   \
+    static bool Init##workload##On##target()                                  \
+    {                                                                         \
+        return InitTarget(#workload "On" #target, Target_##target,            \
+                          Draw##workload);                                    \
+    }                                                                         \
+    BENCHMARK_FUNC_WITH_INIT(workload##On##target,                            \
+                             Init##workload##On##target, DoneTarget)          \
+    {                                                                         \
+        return RunWorkload(Draw##workload);                                   \
+    }
+
+#define DRAWING_BENCHMARKS(workload)                                          \
+    DRAWING_BENCHMARK(workload, MemoryDC)                                     \
+    DRAWING_BENCHMARK(workload, GCDC)                                         \
+    DRAWING_BENCHMARK(workload, ImageGC)
+
+DRAWING_BENCHMARKS(Lines)
+DRAWING_BENCHMARKS(Polygons)
+DRAWING_BENCHMARKS(Texts)
+DRAWING_BENCHMARKS(Bitmaps)
+DRAWING_BENCHMARKS(Gradients)
+
+#endif // wxUSE_GRAPHICS_CONTEXT
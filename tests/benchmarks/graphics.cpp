@@ -18,6 +18,8 @@
 #include "wx/stopwatch.h"
 #include "wx/crt.h"
 
+#include <vector>
+
 #if wxUSE_GLCANVAS
     #include "wx/glcanvas.h"
     #ifdef _MSC_VER
@@ -68,7 +70,8 @@ struct GraphicsBenchmarkOptions
         testEllipses =
         testTextExtent =
         testMultiLineTextExtent =
-        testPartialTextExtents = false;
+        testPartialTextExtents =
+        testBatches = false;
 
         usePaint =
         useClient =
@@ -99,7 +102,8 @@ struct GraphicsBenchmarkOptions
          testEllipses,
          testTextExtent,
          testMultiLineTextExtent,
-         testPartialTextExtents;
+         testPartialTextExtents,
+         testBatches;
 
     bool usePaint,
          useClient,
@@ -390,7 +394,9 @@ private:
         else if ( opts.useGC && gcdc.IsOk() )
         {
             wxString rendName = gcdc.GetGraphicsContext()->GetRenderer()->GetName();
-            BenchmarkAll(wxString::Format("%6s GC (%s)", dckind, rendName.c_str()), gcdc);
+            const wxString msg = wxString::Format("%6s GC (%s)", dckind, rendName.c_str());
+            BenchmarkAll(msg, gcdc);
+            BenchmarkBatches(msg, gcdc.GetGraphicsContext());
         }
     }
 
@@ -692,6 +698,97 @@ private:
                  opts.numIters, t, (1000. * t)/opts.numIters);
     }
 
+    // Helper for BenchmarkBatches(): run the given function drawing all
+    // opts.numIters items and report the number of items per second.
+    template <typename F>
+    void BenchmarkItems(const wxString& msg, const char* what, const F& func)
+    {
+        wxPrintf("Benchmarking %s: ", msg);
+        fflush(stdout);
+
+        wxStopWatch sw;
+        func();
+        const long t = sw.Time();
+
+        wxPrintf("%ld %s done in %ldms = %.0f items/s\n",
+                 opts.numIters, what, t,
+                 t ? (1000. * opts.numIters)/t : 0.);
+    }
+
+    // Compare drawing the items one by one with drawing all of them at once.
+    void BenchmarkBatches(const wxString& msg, wxGraphicsContext* gc)
+    {
+        if ( !opts.testBatches )
+            return;
+
+        const size_t n = opts.numIters;
+
+        std::vector<wxRect2DDouble> rects(n);
+        std::vector<wxPoint2DDouble> points(n);
+        std::vector<wxGraphicsMatrix> transforms(n);
+        for ( size_t i = 0; i < n; i++ )
+        {
+            const double x = rand() % opts.width,
+                         y = rand() % opts.height;
+
+            rects[i] = wxRect2DDouble(x, y, 12, 8);
+            points[i] = wxPoint2DDouble(x, y);
+            transforms[i] = gc->CreateMatrix(1, 0, 0, 1, x, y);
+        }
+
+        gc->SetPen(*wxWHITE_PEN);
+        gc->SetBrush(*wxRED_BRUSH);
+
+        BenchmarkItems(msg, "single rectangles", [&]()
+            {
+                for ( const auto& r : rects )
+                    gc->DrawRectangle(r);
+            });
+        BenchmarkItems(msg, "batched rectangles", [&]()
+            {
+                gc->DrawRectangles(n, &rects[0]);
+            });
+
+        gc->SetBrush(*wxBLUE_BRUSH);
+
+        BenchmarkItems(msg, "single ellipses", [&]()
+            {
+                for ( const auto& r : rects )
+                    gc->DrawEllipse(r);
+            });
+        BenchmarkItems(msg, "batched ellipses", [&]()
+            {
+                gc->DrawEllipses(n, &rects[0]);
+            });
+
+        const wxGraphicsBitmap bmp = gc->CreateBitmap(m_bitmapARGB);
+        const wxRect2DDouble bmpRect(0, 0, 16, 16);
+
+        BenchmarkItems(msg, "single bitmaps", [&]()
+            {
+                for ( const auto& pt : points )
+                    gc->DrawBitmap(bmp, pt.m_x, pt.m_y, 16, 16);
+            });
+        BenchmarkItems(msg, "batched bitmaps", [&]()
+            {
+                gc->DrawBitmaps(bmp, bmpRect, n, &transforms[0]);
+            });
+
+        gc->SetFont(*wxNORMAL_FONT, *wxBLACK);
+
+        const std::vector<wxString> texts(n, wxString("Label"));
+
+        BenchmarkItems(msg, "single texts", [&]()
+            {
+                for ( size_t i = 0; i < n; i++ )
+                    gc->DrawText(texts[i], points[i]);
+            });
+        BenchmarkItems(msg, "batched texts", [&]()
+            {
+                gc->DrawTexts(n, &texts[0], &points[0]);
+            });
+    }
+
     void BenchmarkBitmaps(const wxString& msg, wxDC& dc)
     {
         if ( !opts.testBitmaps )
@@ -869,6 +966,7 @@ public:
             { wxCMD_LINE_SWITCH, "",  "textextent" },
             { wxCMD_LINE_SWITCH, "",  "multilinetextextent" },
             { wxCMD_LINE_SWITCH, "",  "partialtextextents" },
+            { wxCMD_LINE_SWITCH, "",  "batches" },
             { wxCMD_LINE_SWITCH, "",  "paint" },
             { wxCMD_LINE_SWITCH, "",  "client" },
             { wxCMD_LINE_SWITCH, "",  "memory" },
@@ -959,10 +1057,12 @@ public:
         opts.testTextExtent = parser.Found("textextent");
         opts.testMultiLineTextExtent = parser.Found("multilinetextextent");
         opts.testPartialTextExtents = parser.Found("partialtextextents");
+        opts.testBatches = parser.Found("batches");
         if ( !(opts.testBitmaps || opts.testImages || opts.testLines
                     || opts.testRawBitmaps || opts.testRectangles
                     || opts.testCircles || opts.testEllipses
-                    || opts.testTextExtent || opts.testPartialTextExtents) )
+                    || opts.testTextExtent || opts.testPartialTextExtents
+                    || opts.testBatches) )
         {
             // Do everything by default.
             opts.testBitmaps =
@@ -973,7 +1073,8 @@ public:
             opts.testCircles =
             opts.testEllipses =
             opts.testTextExtent =
-            opts.testPartialTextExtents = true;
+            opts.testPartialTextExtents =
+            opts.testBatches = true;
         }
 
         opts.usePaint = parser.Found("paint");
@@ -8,6 +8,8 @@
 /////////////////////////////////////////////////////////////////////////////
 
 #include "wx/image.h"
+#include "wx/imagbatch.h"
+#include "wx/quantize.h"
 
 #include "bench.h"
 
@@ -87,6 +89,38 @@ BENCHMARK_FUNC(EnlargeBoxAverage)
                        wxIMAGE_QUALITY_BOX_AVERAGE).IsOk();
 }
 
+BENCHMARK_FUNC(EnlargeBilinear)
+{
+    const wxImage& image = GetTestImage();
+    const double factor = Bench::GetNumericParameter(150) / 100.;
+    return image.Scale(factor*image.GetWidth(), factor*image.GetHeight(),
+                       wxIMAGE_QUALITY_BILINEAR).IsOk();
+}
+
+BENCHMARK_FUNC(EnlargeBicubic)
+{
+    const wxImage& image = GetTestImage();
+    const double factor = Bench::GetNumericParameter(150) / 100.;
+    return image.Scale(factor*image.GetWidth(), factor*image.GetHeight(),
+                       wxIMAGE_QUALITY_BICUBIC).IsOk();
+}
+
+BENCHMARK_FUNC(EnlargeLanczos3)
+{
+    const wxImage& image = GetTestImage();
+    const double factor = Bench::GetNumericParameter(150) / 100.;
+    return image.Scale(factor*image.GetWidth(), factor*image.GetHeight(),
+                       wxIMAGE_QUALITY_LANCZOS3).IsOk();
+}
+
+BENCHMARK_FUNC(EnlargeMitchell)
+{
+    const wxImage& image = GetTestImage();
+    const double factor = Bench::GetNumericParameter(150) / 100.;
+    return image.Scale(factor*image.GetWidth(), factor*image.GetHeight(),
+                       wxIMAGE_QUALITY_MITCHELL).IsOk();
+}
+
 BENCHMARK_FUNC(EnlargeHighQuality)
 {
     const wxImage& image = GetTestImage();
@@ -111,6 +145,38 @@ BENCHMARK_FUNC(ShrinkBoxAverage)
                        wxIMAGE_QUALITY_BOX_AVERAGE).IsOk();
 }
 
+BENCHMARK_FUNC(ShrinkBilinear)
+{
+    const wxImage& image = GetTestImage();
+    const double factor = Bench::GetNumericParameter(50) / 100.;
+    return image.Scale(factor*image.GetWidth(), factor*image.GetHeight(),
+                       wxIMAGE_QUALITY_BILINEAR).IsOk();
+}
+
+BENCHMARK_FUNC(ShrinkBicubic)
+{
+    const wxImage& image = GetTestImage();
+    const double factor = Bench::GetNumericParameter(50) / 100.;
+    return image.Scale(factor*image.GetWidth(), factor*image.GetHeight(),
+                       wxIMAGE_QUALITY_BICUBIC).IsOk();
+}
+
+BENCHMARK_FUNC(ShrinkLanczos3)
+{
+    const wxImage& image = GetTestImage();
+    const double factor = Bench::GetNumericParameter(50) / 100.;
+    return image.Scale(factor*image.GetWidth(), factor*image.GetHeight(),
+                       wxIMAGE_QUALITY_LANCZOS3).IsOk();
+}
+
+BENCHMARK_FUNC(ShrinkMitchell)
+{
+    const wxImage& image = GetTestImage();
+    const double factor = Bench::GetNumericParameter(50) / 100.;
+    return image.Scale(factor*image.GetWidth(), factor*image.GetHeight(),
+                       wxIMAGE_QUALITY_MITCHELL).IsOk();
+}
+
 BENCHMARK_FUNC(ShrinkHighQuality)
 {
     const wxImage& image = GetTestImage();
@@ -118,3 +184,196 @@ BENCHMARK_FUNC(ShrinkHighQuality)
     return image.Scale(factor*image.GetWidth(), factor*image.GetHeight(),
                        wxIMAGE_QUALITY_HIGH).IsOk();
 }
+
+// Helpers for the benchmarks below measuring how image processing scales with
+// the number of threads used.
+static const wxImage& GetLargeTestImage()
+{
+    static wxImage s_image;
+    if ( !s_image.IsOk() )
+    {
+        const wxImage& image = GetTestImage();
+        const double factor = Bench::GetNumericParameter(800) / 100.;
+        s_image = image.Scale(factor*image.GetWidth(), factor*image.GetHeight(),
+                              wxIMAGE_QUALITY_BILINEAR);
+    }
+
+    return s_image;
+}
+
+static bool ScaleUsingThreads(unsigned int threads)
+{
+    const wxImage& image = GetLargeTestImage();
+
+    wxImage::SetMaxThreads(threads);
+    const bool ok = image.Scale(image.GetWidth()*3/2, image.GetHeight()*3/2,
+                                wxIMAGE_QUALITY_HIGH).IsOk();
+    wxImage::SetMaxThreads(1);
+
+    return ok;
+}
+
+static bool BlurUsingThreads(unsigned int threads)
+{
+    const wxImage& image = GetLargeTestImage();
+
+    wxImage::SetMaxThreads(threads);
+    const bool ok = image.Blur(10).IsOk();
+    wxImage::SetMaxThreads(1);
+
+    return ok;
+}
+
+BENCHMARK_FUNC(EnlargeHighQuality1Thread)
+{
+    return ScaleUsingThreads(1);
+}
+
+BENCHMARK_FUNC(EnlargeHighQuality2Threads)
+{
+    return ScaleUsingThreads(2);
+}
+
+BENCHMARK_FUNC(EnlargeHighQuality4Threads)
+{
+    return ScaleUsingThreads(4);
+}
+
+BENCHMARK_FUNC(EnlargeHighQualityAllThreads)
+{
+    return ScaleUsingThreads(0);
+}
+
+BENCHMARK_FUNC(Blur1Thread)
+{
+    return BlurUsingThreads(1);
+}
+
+BENCHMARK_FUNC(Blur2Threads)
+{
+    return BlurUsingThreads(2);
+}
+
+BENCHMARK_FUNC(Blur4Threads)
+{
+    return BlurUsingThreads(4);
+}
+
+BENCHMARK_FUNC(BlurAllThreads)
+{
+    return BlurUsingThreads(0);
+}
+
+BENCHMARK_FUNC(BlurBox)
+{
+    const int radius = Bench::GetNumericParameter(10);
+    return GetTestImage().Blur(radius).IsOk();
+}
+
+BENCHMARK_FUNC(BlurGaussian)
+{
+    const int radius = Bench::GetNumericParameter(10);
+    return GetTestImage().Blur(radius, wxIMAGE_BLUR_GAUSSIAN).IsOk();
+}
+
+BENCHMARK_FUNC(ChangeHSV)
+{
+    wxImage image = GetLargeTestImage();
+    image.ChangeHSV(0.25, -0.3, 0.1);
+    return image.IsOk();
+}
+
+BENCHMARK_FUNC(RotateHue)
+{
+    wxImage image = GetLargeTestImage();
+    image.RotateHue(0.25);
+    return image.IsOk();
+}
+
+BENCHMARK_FUNC(ConvertToGreyscale)
+{
+    return GetLargeTestImage().ConvertToGreyscale().IsOk();
+}
+
+BENCHMARK_FUNC(ChangeLightness)
+{
+    return GetLargeTestImage().ChangeLightness(130).IsOk();
+}
+
+static bool QuantizeUsingFlags(int flags)
+{
+    const wxImage& image = GetLargeTestImage();
+
+    wxImage quantized;
+    return wxQuantize::Quantize(image, quantized, nullptr,
+                                Bench::GetNumericParameter(236), nullptr,
+                                wxQUANTIZE_FILL_DESTINATION_IMAGE | flags);
+}
+
+BENCHMARK_FUNC(QuantizeMedianCut)
+{
+    return QuantizeUsingFlags(0);
+}
+
+BENCHMARK_FUNC(QuantizeOctree)
+{
+    return QuantizeUsingFlags(wxQUANTIZE_OCTREE);
+}
+
+#if wxUSE_THREADS
+
+// Load all the test images the given number of times using the given number
+// of threads.
+static bool LoadUsingThreads(unsigned int threads)
+{
+    if ( !wxImage::FindHandler(wxBITMAP_TYPE_JPEG) )
+        wxImage::AddHandler(new wxJPEGHandler);
+    if ( !wxImage::FindHandler(wxBITMAP_TYPE_PNG) )
+        wxImage::AddHandler(new wxPNGHandler);
+
+    static const char* const files[] = { "horse.bmp", "horse.jpg", "horse.png" };
+
+    wxImageBatchLoader loader(nullptr, threads);
+
+    const int count = Bench::GetNumericParameter(10);
+    for ( int n = 0; n < count; n++ )
+    {
+        for ( const char* file : files )
+            loader.AddFile(file);
+    }
+
+    if ( !loader.Start() )
+        return false;
+
+    loader.Wait();
+
+    for ( size_t n = 0; n < loader.GetCount(); n++ )
+    {
+        if ( !loader.GetImage(n).IsOk() )
+            return false;
+    }
+
+    return true;
+}
+
+BENCHMARK_FUNC(BatchLoad1Thread)
+{
+    return LoadUsingThreads(1);
+}
+
+BENCHMARK_FUNC(BatchLoad2Threads)
+{
+    return LoadUsingThreads(2);
+}
+
+BENCHMARK_FUNC(BatchLoad4Threads)
+{
+    return LoadUsingThreads(4);
+}
+
+BENCHMARK_FUNC(BatchLoadAllThreads)
+{
+    return LoadUsingThreads(0);
+}
+
+#endif // wxUSE_THREADS
@@ -132,3 +132,48 @@ BENCHMARK_FUNC(SystemSnprintf)
     return true;
 }
 
+
+// ----------------------------------------------------------------------------
+// wxString::Format() with normal and compile-time format strings
+// ----------------------------------------------------------------------------
+
+#define DO_FORMAT_BENCHMARK(fmt)                                                           \
+    wxString s = wxString::Format(                                                         \
+        fmt("This is a reasonably long string with various %s arguments, exactly %d, "     \
+            "and is used as benchmark for %s - %% %.2f %d %s"),                            \
+        "(many!!)", 6, "this program", 23.342f, 999, g_verylongString);                    \
+    s += wxString::Format(fmt("This is a short %s string with very few words"), "test");   \
+    return !s.empty()
+
+#define DO_FORMAT_NUMBERS_BENCHMARK(fmt)                                                   \
+    wxString s;                                                                            \
+    for ( int n = 0; n < 10; n++ )                                                         \
+        s += wxString::Format(fmt("Item %d of %d: %5.1f%% done, id=%08x\n"),               \
+                              n, 10, n*10.0, n*12345);                                     \
+    return !s.empty()
+
+#define wxNORMAL_FORMAT(fmt) fmt
+
+BENCHMARK_FUNC(Format)
+{
+    DO_FORMAT_BENCHMARK(wxNORMAL_FORMAT);
+}
+
+BENCHMARK_FUNC(FormatNumbers)
+{
+    DO_FORMAT_NUMBERS_BENCHMARK(wxNORMAL_FORMAT);
+}
+
+#ifdef wxHAS_STATIC_FORMAT
+
+BENCHMARK_FUNC(StaticFormat)
+{
+    DO_FORMAT_BENCHMARK(wxSTATIC_FORMAT);
+}
+
+BENCHMARK_FUNC(StaticFormatNumbers)
+{
+    DO_FORMAT_NUMBERS_BENCHMARK(wxSTATIC_FORMAT);
+}
+
+#endif // wxHAS_STATIC_FORMAT
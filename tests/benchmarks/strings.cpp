@@ -10,10 +10,15 @@
 #include "wx/string.h"
 #include "wx/ffile.h"
 #include "wx/arrstr.h"
+#include "wx/atom.h"
+#include "wx/strpool.h"
 
 #include "bench.h"
 #include "htmlparser/htmlpars.h"
 
+#include <unordered_map>
+#include <vector>
+
 static const char asciistr[] =
     "This is just the first line of a very long 7 bit ASCII string"
     "This is just the second line of a very long 7 bit ASCII string"
@@ -361,6 +366,201 @@ BENCHMARK_FUNC(VectorStrSort)
     return !v.empty();
 }
 
+BENCHMARK_FUNC(StrPoolAdd)
+{
+    wxStringPool pool;
+    for (int i = 0; i < 100; ++i)
+    {
+        pool.Add(wxString(asciistr));
+        pool.Add(wxString(utf8str));
+    }
+    return !pool.IsEmpty();
+}
+
+// The following benchmarks store many short strings, typical of the labels
+// of list or tree items, which are too long for the small string
+// optimization of std::wstring but short enough for the allocation overhead
+// to dominate.
+namespace
+{
+
+const wxArrayString& GetShortStrings()
+{
+    static wxArrayString s_strings;
+    if ( s_strings.empty() )
+    {
+        for ( int n = 0; n < 1000; n++ )
+            s_strings.push_back(wxString::Format("Item %d", n));
+    }
+
+    return s_strings;
+}
+
+} // anonymous namespace
+
+BENCHMARK_FUNC(ArrStrShortPushBack)
+{
+    const wxArrayString& strings = GetShortStrings();
+
+    wxArrayString a;
+    for ( const auto& s : strings )
+        a.push_back(s);
+    return a.size() == strings.size();
+}
+
+BENCHMARK_FUNC(VectorStrShortPushBack)
+{
+    const wxArrayString& strings = GetShortStrings();
+
+    std::vector<wxString> v;
+    for ( const auto& s : strings )
+        v.push_back(s);
+    return v.size() == strings.size();
+}
+
+BENCHMARK_FUNC(StrPoolShortAdd)
+{
+    const wxArrayString& strings = GetShortStrings();
+
+    wxStringPool pool;
+    for ( const auto& s : strings )
+        pool.Add(s);
+    return pool.GetCount() == strings.size();
+}
+
+BENCHMARK_FUNC(StrPoolShortAppend)
+{
+    const wxArrayString& strings = GetShortStrings();
+
+    wxStringPool pool;
+    pool.Append(strings);
+    return pool.GetCount() == strings.size();
+}
+
+BENCHMARK_FUNC(StrPoolShortReuse)
+{
+    const wxArrayString& strings = GetShortStrings();
+
+    // Reuse the same pool, as would be done when refreshing a view.
+    static wxStringPool s_pool;
+    s_pool.Empty();
+    s_pool.Append(strings);
+    return s_pool.GetCount() == strings.size();
+}
+
+// ----------------------------------------------------------------------------
+// string interning
+// ----------------------------------------------------------------------------
+
+// These benchmarks compare looking up the entries in a cache using a string
+// key built from several identifiers, as wxArtProvider used to do, and using
+// a key composed of atoms, as it does now.
+namespace
+{
+
+const char* const artIDs[] =
+{
+    "wxART_ERROR", "wxART_QUESTION", "wxART_WARNING", "wxART_INFORMATION",
+    "wxART_ADD_BOOKMARK", "wxART_DEL_BOOKMARK", "wxART_HELP_SIDE_PANEL",
+    "wxART_HELP_SETTINGS", "wxART_HELP_BOOK", "wxART_HELP_FOLDER",
+    "wxART_HELP_PAGE", "wxART_GO_BACK", "wxART_GO_FORWARD", "wxART_GO_UP",
+    "wxART_GO_DOWN", "wxART_GO_TO_PARENT", "wxART_GO_HOME", "wxART_FILE_OPEN",
+};
+
+const char* const artClients[] =
+{
+    "wxART_TOOLBAR", "wxART_MENU", "wxART_BUTTON", "wxART_OTHER",
+};
+
+wxString MakeStringKey(const wxString& id, const wxString& client, int size)
+{
+    return id + '-' + client + '-' + wxString::Format("%d-%d", size, size);
+}
+
+struct AtomKey
+{
+    AtomKey(const wxString& id_, const wxString& client_, int size_)
+        : id(id_), client(client_), size(size_)
+    {
+    }
+
+    bool operator==(const AtomKey& other) const
+    {
+        return id == other.id && client == other.client && size == other.size;
+    }
+
+    wxAtom id;
+    wxAtom client;
+    int size;
+};
+
+struct AtomKeyHash
+{
+    size_t operator()(const AtomKey& key) const
+    {
+        return (key.id.GetHash()*31 + key.client.GetHash())*31 + key.size;
+    }
+};
+
+} // anonymous namespace
+
+BENCHMARK_FUNC(CacheLookupStringKey)
+{
+    static std::unordered_map<wxString, int> s_cache;
+    if ( s_cache.empty() )
+    {
+        for ( const char* id : artIDs )
+            for ( const char* client : artClients )
+                s_cache[MakeStringKey(id, client, 16)] = 1;
+    }
+
+    int found = 0;
+    for ( const char* id : artIDs )
+        for ( const char* client : artClients )
+            found += s_cache.count(MakeStringKey(id, client, 16));
+
+    return found == WXSIZEOF(artIDs)*WXSIZEOF(artClients);
+}
+
+BENCHMARK_FUNC(CacheLookupAtomKey)
+{
+    static std::unordered_map<AtomKey, int, AtomKeyHash> s_cache;
+    if ( s_cache.empty() )
+    {
+        for ( const char* id : artIDs )
+            for ( const char* client : artClients )
+                s_cache[AtomKey(id, client, 16)] = 1;
+    }
+
+    int found = 0;
+    for ( const char* id : artIDs )
+        for ( const char* client : artClients )
+            found += s_cache.count(AtomKey(id, client, 16));
+
+    return found == WXSIZEOF(artIDs)*WXSIZEOF(artClients);
+}
+
+BENCHMARK_FUNC(CacheLookupPreinternedAtomKey)
+{
+    static std::unordered_map<AtomKey, int, AtomKeyHash> s_cache;
+    static std::vector<AtomKey> s_keys;
+    if ( s_cache.empty() )
+    {
+        for ( const char* id : artIDs )
+            for ( const char* client : artClients )
+            {
+                s_keys.push_back(AtomKey(id, client, 16));
+                s_cache[s_keys.back()] = 1;
+            }
+    }
+
+    int found = 0;
+    for ( const auto& key : s_keys )
+        found += s_cache.count(key);
+
+    return found == WXSIZEOF(artIDs)*WXSIZEOF(artClients);
+}
+
 // ----------------------------------------------------------------------------
 // string case conversion
 // ----------------------------------------------------------------------------
@@ -622,6 +822,24 @@ BENCHMARK_FUNC(StringFromCDouble)
     return true;
 }
 
+BENCHMARK_FUNC(StringFromCDoubleShortest)
+{
+    for ( const auto& data : toDoubleData )
+    {
+        if ( !data.ok )
+            continue;
+
+        double d = 0.;
+        if ( !wxString::FromCDoubleShortest(data.value).ToCDouble(&d) )
+            return false;
+
+        if ( d != data.value )
+            return false;
+    }
+
+    return true;
+}
+
 BENCHMARK_FUNC(Strtod)
 {
     double d = 0.;
@@ -0,0 +1,95 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        tests/benchmarks/xrc.cpp
+// Purpose:     XRC resources loading benchmarks
+// Author:      wxWidgets team
+// Created:     2026-10-17
+// Copyright:   (c) 2026 wxWidgets team
+// Licence:     wxWindows licence
+/////////////////////////////////////////////////////////////////////////////
+
+// These benchmarks measure the time needed to create objects from an already
+// loaded XRC resource, which is dominated by finding the handler for each of
+// the XML nodes, as wxXmlResource asks all the handlers whether they can
+// handle it in turn.
+//
+// The numeric parameter specifies the number of items in the menu created
+// during each run (100 by default).
+
+#include "wx/menu.h"
+#include "wx/sstream.h"
+#include "wx/xml/xml.h"
+#include "wx/xrc/xmlres.h"
+
+#include "bench.h"
+
+#include <memory>
+
+#if wxUSE_XRC
+
+namespace
+{
+
+int GetItemsCount()
+{
+    return Bench::GetNumericParameter(100);
+}
+
+// Return XRC with a menu containing the given number of items, with a
+// separator after every 10 of them.
+wxString CreateMenuXRC(int numItems)
+{
+    wxString xrc =
+        "<?xml version=\"1.0\" ?>\n"
+        "<resource xmlns=\"http://www.wxwidgets.org/wxxrc\" version=\"2.5.3.0\">\n"
+        "<object class=\"wxMenu\" name=\"menu\">\n";
+
+    for ( int n = 0; n < numItems; n++ )
+    {
+        xrc += wxString::Format("<object class=\"wxMenuItem\" name=\"item%d\">"
+                                "<label>Item %d</label>"
+                                "<help>Help for item %d</help>"
+                                "</object>\n", n, n, n);
+
+        if ( n % 10 == 9 )
+            xrc += "<object class=\"separator\"/>\n";
+    }
+
+    xrc +=
+        "</object>\n"
+        "</resource>\n";
+
+    return xrc;
+}
+
+std::unique_ptr<wxXmlResource> gs_resource;
+
+bool InitXRC()
+{
+    gs_resource.reset(new wxXmlResource(0));
+
+    // Use all the handlers, as a real application would.
+    gs_resource->InitAllHandlers();
+
+    wxStringInputStream sis(CreateMenuXRC(GetItemsCount()));
+    std::unique_ptr<wxXmlDocument> doc(new wxXmlDocument(sis));
+    if ( !doc->IsOk() )
+        return false;
+
+    return gs_resource->LoadDocument(doc.release(), "bench.xrc");
+}
+
+void DoneXRC()
+{
+    gs_resource.reset();
+}
+
+} // anonymous namespace
+
+BENCHMARK_FUNC_WITH_INIT(XRCCreateMenu, InitXRC, DoneXRC)
+{
+    std::unique_ptr<wxMenu> menu(gs_resource->LoadMenu("menu"));
+
+    return menu && menu->GetMenuItemCount() >= static_cast<size_t>(GetItemsCount());
+}
+
+#endif // wxUSE_XRC
@@ -23,6 +23,7 @@
 #endif // __WINDOWS__
 
 #include "asserthelper.h"
+#include "testimage.h"
 
 // ----------------------------------------------------------------------------
 // tests
@@ -462,6 +463,115 @@ TEST_CASE("BitmapBundle::FromSVG", "[bmpbundle][svg]")
     CHECK( b.GetBitmap(wxSize(16, 16)).GetSize() == wxSize(16, 16) );
 }
 
+TEST_CASE("BitmapBundle::SVGCache", "[bmpbundle][svg]")
+{
+    static const char svg_data[] =
+        "<svg width=\"200\" height=\"200\" xmlns=\"http://www.w3.org/2000/svg\">"
+        "<rect x=\"50\" y=\"50\" width=\"100\" height=\"100\" fill=\"red\"/>"
+        "</svg>"
+        ;
+
+    const size_t limitOrig = wxBitmapBundle::GetSVGCacheLimit();
+    wxBitmapBundle::TrimSVGCache();
+    CHECK( wxBitmapBundle::GetSVGCacheSize() == 0 );
+
+    wxBitmapBundle b1 = wxBitmapBundle::FromSVG(svg_data, wxSize(16, 16));
+    REQUIRE( b1.IsOk() );
+
+    const wxBitmap bmp16 = b1.GetBitmap(wxSize(16, 16));
+    const wxBitmap bmp32 = b1.GetBitmap(wxSize(32, 32));
+    CHECK( wxBitmapBundle::GetSVGCacheSize() == (16*16 + 32*32)*4 );
+
+    // Both bitmaps must be cached, even if they're requested alternately.
+    CHECK( b1.GetBitmap(wxSize(16, 16)).IsSameAs(bmp16) );
+    CHECK( b1.GetBitmap(wxSize(32, 32)).IsSameAs(bmp32) );
+
+    // Another bundle created from the same data must reuse the same bitmaps.
+    wxBitmapBundle b2 = wxBitmapBundle::FromSVG(svg_data, wxSize(24, 24));
+    REQUIRE( b2.IsOk() );
+    CHECK( b2.GetDefaultSize() == wxSize(24, 24) );
+    CHECK( b2.GetBitmap(wxSize(32, 32)).IsSameAs(bmp32) );
+    CHECK( wxBitmapBundle::GetSVGCacheSize() == (16*16 + 32*32)*4 );
+
+    // Lowering the limit must discard the least recently used bitmap.
+    wxBitmapBundle::SetSVGCacheLimit(32*32*4);
+    CHECK( wxBitmapBundle::GetSVGCacheSize() == 32*32*4 );
+    CHECK( b1.GetBitmap(wxSize(32, 32)).IsSameAs(bmp32) );
+    CHECK( !b1.GetBitmap(wxSize(16, 16)).IsSameAs(bmp16) );
+
+    // But the last used bitmap is always kept.
+    CHECK( wxBitmapBundle::GetSVGCacheSize() == 16*16*4 );
+
+    wxBitmapBundle::TrimSVGCache();
+    CHECK( wxBitmapBundle::GetSVGCacheSize() == 0 );
+
+    wxBitmapBundle::SetSVGCacheLimit(limitOrig);
+}
+
+TEST_CASE("BitmapBundle::SVGThreads", "[bmpbundle][svg]")
+{
+    static const char svg_data[] =
+        "<svg width=\"200\" height=\"200\" xmlns=\"http://www.w3.org/2000/svg\">"
+        "<circle cx=\"100\" cy=\"100\" r=\"90\" fill=\"green\"/>"
+        "<rect x=\"20\" y=\"60\" width=\"160\" height=\"30\" fill=\"blue\"/>"
+        "</svg>"
+        ;
+
+    const wxSize size(1000, 1000);
+
+    wxBitmapBundle b = wxBitmapBundle::FromSVG(svg_data, wxSize(32, 32));
+    REQUIRE( b.IsOk() );
+
+    wxBitmapBundle::TrimSVGCache();
+    const wxImage expected = b.GetBitmap(size).ConvertToImage();
+
+    // Rasterizing the image in bands in parallel must give the same result,
+    // up to the rounding of the anti-aliased pixels.
+    wxBitmapBundle::TrimSVGCache();
+    wxImage::SetMaxThreads(4);
+    const wxImage tiled = b.GetBitmap(size).ConvertToImage();
+    wxImage::SetMaxThreads(1);
+
+    CHECK_THAT( tiled, RGBSimilarTo(expected, 1) );
+
+#if wxUSE_THREADS
+    // And so must rasterizing it in background.
+    wxBitmapBundle::TrimSVGCache();
+
+    // Use the notification sent when the bitmap is ready rather than checking
+    // whether GetBitmap() still returns the placeholder, as the bitmap may be
+    // already ready by the time we call it for the first time.
+    wxEvtHandler handler;
+    bool done = false;
+    handler.Bind(wxEVT_THREAD, [&done](wxThreadEvent&) { done = true; });
+
+    wxBitmapBundle async = wxBitmapBundle::FromSVGAsync(svg_data,
+                                                        wxSize(32, 32),
+                                                        size,
+                                                        &handler);
+    REQUIRE( async.IsOk() );
+
+    // Until the bitmap is ready, a placeholder of the right size is returned.
+    CHECK( async.GetBitmap(size).GetSize() == size );
+
+    for ( int n = 0; n < 1000 && !done; n++ )
+    {
+        wxMilliSleep(10);
+        handler.ProcessPendingEvents();
+    }
+
+    REQUIRE( done );
+
+    const wxBitmap bitmap = async.GetBitmap(size);
+    CHECK_THAT( bitmap.ConvertToImage(), RGBSimilarTo(expected, 0) );
+
+    // The bitmap must be available to the other bundles using this image.
+    CHECK( b.GetBitmap(size).IsSameAs(bitmap) );
+
+    wxBitmapBundle::TrimSVGCache();
+#endif // wxUSE_THREADS
+}
+
 TEST_CASE("BitmapBundle::FromSVG-alpha", "[bmpbundle][svg][alpha]")
 {
     static const char svg_data[] =
@@ -0,0 +1,146 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        tests/graphics/dcbuffer.cpp
+// Purpose:     wxBufferedDC unit tests
+// Author:      wxWidgets team
+// Created:     2026-10-17
+// Copyright:   (c) 2026 wxWidgets team
+///////////////////////////////////////////////////////////////////////////////
+
+// ----------------------------------------------------------------------------
+// headers
+// ----------------------------------------------------------------------------
+
+#include "testprec.h"
+
+#include "wx/dcbuffer.h"
+#include "wx/dcmemory.h"
+
+#include "wx/private/dcbuffer.h"
+
+#include "asserthelper.h"
+
+// ----------------------------------------------------------------------------
+// helper functions
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+void FillRect(wxBitmap& bmp, const wxRect& rect, const wxColour& col)
+{
+    wxMemoryDC dc(bmp);
+    dc.SetPen(*wxTRANSPARENT_PEN);
+    dc.SetBrush(wxBrush(col));
+    dc.DrawRectangle(rect);
+}
+
+wxColour GetPixel(const wxBitmap& bmp, int x, int y)
+{
+    const wxImage image = bmp.ConvertToImage();
+    return wxColour(image.GetRed(x, y), image.GetGreen(x, y), image.GetBlue(x, y));
+}
+
+// wxBufferedDC only allowing derived classes to set the blit region.
+class RegionBufferedDC : public wxBufferedDC
+{
+public:
+    RegionBufferedDC(wxDC* dc, wxBitmap& buffer, const wxRegion& region)
+        : wxBufferedDC(dc, buffer)
+    {
+        SetBlitRegion(region);
+    }
+};
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------
+// tests
+// ----------------------------------------------------------------------------
+
+TEST_CASE("BufferedDC::BlitRegion", "[dc][buffer]")
+{
+    wxBitmap target(20, 20);
+    FillRect(target, wxRect(0, 0, 20, 20), *wxRED);
+
+    wxBitmap buffer(20, 20);
+
+    const wxRect rect(5, 3, 4, 6);
+    {
+        wxMemoryDC dc(target);
+        RegionBufferedDC bdc(&dc, buffer, wxRegion(rect));
+
+        bdc.SetPen(*wxTRANSPARENT_PEN);
+        bdc.SetBrush(*wxBLUE_BRUSH);
+        bdc.DrawRectangle(0, 0, 20, 20);
+    }
+
+    // Only the pixels inside the blit region must have been copied.
+    const wxImage image = target.ConvertToImage();
+    for ( int y = 0; y < 20; y++ )
+    {
+        for ( int x = 0; x < 20; x++ )
+        {
+            INFO("Pixel at (" << x << ", " << y << ")");
+
+            const wxColour expected = rect.Contains(x, y) ? *wxBLUE : *wxRED;
+            CHECK( wxColour(image.GetRed(x, y),
+                            image.GetGreen(x, y),
+                            image.GetBlue(x, y)) == expected );
+        }
+    }
+}
+
+TEST_CASE("BufferedDC::BackingStoreReuse", "[dc][buffer]")
+{
+    wxWindowBackingStore store;
+
+    // The first time everything must be drawn.
+    CHECK( store.Prepare(wxSize(20, 10), 1.0, wxPoint()) );
+    REQUIRE( store.GetBitmap().IsOk() );
+    CHECK( store.GetBitmap().GetLogicalSize() == wxSize(20, 10) );
+
+    {
+        const wxBitmap bmp = store.GetBitmap();
+
+        // The same bitmap is reused when nothing changes.
+        CHECK( !store.Prepare(wxSize(20, 10), 1.0, wxPoint()) );
+        CHECK( store.GetBitmap().IsSameAs(bmp) );
+    }
+
+    // And its contents are preserved.
+    FillRect(store.GetBitmap(), wxRect(0, 0, 20, 10), *wxGREEN);
+    CHECK( !store.Prepare(wxSize(20, 10), 1.0, wxPoint()) );
+    CHECK( GetPixel(store.GetBitmap(), 10, 5) == *wxGREEN );
+
+    // But everything must be redrawn when the size changes.
+    CHECK( store.Prepare(wxSize(30, 10), 1.0, wxPoint()) );
+    CHECK( store.GetBitmap().GetLogicalSize() == wxSize(30, 10) );
+}
+
+TEST_CASE("BufferedDC::BackingStoreScroll", "[dc][buffer]")
+{
+    wxWindowBackingStore store;
+    CHECK( store.Prepare(wxSize(20, 20), 1.0, wxPoint()) );
+
+    FillRect(store.GetBitmap(), wxRect(0, 0, 20, 10), *wxRED);
+    FillRect(store.GetBitmap(), wxRect(0, 10, 20, 10), *wxBLUE);
+
+    // Scrolling the window down by 5 pixels moves the existing contents up,
+    // without requiring redrawing everything.
+    CHECK( !store.Prepare(wxSize(20, 20), 1.0, wxPoint(0, -5)) );
+
+    const wxBitmap& bmp = store.GetBitmap();
+    CHECK( GetPixel(bmp, 10, 0) == *wxRED );
+    CHECK( GetPixel(bmp, 10, 4) == *wxRED );
+    CHECK( GetPixel(bmp, 10, 5) == *wxBLUE );
+    CHECK( GetPixel(bmp, 10, 14) == *wxBLUE );
+
+    // Scrolling back moves them down again, the part above which was scrolled
+    // out is not preserved, but the rest must be.
+    CHECK( !store.Prepare(wxSize(20, 20), 1.0, wxPoint(0, 0)) );
+
+    CHECK( GetPixel(store.GetBitmap(), 10, 5) == *wxRED );
+    CHECK( GetPixel(store.GetBitmap(), 10, 9) == *wxRED );
+    CHECK( GetPixel(store.GetBitmap(), 10, 10) == *wxBLUE );
+    CHECK( GetPixel(store.GetBitmap(), 10, 19) == *wxBLUE );
+}
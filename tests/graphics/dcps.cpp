@@ -0,0 +1,236 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        tests/graphics/dcps.cpp
+// Purpose:     wxPostScriptDC unit tests
+// Author:      wxWidgets team
+// Created:     2026-10-17
+// Copyright:   (c) 2026 wxWidgets team
+///////////////////////////////////////////////////////////////////////////////
+
+// ----------------------------------------------------------------------------
+// headers
+// ----------------------------------------------------------------------------
+
+#include "testprec.h"
+
+#if wxUSE_PRINTING_ARCHITECTURE && wxUSE_POSTSCRIPT && wxUSE_STREAMS
+
+#include "wx/dcps.h"
+#include "wx/mstream.h"
+#include "wx/prntbase.h"
+#include "wx/generic/prntdlgg.h"
+
+#if wxUSE_ZLIB
+    #include "wx/zstream.h"
+#endif
+
+#include <memory>
+#include <string>
+
+// ----------------------------------------------------------------------------
+// helper functions
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+// Print factory always using the generic PostScript print data, as only it
+// supports wxPRINT_MODE_STREAM.
+class PostScriptPrintFactory : public wxNativePrintFactory
+{
+public:
+    virtual wxPrintNativeDataBase *CreatePrintNativeData() override
+    {
+        return new wxPostScriptPrintNativeData;
+    }
+};
+
+// Create print data for printing into the given stream.
+//
+// Note that this resets the print factory to the default one after creating
+// the data, which is not the same as the one used before if the platform
+// uses its own native printing framework, but no other tests use printing.
+wxPrintData CreateStreamPrintData(wxOutputStream& stream)
+{
+    wxPrintFactory::SetPrintFactory(new PostScriptPrintFactory);
+    wxPrintData printData;
+    wxPrintFactory::SetPrintFactory(nullptr);
+
+    wxPostScriptPrintNativeData* const
+        data = wxDynamicCast(printData.GetNativeData(),
+                             wxPostScriptPrintNativeData);
+    REQUIRE( data );
+    data->SetOutputStream(&stream);
+
+    printData.SetPrintMode(wxPRINT_MODE_STREAM);
+
+    return printData;
+}
+
+std::string GetStreamContents(const wxMemoryOutputStream& stream)
+{
+    const size_t len = stream.GetLength();
+    std::string s(len, '\0');
+    if ( len )
+        stream.CopyTo(&s[0], len);
+
+    return s;
+}
+
+// Decode ASCII85-encoded data, which must be terminated by "~>".
+bool DecodeASCII85(const std::string& s, size_t pos, std::string& decoded)
+{
+    wxUint32 value = 0;
+    int count = 0;
+    for ( ; pos < s.length(); pos++ )
+    {
+        const char ch = s[pos];
+        if ( ch == '~' )
+        {
+            if ( pos + 1 == s.length() || s[pos + 1] != '>' )
+                return false;
+
+            // The last incomplete group is padded with the maximal digit.
+            if ( count == 1 )
+                return false;
+
+            if ( count )
+            {
+                for ( int n = count; n < 5; n++ )
+                    value = value*85 + 84;
+
+                for ( int n = 0; n < count - 1; n++ )
+                    decoded += static_cast<char>(value >> (24 - 8*n));
+            }
+
+            return true;
+        }
+
+        if ( ch == '\n' || ch == '\r' || ch == ' ' )
+            continue;
+
+        if ( ch == 'z' )
+        {
+            if ( count )
+                return false;
+
+            decoded.append(4, '\0');
+            continue;
+        }
+
+        if ( ch < '!' || ch > 'u' )
+            return false;
+
+        value = value*85 + (ch - '!');
+        if ( ++count == 5 )
+        {
+            for ( int n = 0; n < 4; n++ )
+                decoded += static_cast<char>(value >> (24 - 8*n));
+
+            value = 0;
+            count = 0;
+        }
+    }
+
+    // Missing end of data marker.
+    return false;
+}
+
+// Find the data of the (only) image in the PostScript output and decode it.
+std::string ExtractImageData(const std::string& ps)
+{
+    const size_t start = ps.find("} exec\n");
+    REQUIRE( start != std::string::npos );
+
+    std::string data;
+    REQUIRE( DecodeASCII85(ps, start + strlen("} exec\n"), data) );
+
+#if wxUSE_ZLIB
+    wxMemoryInputStream mis(data.data(), data.length());
+    wxZlibInputStream zis(mis, wxZLIB_ZLIB);
+
+    std::string inflated;
+    char buf[1024];
+    while ( zis.Read(buf, sizeof(buf)).LastRead() )
+        inflated.append(buf, zis.LastRead());
+
+    data = inflated;
+#endif // wxUSE_ZLIB
+
+    return data;
+}
+
+wxImage CreateTestImage()
+{
+    // Use an odd size to have the image data length not divisible by 4 and
+    // make some rows black to check that the groups of zeroes are encoded
+    // correctly too.
+    wxImage image(17, 9);
+    for ( int y = 0; y < image.GetHeight(); y++ )
+    {
+        for ( int x = 0; x < image.GetWidth(); x++ )
+        {
+            if ( y % 3 == 1 )
+                image.SetRGB(x, y, 0, 0, 0);
+            else
+                image.SetRGB(x, y, x*15, y*28, (x*y) % 256);
+        }
+    }
+
+    return image;
+}
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------
+// tests
+// ----------------------------------------------------------------------------
+
+TEST_CASE("PostScriptDC::Bitmap", "[dc][ps]")
+{
+    const wxImage image = CreateTestImage();
+
+    wxMemoryOutputStream stream;
+    {
+        wxPostScriptDC dc(CreateStreamPrintData(stream));
+        REQUIRE( dc.IsOk() );
+
+        REQUIRE( dc.StartDoc("test") );
+        dc.StartPage();
+        dc.DrawBitmap(wxBitmap(image), 10, 20);
+        dc.EndPage();
+        dc.EndDoc();
+    }
+
+    const std::string ps = GetStreamContents(stream);
+    CHECK( ps.find("showpage") != std::string::npos );
+
+    const std::string data = ExtractImageData(ps);
+    REQUIRE( data.length() == 3u*image.GetWidth()*image.GetHeight() );
+    CHECK( memcmp(data.data(), image.GetData(), data.length()) == 0 );
+}
+
+TEST_CASE("PostScriptDC::NoEndDoc", "[dc][ps]")
+{
+    wxMemoryOutputStream stream;
+    {
+        wxPostScriptDC dc(CreateStreamPrintData(stream));
+        REQUIRE( dc.StartDoc("test") );
+        dc.StartPage();
+        dc.DrawLine(0, 0, 100, 100);
+
+        // Don't call EndDoc(): the output must still be written to the
+        // stream when the DC is destroyed.
+    }
+
+    const std::string ps = GetStreamContents(stream);
+#if wxUSE_ZLIB
+    CHECK( ps.find("%!PS-Adobe-3.0\n") == 0 );
+    CHECK( ps.find("%%LanguageLevel: 3\n") != std::string::npos );
+#else
+    CHECK( ps.find("%!PS-Adobe-2.0\n") == 0 );
+    CHECK( ps.find("%%LanguageLevel: 2\n") != std::string::npos );
+#endif
+    CHECK( ps.find("stroke") != std::string::npos );
+}
+
+#endif // wxUSE_PRINTING_ARCHITECTURE && wxUSE_POSTSCRIPT && wxUSE_STREAMS
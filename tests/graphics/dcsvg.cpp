@@ -0,0 +1,164 @@
+///////////////////////////////////////////////////////////////////////////////
+// Name:        tests/graphics/dcsvg.cpp
+// Purpose:     wxSVGFileDC unit tests
+// Author:      wxWidgets team
+// Created:     2026-10-17
+// Copyright:   (c) 2026 wxWidgets team
+///////////////////////////////////////////////////////////////////////////////
+
+// ----------------------------------------------------------------------------
+// headers
+// ----------------------------------------------------------------------------
+
+#include "testprec.h"
+
+#if wxUSE_SVG
+
+#include "wx/dcsvg.h"
+#include "wx/ffile.h"
+#include "wx/log.h"
+#include "wx/sstream.h"
+#include "wx/wfstream.h"
+#include "wx/zstream.h"
+
+#include "testfile.h"
+
+// ----------------------------------------------------------------------------
+// helper functions
+// ----------------------------------------------------------------------------
+
+namespace
+{
+
+wxString ReadSVG(const wxString& filename)
+{
+    wxFFile file(filename);
+    REQUIRE( file.IsOpened() );
+
+    wxString s;
+    REQUIRE( file.ReadAll(&s, wxConvUTF8) );
+
+    return s;
+}
+
+size_t CountOccurrences(const wxString& s, const wxString& what)
+{
+    size_t count = 0;
+    for ( size_t pos = s.find(what); pos != wxString::npos;
+          pos = s.find(what, pos + what.length()) )
+    {
+        count++;
+    }
+
+    return count;
+}
+
+void DrawTestLines(wxDC& dc)
+{
+    dc.SetPen(*wxBLACK_PEN);
+    dc.DrawLine(0, 0, 10, 10);
+    dc.DrawLine(10, 0, 0, 10);
+
+    dc.SetPen(*wxRED_PEN);
+    dc.DrawLine(-5, 5, 15, 5);
+}
+
+} // anonymous namespace
+
+// ----------------------------------------------------------------------------
+// tests
+// ----------------------------------------------------------------------------
+
+TEST_CASE("SVGFileDC::Lines", "[dc][svg]")
+{
+    TempFile svg("lines.svg");
+
+    SECTION("Default")
+    {
+        {
+            wxSVGFileDC dc(svg.GetName());
+            DrawTestLines(dc);
+        }
+
+        const wxString s = ReadSVG(svg.GetName());
+        CHECK( CountOccurrences(s, "<path ") == 3 );
+        CHECK( s.Contains("<path d=\"M0 0 L10 10\" ") );
+        CHECK( s.Contains("<path d=\"M-5 5 L15 5\" ") );
+        CHECK( s.EndsWith("</svg>\n") );
+    }
+
+    SECTION("Coalesced")
+    {
+        {
+            wxSVGFileDC dc(svg.GetName());
+            dc.EnableLineCoalescing();
+            DrawTestLines(dc);
+        }
+
+        const wxString s = ReadSVG(svg.GetName());
+        CHECK( CountOccurrences(s, "<path ") == 2 );
+        CHECK( s.Contains("<path d=\"M0 0 L10 10 M10 0 L0 10\" ") );
+        CHECK( s.Contains("<path d=\"M-5 5 L15 5\" ") );
+        CHECK( s.EndsWith("</svg>\n") );
+    }
+}
+
+TEST_CASE("SVGFileDC::Numbers", "[dc][svg]")
+{
+    TempFile svg("numbers.svg");
+
+    {
+        wxSVGFileDC dc(svg.GetName());
+        dc.DrawEllipse(0, 0, 11, 20);
+        dc.DrawRoundedRectangle(1, 2, 30, 40, 2.5);
+    }
+
+    const wxString s = ReadSVG(svg.GetName());
+    CHECK( s.Contains("<ellipse cx=\"5.50\" cy=\"10.00\" rx=\"5.50\" ry=\"10.00\" ") );
+    CHECK( s.Contains("<rect x=\"1\" y=\"2\" width=\"30\" height=\"40\" rx=\"2.50\" ") );
+}
+
+TEST_CASE("SVGFileDC::InvalidPath", "[dc][svg]")
+{
+    // Suppress the error message about failing to create the file.
+    wxLogNull noLog;
+
+    wxSVGFileDC dc("/no/such/dir/invalid.svg");
+    CHECK( !dc.IsOk() );
+
+    // Drawing on an invalid DC must not crash and must not make it valid.
+    DrawTestLines(dc);
+    CHECK( !dc.IsOk() );
+}
+
+#if wxUSE_ZLIB
+
+TEST_CASE("SVGFileDC::Compressed", "[dc][svg]")
+{
+    TempFile svg("compressed.svg");
+    TempFile svgz("compressed.svgz");
+
+    {
+        wxSVGFileDC dc(svg.GetName());
+        DrawTestLines(dc);
+    }
+
+    {
+        wxSVGFileDC dc(svgz.GetName());
+        REQUIRE( dc.IsOk() );
+        DrawTestLines(dc);
+    }
+
+    wxFileInputStream fis(svgz.GetName());
+    REQUIRE( fis.IsOk() );
+
+    wxZlibInputStream zis(fis, wxZLIB_GZIP);
+    wxStringOutputStream sos(nullptr, wxConvUTF8);
+    zis.Read(sos);
+
+    CHECK( sos.GetString() == ReadSVG(svg.GetName()) );
+}
+
+#endif // wxUSE_ZLIB
+
+#endif // wxUSE_SVG
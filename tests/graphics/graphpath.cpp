@@ -18,6 +18,9 @@
 #include "wx/bitmap.h"
 #include "wx/dcmemory.h"
 #include "wx/dcgraph.h"
+#include "wx/image.h"
+
+#include "testimage.h"
 
 #include <memory>
 
@@ -841,11 +844,209 @@ static void TestBox(wxGraphicsContext* gc)
     }
 }
 
+static void TestModifyAfterDraw(wxGraphicsContext* gc)
+{
+    // Drawing the path may cache its native representation, check that it's
+    // updated when the path changes.
+    wxGraphicsPath path = gc->CreatePath();
+    path.AddRectangle(10, 20, 30, 40);
+    gc->FillPath(path);
+
+    path.AddRectangle(100, 120, 50, 60);
+    gc->FillPath(path);
+
+    wxGraphicsPath copy = gc->CreatePath();
+    copy.AddPath(path);
+    WX_CHECK_BOX(copy.GetBox(), wxRect2DDouble(10, 20, 140, 160), 1E-3);
+
+    // Also check that adding the path to itself works.
+    path.AddPath(path);
+    WX_CHECK_BOX(path.GetBox(), wxRect2DDouble(10, 20, 140, 160), 1E-3);
+}
+
 static void DoAllTests(wxGraphicsContext* gc)
 {
     gc->DisableOffset();
     TestCurrentPoint(gc);
     TestBox(gc);
+    TestModifyAfterDraw(gc);
+}
+
+static wxColour ColourAt(const wxImage& image, int x, int y)
+{
+    return wxColour(image.GetRed(x, y), image.GetGreen(x, y), image.GetBlue(x, y));
+}
+
+// Return true if any pixel inside the given rectangle is not white.
+static bool HasNonWhitePixels(const wxImage& image, const wxRect& rect)
+{
+    for ( int y = rect.GetTop(); y <= rect.GetBottom(); y++ )
+    {
+        for ( int x = rect.GetLeft(); x <= rect.GetRight(); x++ )
+        {
+            if ( ColourAt(image, x, y) != *wxWHITE )
+                return true;
+        }
+    }
+
+    return false;
+}
+
+TEST_CASE("GraphicsPath::DrawInstances", "[path]")
+{
+    wxBitmap bmp(100, 100);
+    {
+        wxMemoryDC mdc(bmp);
+        mdc.SetBackground(*wxWHITE_BRUSH);
+        mdc.Clear();
+
+        std::unique_ptr<wxGraphicsContext> gc(wxGraphicsContext::Create(mdc));
+        REQUIRE(gc);
+
+        gc->SetBrush(*wxRED_BRUSH);
+        gc->SetPen(wxNullGraphicsPen);
+
+        wxGraphicsPath path = gc->CreatePath();
+        path.AddRectangle(0, 0, 20, 20);
+
+        // Note that the last two instances overlap.
+        const wxPoint2DDouble offsets[] = { {10, 10}, {50, 50}, {60, 60} };
+        gc->DrawPathInstances(path, WXSIZEOF(offsets), offsets);
+    }
+
+    const wxImage image = bmp.ConvertToImage();
+    CHECK( ColourAt(image, 20, 20) == *wxRED );
+    CHECK( ColourAt(image, 55, 55) == *wxRED );
+    CHECK( ColourAt(image, 65, 65) == *wxRED );
+    CHECK( ColourAt(image, 75, 75) == *wxRED );
+    CHECK( ColourAt(image, 40, 40) == *wxWHITE );
+    CHECK( ColourAt(image, 5, 5) == *wxWHITE );
+}
+
+TEST_CASE("GraphicsContext::DrawBatches", "[path]")
+{
+    wxBitmap bmp(100, 100);
+    {
+        wxMemoryDC mdc(bmp);
+        mdc.SetBackground(*wxWHITE_BRUSH);
+        mdc.Clear();
+
+        std::unique_ptr<wxGraphicsContext> gc(wxGraphicsContext::Create(mdc));
+        REQUIRE(gc);
+
+        gc->SetPen(wxNullGraphicsPen);
+
+        gc->SetBrush(*wxRED_BRUSH);
+        const wxRect2DDouble rects[] = { {0, 0, 20, 20}, {30, 0, 20, 20} };
+        gc->DrawRectangles(WXSIZEOF(rects), rects);
+
+        gc->SetBrush(*wxBLUE_BRUSH);
+        const wxRect2DDouble ellipses[] = { {0, 50, 40, 40}, {50, 50, 40, 40} };
+        gc->DrawEllipses(WXSIZEOF(ellipses), ellipses);
+    }
+
+    const wxImage image = bmp.ConvertToImage();
+    CHECK( ColourAt(image, 10, 10) == *wxRED );
+    CHECK( ColourAt(image, 40, 10) == *wxRED );
+    CHECK( ColourAt(image, 25, 10) == *wxWHITE );
+    CHECK( ColourAt(image, 20, 70) == *wxBLUE );
+    CHECK( ColourAt(image, 70, 70) == *wxBLUE );
+    CHECK( ColourAt(image, 52, 52) == *wxWHITE );
+}
+
+TEST_CASE("GraphicsContext::DrawTexts", "[path][text]")
+{
+    const wxString strings[] = { "Hello", "World" };
+    const wxPoint2DDouble positions[] = { {5, 5}, {50, 60} };
+
+    // Draw the strings either all at once or one by one.
+    const auto draw = [&strings, &positions](bool all)
+    {
+        wxBitmap bmp(100, 100);
+        {
+            wxMemoryDC mdc(bmp);
+            mdc.SetBackground(*wxWHITE_BRUSH);
+            mdc.Clear();
+
+            std::unique_ptr<wxGraphicsContext> gc(wxGraphicsContext::Create(mdc));
+            REQUIRE(gc);
+
+            gc->SetFont(*wxNORMAL_FONT, *wxBLACK);
+
+            if ( all )
+            {
+                gc->DrawTexts(WXSIZEOF(strings), strings, positions);
+            }
+            else
+            {
+                for ( size_t n = 0; n < WXSIZEOF(strings); n++ )
+                    gc->DrawText(strings[n], positions[n].m_x, positions[n].m_y);
+            }
+        }
+
+        return bmp.ConvertToImage();
+    };
+
+    const wxImage image = draw(true);
+
+    // Both strings must have been drawn at their positions and nothing else.
+    CHECK( HasNonWhitePixels(image, wxRect(0, 0, 50, 35)) );
+    CHECK( HasNonWhitePixels(image, wxRect(45, 55, 55, 45)) );
+    CHECK( !HasNonWhitePixels(image, wxRect(0, 40, 45, 60)) );
+    CHECK( !HasNonWhitePixels(image, wxRect(60, 0, 40, 50)) );
+
+    CHECK_THAT( image, RGBSameAs(draw(false)) );
+}
+
+TEST_CASE("GraphicsContext::DrawBitmaps", "[path][bitmap]")
+{
+    wxBitmap bmpRed(10, 10);
+    {
+        wxMemoryDC mdc(bmpRed);
+        mdc.SetBackground(*wxRED_BRUSH);
+        mdc.Clear();
+    }
+
+    wxBitmap bmp(100, 100);
+    {
+        wxMemoryDC mdc(bmp);
+        mdc.SetBackground(*wxWHITE_BRUSH);
+        mdc.Clear();
+
+        std::unique_ptr<wxGraphicsContext> gc(wxGraphicsContext::Create(mdc));
+        REQUIRE(gc);
+
+        wxGraphicsMatrix transforms[3];
+        for ( wxGraphicsMatrix& m : transforms )
+            m = gc->CreateMatrix();
+
+        transforms[1].Translate(50, 0);
+
+        // The transforms are combined with the current one.
+        gc->Translate(0, 10);
+        transforms[2].Translate(30, 50);
+        transforms[2].Scale(3, 2);
+
+        const wxGraphicsBitmap gbmp = gc->CreateBitmap(bmpRed);
+        gc->DrawBitmaps(gbmp, wxRect2DDouble(10, 0, 10, 10),
+                        WXSIZEOF(transforms), transforms);
+    }
+
+    const wxImage image = bmp.ConvertToImage();
+
+    // The first instance is at (10, 10) and the second one at (60, 10).
+    CHECK( ColourAt(image, 12, 12) == *wxRED );
+    CHECK( ColourAt(image, 17, 17) == *wxRED );
+    CHECK( ColourAt(image, 62, 12) == *wxRED );
+    CHECK( ColourAt(image, 67, 17) == *wxRED );
+    CHECK( ColourAt(image, 40, 15) == *wxWHITE );
+    CHECK( ColourAt(image, 15, 5) == *wxWHITE );
+
+    // The third one is scaled and covers (60, 60) - (90, 80).
+    CHECK( ColourAt(image, 62, 62) == *wxRED );
+    CHECK( ColourAt(image, 87, 77) == *wxRED );
+    CHECK( ColourAt(image, 75, 85) == *wxWHITE );
+    CHECK( ColourAt(image, 55, 70) == *wxWHITE );
 }
 
 #endif //  wxUSE_GRAPHICS_CONTEXT
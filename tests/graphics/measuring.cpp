@@ -167,6 +167,101 @@ TEST_CASE("wxDC::GetPartialTextExtent", "[dc][text-extent][partial]")
     CHECK( widths[4] == dc.GetTextExtent("Hello").x );
 }
 
+TEST_CASE("wxDC::GetTextExtents", "[dc][text-extent]")
+{
+    wxClientDC dc(wxTheApp->GetTopWindow());
+
+    const wxString strings[] = { "Hello", wxString(), "world!" };
+    wxSize extents[WXSIZEOF(strings)];
+    dc.GetTextExtents(WXSIZEOF(strings), strings, extents);
+
+    for ( size_t n = 0; n < WXSIZEOF(strings); n++ )
+    {
+        INFO("String #" << n);
+        CHECK( extents[n] == dc.GetTextExtent(strings[n]) );
+    }
+}
+
+TEST_CASE("wxWindow::TextExtentCache", "[window][text-extent]")
+{
+    wxWindow* const win = wxTheApp->GetTopWindow();
+
+    const wxSize sizeUncached = win->GetTextExtent("Cached string");
+
+    wxDC::EnableTextExtentCache();
+
+    size_t hits, misses;
+    wxDC::GetTextExtentCacheStats(&hits, &misses);
+
+    CHECK( win->GetTextExtent("Cached string") == sizeUncached );
+    CHECK( win->GetTextExtent("Cached string") == sizeUncached );
+
+    size_t hits2, misses2;
+    wxDC::GetTextExtentCacheStats(&hits2, &misses2);
+
+    // Not all ports use the cache, but if the string was added to it, it must
+    // have been found there the second time.
+    if ( misses2 != misses )
+    {
+        CHECK( misses2 == misses + 1 );
+        CHECK( hits2 == hits + 1 );
+    }
+
+    // Using a different font must not use the cached value.
+    wxFont font = win->GetFont();
+    font.SetFractionalPointSize(2*font.GetFractionalPointSize());
+    int width;
+    win->GetTextExtent("Cached string", &width, nullptr, nullptr, nullptr, &font);
+    CHECK( width > sizeUncached.x );
+
+    wxDC::EnableTextExtentCache(0);
+    wxDC::ClearTextExtentCache();
+}
+
+TEST_CASE("wxDC::PartialTextExtentCache", "[dc][text-extent][partial]")
+{
+    wxClientDC dc(wxTheApp->GetTopWindow());
+    dc.SetFont(*wxNORMAL_FONT);
+
+    wxArrayInt widthsUncached;
+    REQUIRE( dc.GetPartialTextExtents("Cached string", widthsUncached) );
+
+    wxDC::EnableTextExtentCache();
+
+    size_t hits, misses;
+    wxDC::GetTextExtentCacheStats(&hits, &misses);
+
+    wxArrayInt widths;
+    REQUIRE( dc.GetPartialTextExtents("Cached string", widths) );
+    CHECK( widths == widthsUncached );
+
+    REQUIRE( dc.GetPartialTextExtents("Cached string", widths) );
+    CHECK( widths == widthsUncached );
+
+    size_t hits2, misses2;
+    wxDC::GetTextExtentCacheStats(&hits2, &misses2);
+
+    // As above, the cache is not used by all ports, but if it is, the second
+    // call must have used the value cached by the first one.
+    if ( misses2 != misses )
+    {
+        CHECK( misses2 == misses + 1 );
+        CHECK( hits2 == hits + 1 );
+    }
+
+    // Using a different font must not use the cached values.
+    wxFont font = *wxNORMAL_FONT;
+    font.SetFractionalPointSize(2*font.GetFractionalPointSize());
+    dc.SetFont(font);
+
+    REQUIRE( dc.GetPartialTextExtents("Cached string", widths) );
+    REQUIRE( widths.size() == widthsUncached.size() );
+    CHECK( widths.back() > widthsUncached.back() );
+
+    wxDC::EnableTextExtentCache(0);
+    wxDC::ClearTextExtentCache();
+}
+
 #ifdef TEST_GC
 
 TEST_CASE("wxGC::GetTextExtent", "[dc][text-extent]")
@@ -22,8 +22,11 @@
 #include "wx/anidecod.h" // wxImageArray
 #include "wx/bitmap.h"
 #include "wx/cursor.h"
+#include "wx/gifdecod.h"
 #include "wx/icon.h"
+#include "wx/imagbatch.h"
 #include "wx/palette.h"
+#include "wx/quantize.h"
 #include "wx/url.h"
 #include "wx/log.h"
 #include "wx/mstream.h"
@@ -32,6 +35,7 @@
 #include "wx/clipbrd.h"
 #include "wx/dataobj.h"
 #include "wx/utils.h"
+#include "wx/scopeguard.h"
 
 // Check if we can use wxDIB::ConvertToBitmap(), which only exists for MSW and
 // which assumes the target is little-endian (matching the file format)
@@ -44,6 +48,7 @@
 #include "testimage.h"
 
 #include <memory>
+#include <set>
 
 #define CHECK_EQUAL_COLOUR_RGB(c1, c2) \
     CHECK( (int)c1.Red()   == (int)c2.Red() ); \
@@ -211,6 +216,201 @@ TEST_CASE_METHOD(ImageHandlersInit, "wxImage::LoadFromZipStream", "[image]")
     }
 }
 
+TEST_CASE_METHOD(ImageHandlersInit, "wxImage::IncrementalDecoder", "[image][incremental]")
+{
+    class RowsCounter : public wxImageDecodeListener
+    {
+    public:
+        virtual bool OnImageStarted(const wxImage& image) override
+        {
+            m_size = image.GetSize();
+            return true;
+        }
+
+        virtual bool OnRowsDecoded(const wxImage& image,
+                                   int firstRow,
+                                   int numRows,
+                                   int pass) override
+        {
+            CHECK( firstRow >= 0 );
+            CHECK( firstRow + numRows <= image.GetHeight() );
+
+            m_calls++;
+            m_passes = wxMax(m_passes, pass + 1);
+
+            return m_calls != m_cancelAfter;
+        }
+
+        wxSize m_size;
+        int m_calls = 0;
+        int m_passes = 0;
+        int m_cancelAfter = -1;
+    };
+
+    // Note that toucan.png, unlike horse.png, uses a palette and has
+    // transparent pixels, while the last image has translucent ones.
+    const wxString file = GENERATE("horse.png", "horse.jpg", "image/toucan.png",
+        "image/paste_input_overlay_transparent_border_semitransparent_circle.png");
+    const wxBitmapType type = file.EndsWith(".jpg") ? wxBITMAP_TYPE_JPEG
+                                                    : wxBITMAP_TYPE_PNG;
+
+    wxMemoryOutputStream memOut;
+    {
+        wxFileInputStream in(file);
+        REQUIRE( in.IsOk() );
+        in.Read(memOut);
+    }
+
+    const wxStreamBuffer* const buf = memOut.GetOutputStreamBuffer();
+    const unsigned char* const data =
+        static_cast<const unsigned char*>(buf->GetBufferStart());
+    const size_t len = buf->GetIntPosition();
+
+    const wxImage expected(file, type);
+    REQUIRE( expected.IsOk() );
+
+    std::unique_ptr<wxImageIncrementalDecoder>
+        decoder(wxImageIncrementalDecoder::Create(type));
+    REQUIRE( decoder );
+
+    RowsCounter counter;
+    decoder->SetListener(&counter);
+
+    SECTION("Small chunks")
+    {
+        for ( size_t n = 0; n < len; n += 100 )
+            REQUIRE( decoder->Feed(data + n, wxMin(100, len - n)) );
+
+        REQUIRE( decoder->Finish() );
+        CHECK( decoder->IsDone() );
+        CHECK( counter.m_size == expected.GetSize() );
+        CHECK( counter.m_calls > 1 );
+        CHECK_THAT( decoder->GetImage(), RGBASameAs(expected) );
+        CHECK( decoder->GetImage().HasAlpha() == expected.HasAlpha() );
+        CHECK( decoder->GetImage().HasMask() == expected.HasMask() );
+#if wxUSE_PALETTE
+        CHECK( decoder->GetImage().HasPalette() == expected.HasPalette() );
+#endif // wxUSE_PALETTE
+    }
+
+    SECTION("Stream")
+    {
+        wxMemoryInputStream in(data, len);
+        REQUIRE( decoder->Load(in) );
+        CHECK_THAT( decoder->GetImage(), RGBASameAs(expected) );
+        CHECK( decoder->GetImage().HasAlpha() == expected.HasAlpha() );
+        CHECK( decoder->GetImage().HasMask() == expected.HasMask() );
+
+#if wxUSE_PALETTE
+        const wxImage& image = decoder->GetImage();
+        CHECK( image.HasPalette() == expected.HasPalette() );
+        if ( file == "image/toucan.png" )
+        {
+            REQUIRE( image.HasPalette() );
+            CHECK( image.GetPalette().GetColoursCount() ==
+                    expected.GetPalette().GetColoursCount() );
+        }
+#endif // wxUSE_PALETTE
+    }
+
+    SECTION("Cancel")
+    {
+        counter.m_cancelAfter = 2;
+
+        bool ok = true;
+        for ( size_t n = 0; n < len && ok; n += 100 )
+            ok = decoder->Feed(data + n, wxMin(100, len - n));
+
+        CHECK( !ok );
+        CHECK( decoder->GetState() == wxImageIncrementalDecoder::State_Cancelled );
+        CHECK( counter.m_calls == 2 );
+    }
+
+    SECTION("Truncated")
+    {
+        decoder->SetVerbose(false);
+
+        REQUIRE( decoder->Feed(data, len / 2) );
+        CHECK( decoder->GetState() == wxImageIncrementalDecoder::State_Decoding );
+        CHECK( decoder->GetImage().GetSize() == expected.GetSize() );
+    }
+}
+
+TEST_CASE_METHOD(ImageHandlersInit, "wxImage::LoadMaxSize", "[image]")
+{
+    const wxImage full("horse.png", wxBITMAP_TYPE_PNG);
+    REQUIRE( full.IsOk() );
+
+    // This file is interlaced, so the PNG handler only needs to decode the
+    // first passes of it and the result must be the same as taking every 4th
+    // pixel of the full image.
+    wxImage image;
+    image.SetOption(wxIMAGE_OPTION_MAX_WIDTH, 60);
+    REQUIRE( image.LoadFile("horse.png", wxBITMAP_TYPE_PNG) );
+    REQUIRE( image.GetSize() == wxSize(50, 50) );
+    CHECK( image.GetOptionInt(wxIMAGE_OPTION_ORIGINAL_WIDTH) == 200 );
+    CHECK( image.GetOptionInt(wxIMAGE_OPTION_ORIGINAL_HEIGHT) == 200 );
+
+    int numDifferent = 0;
+    for ( int y = 0; y < 50; y++ )
+    {
+        for ( int x = 0; x < 50; x++ )
+        {
+            if ( image.GetRed(x, y) != full.GetRed(4*x, 4*y) ||
+                    image.GetGreen(x, y) != full.GetGreen(4*x, 4*y) ||
+                        image.GetBlue(x, y) != full.GetBlue(4*x, 4*y) )
+            {
+                numDifferent++;
+            }
+        }
+    }
+    CHECK( numDifferent == 0 );
+
+    wxImage jpeg;
+    jpeg.SetOption(wxIMAGE_OPTION_MAX_HEIGHT, 100);
+    REQUIRE( jpeg.LoadFile("horse.jpg", wxBITMAP_TYPE_JPEG) );
+    CHECK( jpeg.GetSize() == wxSize(100, 100) );
+    CHECK( jpeg.GetOptionInt(wxIMAGE_OPTION_ORIGINAL_WIDTH) == 200 );
+}
+
+#if wxUSE_THREADS
+
+TEST_CASE_METHOD(ImageHandlersInit, "wxImage::BatchLoader", "[image][batch]")
+{
+    static const char* const files[] = { "horse.png", "horse.jpg", "horse.bmp" };
+
+    wxImageBatchLoader loader(nullptr, 2);
+    for ( int n = 0; n < 4; n++ )
+    {
+        for ( const char* file : files )
+            loader.AddFile(file);
+    }
+
+    const size_t bad = loader.AddFile("nonexistent.png");
+
+    {
+        wxLogNull noLog;
+
+        REQUIRE( loader.Start() );
+        loader.Wait();
+    }
+
+    CHECK( !loader.IsRunning() );
+    REQUIRE( loader.GetCount() == 13 );
+
+    for ( size_t n = 0; n < bad; n++ )
+    {
+        INFO("Image #" << n << " loaded from " << files[n % 3]);
+
+        const wxImage expected(files[n % 3]);
+        CHECK_THAT( loader.GetImage(n), RGBSameAs(expected) );
+    }
+
+    CHECK( !loader.GetImage(bad).IsOk() );
+}
+
+#endif // wxUSE_THREADS
+
 TEST_CASE_METHOD(ImageHandlersInit, "wxImage::SizeImage", "[image]")
 {
    // Test the wxImage::Size() function which takes a rectangle from source and
@@ -1310,6 +1510,50 @@ TEST_CASE_METHOD(ImageHandlersInit, "wxImage::BadGIF", "[image][gif][error]")
     CHECK( image.GetSize() == wxSize(1200, 800) );
 }
 
+TEST_CASE_METHOD(ImageHandlersInit, "wxGIFDecoder::LazyDecoding", "[image][gif]")
+{
+#if wxUSE_PALETTE
+    wxImage image("horse.gif");
+    REQUIRE( image.IsOk() );
+
+    wxImageArray images;
+    images.push_back(image);
+    for (int i = 0; i < 5-1; ++i)
+    {
+        images.push_back( images[i].Rotate90() );
+
+        images[i+1].SetPalette(images[0].GetPalette());
+    }
+
+    wxMemoryOutputStream memOut;
+    REQUIRE( wxGIFHandler().SaveAnimation(images, &memOut) );
+
+    wxGIFDecoder eager;
+    wxMemoryInputStream memIn(memOut);
+    REQUIRE( eager.Load(memIn) );
+    REQUIRE( eager.GetFrameCount() == 5 );
+
+    wxGIFDecoder lazy;
+    lazy.SetLazyDecoding(2);
+    memIn.SeekI(0);
+    REQUIRE( lazy.Load(memIn) );
+    REQUIRE( lazy.GetFrameCount() == 5 );
+
+    // Access the frames in a non sequential order to check that the evicted
+    // frames are decoded again correctly.
+    const unsigned int frames[] = { 0, 1, 2, 0, 3, 1, 4, 4, 2 };
+    for ( unsigned int n : frames )
+    {
+        wxImage expected, actual;
+        REQUIRE( eager.ConvertToImage(n, &expected) );
+        REQUIRE( lazy.ConvertToImage(n, &actual) );
+
+        wxINFO_FMT("Lazily decoded GIF frame %u differs", n);
+        CHECK_THAT( actual, RGBSameAs(expected) );
+    }
+#endif // #if wxUSE_PALETTE
+}
+
 #endif // wxUSE_GIF
 
 TEST_CASE_METHOD(ImageHandlersInit, "wxImage::DibPadding", "[image]")
@@ -1581,6 +1825,257 @@ TEST_CASE_METHOD(ImageHandlersInit, "wxImage::ScaleCompare", "[image]")
                                "image/cross_nearest_neighb_256x256.png");
 }
 
+// Check that all pixels of the image have the given colour and alpha (if the
+// latter is not -1).
+static void CheckConstantImage(const wxImage& image,
+                               unsigned char r, unsigned char g, unsigned char b,
+                               int alpha = -1)
+{
+    REQUIRE( image.IsOk() );
+    REQUIRE( image.HasAlpha() == (alpha != -1) );
+
+    for ( int y = 0; y < image.GetHeight(); y++ )
+    {
+        for ( int x = 0; x < image.GetWidth(); x++ )
+        {
+            wxINFO_FMT("Pixel at (%d, %d)", x, y);
+
+            CHECK( image.GetRed(x, y) == r );
+            CHECK( image.GetGreen(x, y) == g );
+            CHECK( image.GetBlue(x, y) == b );
+            if ( alpha != -1 )
+                CHECK( image.GetAlpha(x, y) == alpha );
+        }
+    }
+}
+
+TEST_CASE("wxImage::ScaleResample", "[image][scale]")
+{
+    const wxImageResizeQuality quality = GENERATE(wxIMAGE_QUALITY_LANCZOS3,
+                                                  wxIMAGE_QUALITY_MITCHELL);
+
+    // Filter support, i.e. the radius of the filter when upscaling.
+    const double support = quality == wxIMAGE_QUALITY_LANCZOS3 ? 3 : 2;
+
+    const wxSize sizes[] =
+    {
+        wxSize(30, 25),     // downscale by exactly 2
+        wxSize(17, 37),     // downscale and upscale by fractional factors
+        wxSize(61, 50),     // tiny change in one direction only
+        wxSize(120, 100),   // upscale by 2
+        wxSize(1, 1),
+    };
+
+    SECTION("Constant")
+    {
+        // Resampling a uniform image must preserve it exactly everywhere,
+        // including near the edges, even though the filters used here have
+        // negative lobes.
+        wxImage image(60, 50, false);
+        image.SetRGB(wxRect(0, 0, 60, 50), 10, 128, 250);
+
+        for ( const wxSize& size : sizes )
+        {
+            wxINFO_FMT("Scaling to %d*%d", size.x, size.y);
+            CheckConstantImage(image.Scale(size.x, size.y, quality),
+                               10, 128, 250);
+        }
+
+        image.SetAlpha();
+        memset(image.GetAlpha(), 100, 60*50);
+
+        for ( const wxSize& size : sizes )
+        {
+            wxINFO_FMT("Scaling to %d*%d with alpha", size.x, size.y);
+            CheckConstantImage(image.Scale(size.x, size.y, quality),
+                               10, 128, 250, 100);
+        }
+    }
+
+    SECTION("Gradient")
+    {
+        // Both filters reproduce the linear functions, so resampling a linear
+        // gradient must give the values of the same gradient at the centres
+        // of the new pixels, up to rounding, except near the image edges,
+        // where the values beyond the edge are taken to be the same as the
+        // edge pixels and so don't follow the gradient.
+        const int width = 60,
+                  height = 50;
+
+        wxImage image(width, height, false);
+        for ( int y = 0; y < height; y++ )
+        {
+            for ( int x = 0; x < width; x++ )
+                image.SetRGB(x, y, 10 + 3*x, 20 + 4*y, 200);
+        }
+
+        for ( const wxSize& size : sizes )
+        {
+            const wxImage scaled = image.Scale(size.x, size.y, quality);
+            REQUIRE( scaled.GetSize() == size );
+
+            const double scaleX = static_cast<double>(width) / size.x,
+                         scaleY = static_cast<double>(height) / size.y;
+            const double radiusX = support * wxMax(scaleX, 1.0),
+                         radiusY = support * wxMax(scaleY, 1.0);
+
+            for ( int y = 0; y < size.y; y++ )
+            {
+                const double srcY = (y + 0.5) * scaleY - 0.5;
+                if ( srcY - radiusY < 0 || srcY + radiusY > height - 1 )
+                    continue;
+
+                for ( int x = 0; x < size.x; x++ )
+                {
+                    const double srcX = (x + 0.5) * scaleX - 0.5;
+                    if ( srcX - radiusX < 0 || srcX + radiusX > width - 1 )
+                        continue;
+
+                    wxINFO_FMT("Pixel at (%d, %d) when scaling to %d*%d",
+                               x, y, size.x, size.y);
+
+                    CHECK( scaled.GetRed(x, y) ==
+                           Approx(10 + 3*srcX).margin(1) );
+                    CHECK( scaled.GetGreen(x, y) ==
+                           Approx(20 + 4*srcY).margin(1) );
+                    CHECK( scaled.GetBlue(x, y) == 200 );
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("wxImage::Blur", "[image][blur]")
+{
+    const wxImageBlurMode mode = GENERATE(wxIMAGE_BLUR_BOX,
+                                          wxIMAGE_BLUR_GAUSSIAN);
+
+    SECTION("Constant")
+    {
+        // Blurring must preserve a uniform image, including its edges, as the
+        // pixels beyond them are assumed to be the same as the edge ones.
+        wxImage image(40, 30, false);
+        image.SetRGB(wxRect(0, 0, 40, 30), 10, 128, 250);
+        image.SetAlpha();
+        memset(image.GetAlpha(), 100, 40*30);
+
+        for ( int radius : { 1, 5, 8, 50 } )
+        {
+            wxINFO_FMT("Blur radius %d", radius);
+            CheckConstantImage(image.Blur(radius, mode), 10, 128, 250, 100);
+        }
+    }
+
+    SECTION("Edge")
+    {
+        // Blur a vertical edge between black and white halves of the image.
+        const int width = 60,
+                  height = 10;
+
+        wxImage image(width, height);
+        image.SetRGB(wxRect(width / 2, 0, width / 2, height), 255, 255, 255);
+
+        const int radius = 8;
+        const wxImage blurred = image.Blur(radius, mode);
+        REQUIRE( blurred.GetSize() == image.GetSize() );
+
+        for ( int x = 0; x < width; x++ )
+        {
+            wxINFO_FMT("Pixel at x=%d", x);
+
+            // The rows must still be identical.
+            for ( int y = 1; y < height; y++ )
+                CHECK( blurred.GetRed(x, y) == blurred.GetRed(x, 0) );
+
+            // And the result must be symmetric with respect to the edge (up to
+            // rounding).
+            CHECK( blurred.GetRed(x, 0) + blurred.GetRed(width - 1 - x, 0) ==
+                   Approx(255).margin(1) );
+
+            // Compare with the exact profile of the blurred edge: for the box
+            // blur it's a linear ramp, while for the Gaussian one, with the
+            // standard deviation of half the radius, it's given by the normal
+            // distribution function.
+            const double d = x - (width - 1) / 2.0;
+
+            double expected;
+            if ( mode == wxIMAGE_BLUR_GAUSSIAN )
+            {
+                expected = 255*(1 + erf(d / (radius / 2.0) / sqrt(2.0))) / 2;
+            }
+            else
+            {
+                const double t = (d + radius + 0.5) / (2*radius + 1);
+                expected = 255*wxMin(wxMax(t, 0.0), 1.0);
+            }
+
+            CHECK( blurred.GetRed(x, 0) == Approx(expected).margin(5) );
+        }
+    }
+}
+
+TEST_CASE("wxImage::MaxThreads", "[image][scale][blur]")
+{
+    // The image must be big enough to be split into several bands of rows
+    // (and of columns, for the vertical blur pass) processed by different
+    // threads, i.e. have at least 4*65536 pixels.
+    const int width = 512,
+              height = 512;
+
+    wxImage image(width, height, false);
+    image.SetAlpha();
+
+    unsigned char* data = image.GetData();
+    unsigned char* alpha = image.GetAlpha();
+    for ( int y = 0; y < height; y++ )
+    {
+        for ( int x = 0; x < width; x++ )
+        {
+            *data++ = static_cast<unsigned char>(x*7 + y*13);
+            *data++ = static_cast<unsigned char>(x*y);
+            *data++ = static_cast<unsigned char>((x ^ y)*5);
+            *alpha++ = static_cast<unsigned char>(x + y*3);
+        }
+    }
+
+    const unsigned int maxThreadsOrig = wxImage::GetMaxThreads();
+    wxON_BLOCK_EXIT1(wxImage::SetMaxThreads, maxThreadsOrig);
+
+    // Compute the results using the given number of threads.
+    const auto process = [&image](unsigned int maxThreads)
+    {
+        wxImage::SetMaxThreads(maxThreads);
+
+        std::vector<wxImage> results;
+        for ( wxImageResizeQuality quality : { wxIMAGE_QUALITY_NEAREST,
+                                               wxIMAGE_QUALITY_BILINEAR,
+                                               wxIMAGE_QUALITY_BICUBIC,
+                                               wxIMAGE_QUALITY_BOX_AVERAGE,
+                                               wxIMAGE_QUALITY_LANCZOS3,
+                                               wxIMAGE_QUALITY_MITCHELL } )
+        {
+            results.push_back(image.Scale(600, 700, quality));
+            results.push_back(image.Scale(256, 600, quality));
+        }
+
+        results.push_back(image.Blur(5, wxIMAGE_BLUR_BOX));
+        results.push_back(image.Blur(5, wxIMAGE_BLUR_GAUSSIAN));
+
+        return results;
+    };
+
+    // The results must not depend on the number of threads used.
+    const std::vector<wxImage> single = process(1);
+    const std::vector<wxImage> multi = process(4);
+
+    REQUIRE( multi.size() == single.size() );
+    for ( size_t n = 0; n < single.size(); n++ )
+    {
+        wxINFO_FMT("Result #%zu", n);
+        CHECK_THAT( multi[n], RGBASameAs(single[n]) );
+    }
+}
+
 TEST_CASE_METHOD(ImageHandlersInit, "wxImage::CreateBitmapFromCursor", "[image]")
 {
 #if !defined __WXOSX_IPHONE__ && !defined __WXDFB__ && !defined __WXX11__
@@ -2463,6 +2958,27 @@ TEST_CASE_METHOD(ImageHandlersInit, "wxImage::ChangeColours", "[image]")
     CHECK_THAT(test, RGBSimilarToFile("image/toucan_mono_255_255_255.png"));
 }
 
+TEST_CASE("wxImage::RotateHueWrap", "[image][hsv]")
+{
+    // Rotating the hue of these pixels gives exactly 360 degrees, which must
+    // wrap around to 0 and so result in red and not in some other colour.
+    wxImage image(2, 1);
+    image.SetRGB(0, 0, 0x00, 0xff, 0x00);
+    image.SetRGB(1, 0, 0x00, 0x00, 0xff);
+
+    wxImage test = image;
+    test.RotateHue(2.0/3.0);
+    CHECK( test.GetRed(0, 0) == 0xff );
+    CHECK( test.GetGreen(0, 0) == 0x00 );
+    CHECK( test.GetBlue(0, 0) == 0x00 );
+
+    test = image;
+    test.ChangeHSV(1.0/3.0, 0.0, 0.0);
+    CHECK( test.GetRed(1, 0) == 0xff );
+    CHECK( test.GetGreen(1, 0) == 0x00 );
+    CHECK( test.GetBlue(1, 0) == 0x00 );
+}
+
 TEST_CASE("wxImage::Clear", "[image]")
 {
     wxImage image(2, 2);
@@ -2491,6 +3007,147 @@ TEST_CASE("wxImage::Clear", "[image]")
     CHECK( image.GetRed(1, 1) == 0xff );
 }
 
+TEST_CASE("wxImage::PixelView", "[image][view]")
+{
+    // Create a 3*2 BGRA buffer with 4 bytes of padding at the end of each row.
+    const int stride = 3*4 + 4;
+    unsigned char buf[2*stride] = { 0 };
+    for ( int y = 0; y < 2; y++ )
+    {
+        for ( int x = 0; x < 3; x++ )
+        {
+            unsigned char* const p = buf + y*stride + x*4;
+            p[0] = 10*x;        // blue
+            p[1] = 100 + y;     // green
+            p[2] = 200 + x;     // red
+            p[3] = 50*(x + y);  // alpha
+        }
+    }
+
+    wxImagePixelView view(buf, 3, 2, wxIMAGE_PIXEL_BGRA, stride);
+    REQUIRE( view.IsOk() );
+    CHECK( view.HasAlpha() );
+    CHECK( view.GetRed(2, 1) == 202 );
+    CHECK( view.GetGreen(2, 1) == 101 );
+    CHECK( view.GetBlue(2, 1) == 20 );
+    CHECK( view.GetAlpha(2, 1) == 150 );
+
+    SECTION("ToImage")
+    {
+        const wxImage image = view.ToImage();
+        REQUIRE( image.IsOk() );
+        CHECK( image.GetSize() == wxSize(3, 2) );
+        CHECK( image.HasAlpha() );
+        CHECK( image.GetRed(1, 1) == 201 );
+        CHECK( image.GetGreen(1, 1) == 101 );
+        CHECK( image.GetBlue(1, 1) == 10 );
+        CHECK( image.GetAlpha(1, 1) == 100 );
+    }
+
+    SECTION("SubView")
+    {
+        wxImagePixelView sub = view.GetSubView(wxRect(1, 1, 2, 1));
+        REQUIRE( sub.IsOk() );
+        CHECK( sub.GetWidth() == 2 );
+        CHECK( sub.GetRed(0, 0) == 201 );
+
+        // The sub-view shares the data with the original buffer.
+        sub.SetRGB(1, 0, 1, 2, 3);
+        CHECK( view.GetRed(2, 1) == 1 );
+        CHECK( buf[stride + 2*4] == 3 );
+    }
+
+    SECTION("Mirror")
+    {
+        view.Mirror();
+        CHECK( view.GetRed(0, 0) == 202 );
+        CHECK( view.GetAlpha(0, 0) == 100 );
+        CHECK( view.GetRed(2, 0) == 200 );
+
+        view.Mirror(false);
+        CHECK( view.GetRed(0, 0) == 202 );
+        CHECK( view.GetGreen(0, 0) == 101 );
+
+        // Padding must not be affected.
+        CHECK( buf[3*4] == 0 );
+    }
+
+    SECTION("Rotate90")
+    {
+        unsigned char out[3*2*4];
+        wxImagePixelView rotated(out, 2, 3, wxIMAGE_PIXEL_BGRA);
+        REQUIRE( view.Rotate90(rotated) );
+
+        // This must be consistent with wxImage::Rotate90().
+        const wxImage image = view.ToImage().Rotate90();
+        for ( int y = 0; y < 3; y++ )
+        {
+            for ( int x = 0; x < 2; x++ )
+            {
+                CHECK( rotated.GetRed(x, y) == image.GetRed(x, y) );
+                CHECK( rotated.GetAlpha(x, y) == image.GetAlpha(x, y) );
+            }
+        }
+
+        REQUIRE( view.Rotate90(rotated, false) );
+        const wxImage image2 = view.ToImage().Rotate90(false);
+        CHECK( rotated.GetRed(0, 0) == image2.GetRed(0, 0) );
+        CHECK( rotated.GetRed(1, 2) == image2.GetRed(1, 2) );
+    }
+
+    SECTION("CopyFrom")
+    {
+        wxImage image(3, 2);
+        image.SetRGB(1, 0, 7, 8, 9);
+        REQUIRE( view.CopyFrom(image) );
+        CHECK( view.GetRed(1, 0) == 7 );
+        CHECK( view.GetBlue(1, 0) == 9 );
+        CHECK( buf[4] == 9 );
+        CHECK( view.GetAlpha(1, 0) == wxIMAGE_ALPHA_OPAQUE );
+    }
+
+    SECTION("Image")
+    {
+        wxImage image(2, 2);
+        wxImage copy(image);
+
+        wxImagePixelView imageView(image);
+        imageView.SetRGB(1, 1, 1, 2, 3);
+        CHECK( image.GetRed(1, 1) == 1 );
+        CHECK( copy.GetRed(1, 1) == 0 );
+    }
+}
+
+TEST_CASE_METHOD(ImageHandlersInit, "wxQuantize::Octree", "[image][quantize]")
+{
+    const wxImage image("horse.png");
+    REQUIRE( image.IsOk() );
+
+    const int numPixels = image.GetWidth()*image.GetHeight();
+
+    wxImage quantized;
+    unsigned char* data8bit = nullptr;
+    REQUIRE( wxQuantize::Quantize(image, quantized, nullptr, 16, &data8bit,
+                                  wxQUANTIZE_FILL_DESTINATION_IMAGE |
+                                  wxQUANTIZE_RETURN_8BIT_DATA |
+                                  wxQUANTIZE_OCTREE) );
+    REQUIRE( data8bit );
+
+    std::set<unsigned char> indices(data8bit, data8bit + numPixels);
+    delete [] data8bit;
+
+    CHECK( indices.size() == 16 );
+    CHECK( *indices.rbegin() < 16 );
+
+    // The result must be reasonably close to the original image.
+    const unsigned char* p1 = image.GetData();
+    const unsigned char* p2 = quantized.GetData();
+    long diff = 0;
+    for ( int n = 0; n < 3*numPixels; n++ )
+        diff += abs(p1[n] - p2[n]);
+    CHECK( diff / (3*numPixels) < 8 );
+}
+
 TEST_CASE("wxImage::SizeLimits", "[image]")
 {
 #if SIZEOF_VOID_P == 8
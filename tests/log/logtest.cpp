@@ -168,6 +168,25 @@ TEST_CASE_METHOD(LogTestCase, "wxLogSysError", "[log]")
     WX_ASSERT_MESSAGE( ("Error message is \"(%s\"", s), s.StartsWith("error 2") );
 }
 
+#ifdef wxHAS_STATIC_FORMAT
+
+TEST_CASE_METHOD(LogTestCase, "wxLog::StaticFormat", "[log]")
+{
+    wxLogMessage(wxSTATIC_FORMAT("%d %s"), 17, "static");
+    CHECK( m_log->GetLog(wxLOG_Message) == "17 static" );
+
+    wxLogWarning(wxSTATIC_FORMAT("%s: %5.2f%%"), wxString("done"), 99.5);
+    CHECK( m_log->GetLog(wxLOG_Warning) == "done: 99.50%" );
+
+    // This uses the overload taking the error code.
+    wxString s;
+    wxLogSysError(17, wxSTATIC_FORMAT("Error %d"), 42);
+    CHECK( m_log->GetLog(wxLOG_Error).StartsWith("Error 42 (", &s) );
+    WX_ASSERT_MESSAGE( ("Error message is \"(%s\"", s), s.StartsWith("error 17") );
+}
+
+#endif // wxHAS_STATIC_FORMAT
+
 TEST_CASE_METHOD(LogTestCase, "wxLog::NoWarnings", "[log]")
 {
     // Check that "else" branch is [not] taken as expected and that this code
@@ -1508,3 +1508,39 @@ TEST_CASE("wxMBConv::cMB2WC", "[mbconv][mb2wc]")
     CHECK( wxConvUTF7.cMB2WC(wxCharBuffer()).length() == 0 );
     CHECK( wxConvUTF7.cMB2WC("+AKM-").length() == 1 );
 }
+
+TEST_CASE("wxMBConv::UTF8Long", "[mbconv][utf8]")
+{
+    // Check that conversions of long strings, which are handled in blocks,
+    // work correctly when non-ASCII characters occur at various positions.
+    for ( size_t pos = 0; pos < 40; pos++ )
+    {
+        INFO("Non-ASCII character at position " << pos);
+
+        std::string utf8(40, 'x');
+        utf8.replace(pos, 1, "\xc3\xa9");
+
+        std::wstring wide(40, L'x');
+        wide[pos] = 0xe9;
+
+        CHECK( wxString::FromUTF8(utf8).ToStdWstring() == wide );
+        CHECK( wxString::FromUTF8(utf8.c_str()).ToStdWstring() == wide );
+        CHECK( wxString(wide).utf8_string() == utf8 );
+        CHECK( wxConvUTF8.FromWChar(nullptr, 0, wide.c_str(), wide.length())
+                == utf8.length() );
+
+        // Invalid sequences must still be detected.
+        std::string invalid(40, 'x');
+        invalid[pos] = '\xff';
+        CHECK( wxString::FromUTF8(invalid).empty() );
+    }
+
+    // Check that the output buffer size is respected.
+    const std::string ascii(64, 'a');
+    wchar_t buf[32];
+    CHECK( wxConvUTF8.ToWChar(buf, WXSIZEOF(buf), ascii.c_str(), ascii.length())
+            == wxCONV_FAILED );
+    CHECK( wxConvUTF8.ToWChar(buf, WXSIZEOF(buf), ascii.c_str(), WXSIZEOF(buf))
+            == WXSIZEOF(buf) );
+    CHECK( buf[WXSIZEOF(buf) - 1] == L'a' );
+}
@@ -17,10 +17,13 @@
     #include "wx/wx.h"
 #endif // WX_PRECOMP
 
+#include "wx/atom.h"
 #include "wx/private/localeset.h"
 
 #include <errno.h>
 
+#include <unordered_map>
+
 // ----------------------------------------------------------------------------
 // tests
 // ----------------------------------------------------------------------------
@@ -131,6 +134,87 @@ TEST_CASE("StringFormatUnicode", "[wxString]")
     CHECK( s2 == expected2 );
 }
 
+#ifdef wxHAS_STATIC_FORMAT
+
+TEST_CASE("StringFormatStatic", "[wxString][format]")
+{
+    // Check that the results are the same as with the normal format string.
+    #define CHECK_STATIC_FORMAT(fmt, ...) \
+        CHECK( wxString::Format(wxSTATIC_FORMAT(fmt), __VA_ARGS__) == \
+               wxString::Format(fmt, __VA_ARGS__) )
+
+    CHECK( wxString::Format(wxSTATIC_FORMAT("no arguments")) == "no arguments" );
+    CHECK( wxString::Format(wxSTATIC_FORMAT(L"wide %d"), 17) == "wide 17" );
+    CHECK( wxString::Format(wxSTATIC_FORMAT("%d%%"), 50) == "50%" );
+
+    SECTION("Integers")
+    {
+        CHECK_STATIC_FORMAT("%d %d %d", 0, -1, 123456789);
+        CHECK_STATIC_FORMAT("%d %d", INT_MIN, INT_MAX);
+        CHECK_STATIC_FORMAT("%lld %llu", LLONG_MIN, ULLONG_MAX);
+        CHECK_STATIC_FORMAT("%5d|%-5d|%05d|%+d|% d|", 42, 42, -42, 42, 42);
+        CHECK_STATIC_FORMAT("%.3d|%8.3d|%-+8.3d|%.0d|", 7, -7, 7, 0);
+        CHECK_STATIC_FORMAT("%u %x %X %o", 123u, 255, 255, 8);
+        CHECK_STATIC_FORMAT("%#x %#o %#X %#x", 255, 8, 0xabc, 0);
+        CHECK_STATIC_FORMAT("%x %u %hx", -1, -1, (short)-1);
+        CHECK_STATIC_FORMAT("%x %o", (short)-1, (signed char)-1);
+        CHECK_STATIC_FORMAT("%hd %hhd %hu %hhx", 70000, 300, -1, 0x1ff);
+        CHECK_STATIC_FORMAT("%hd %+hhd %hx", -70000, 200, 65536u);
+        CHECK_STATIC_FORMAT("%ld %zu %lu", 1L, (size_t)2, 3UL);
+    }
+
+    SECTION("Characters")
+    {
+        CHECK_STATIC_FORMAT("%c%c%3c%-3c|", 'a', L'b', 'c', 'd');
+        CHECK( wxString::Format(wxSTATIC_FORMAT("%c"), wxUniChar(0x432)) ==
+                wxString::FromUTF8("\xd0\xb2") );
+
+        // This character is invalid in the C locale, check that it doesn't
+        // result in an assert failure and is simply skipped in this case.
+        CHECK( wxString::Format(wxSTATIC_FORMAT("%c|"), '\xe9') ==
+                wxString("\xe9", wxConvLibc, 1) + "|" );
+    }
+
+    SECTION("Strings")
+    {
+        const wxString s("wx");
+        CHECK_STATIC_FORMAT("%s %s %s %s", "abc", L"wide", s, s.c_str());
+        CHECK( wxString::Format(wxSTATIC_FORMAT("%s"), std::string("std")) == "std" );
+        CHECK_STATIC_FORMAT("%10s|%-10s|%.2s|%5.1s|", "abc", "abc", "abc", "abc");
+
+        const wxString u = wxString::FromUTF8("\xd0\xb2\xd1\x82\xd0\xbe");
+        CHECK( wxString::Format(wxSTATIC_FORMAT("%.2s|%5s|"), u, u) ==
+                u.Left(2) + "|  " + u + "|" );
+    }
+
+    SECTION("Floating point")
+    {
+        CHECK_STATIC_FORMAT("%f %e %g %E %G", 3.14159, 3.14159, 3.14159, 1e-10, 1e20);
+        CHECK_STATIC_FORMAT("%.2f|%10.3f|%-10.1f|%010.2f|", 2.345, -1.5, 1.25, -3.5);
+        CHECK_STATIC_FORMAT("%+f|% f|%f", 1.0, 1.0, 3.5f);
+        CHECK_STATIC_FORMAT("%g %g %g %g", 0.0, 100000.0, 1000000.0, 1e-5);
+        CHECK_STATIC_FORMAT("%.0g %.10g %#g %#.0f", 2.5, 1.0/3, 1.0, 2.0);
+        CHECK_STATIC_FORMAT("%f %.3e", 1e300, -0.0);
+    }
+
+    SECTION("Pointers")
+    {
+        int n = 0;
+        CHECK_STATIC_FORMAT("%p", &n);
+        CHECK_STATIC_FORMAT("%p|%10p|", (void*)nullptr, (void*)nullptr);
+    }
+
+    SECTION("Positional")
+    {
+        CHECK( wxString::Format(wxSTATIC_FORMAT("%2$s %1$d"), 5, "five") == "five 5" );
+        CHECK( wxString::Format(wxSTATIC_FORMAT("%1$o %1$d %1$x"), 20) == "24 20 14" );
+    }
+
+    #undef CHECK_STATIC_FORMAT
+}
+
+#endif // wxHAS_STATIC_FORMAT
+
 TEST_CASE("StringConstructors", "[wxString]")
 {
     CHECK( wxString('Z', 0) == "" );
@@ -959,6 +1043,45 @@ TEST_CASE("StringFromDouble", "[wxString]")
     }
 }
 
+TEST_CASE("StringFromCDoubleShortest", "[wxString]")
+{
+    static const struct FromDoubleTestData
+    {
+        double value;
+        const char *str;
+    } testData[] =
+    {
+        { 0.0,                      "0" },
+        { -0.0,                     "-0" },
+        { 1.0,                      "1" },
+        { 0.1,                      "0.1" },
+        { 1.23,                     "1.23" },
+        { -0.45678,                 "-0.45678" },
+        { 1.0/3,                    "0.3333333333333333" },
+        { 0.1 + 0.2,                "0.30000000000000004" },
+        { 123456789.0,              "123456789" },
+        { 1e21,                     "1e+21" },
+        { 1e22,                     "1e+22" },
+        { 1.5e100,                  "1.5e+100" },
+        { -3e-10,                   "-3e-10" },
+        { 0.001,                    "0.001" },
+        { 1.7976931348623157e308,   "1.7976931348623157e+308" },
+        { 2.2250738585072014e-308,  "2.2250738585072014e-308" },
+    };
+
+    for ( const auto& td : testData )
+    {
+        INFO("Value " << td.str);
+
+        const wxString& s = wxString::FromCDoubleShortest(td.value);
+        CHECK( s == td.str );
+
+        double d;
+        CHECK( s.ToCDouble(&d) );
+        CHECK( d == td.value );
+    }
+}
+
 TEST_CASE("StringStringBuf", "[wxString]")
 {
     // check that buffer can be used to write into the string
@@ -1385,3 +1508,37 @@ TEST_CASE("StringSupplementaryUniChar", "[wxString]")
          find_first_of, find_last_of, find_first_not_of, find_last_not_of
     */
 }
+
+TEST_CASE("wxAtom", "[wxString][atom]")
+{
+    const wxAtom empty;
+    CHECK( empty.IsEmpty() );
+    CHECK( empty.GetString().empty() );
+    CHECK( wxAtom(wxString()) == empty );
+
+    const wxAtom foo("foo");
+    CHECK( !foo.IsEmpty() );
+    CHECK( foo.GetString() == "foo" );
+    CHECK( foo == "foo" );
+    CHECK( foo != "bar" );
+
+    // Atoms for the same string are the same, even if they are created from
+    // different string objects.
+    wxString s("fo");
+    s += 'o';
+    const wxAtom foo2(s);
+    CHECK( foo2 == foo );
+    CHECK( foo2.GetHash() == foo.GetHash() );
+    CHECK( &foo2.GetString() == &foo.GetString() );
+
+    const wxAtom bar("bar");
+    CHECK( bar != foo );
+    CHECK( (bar < foo) != (foo < bar) );
+
+    std::unordered_map<wxAtom, int> map;
+    map[foo] = 1;
+    map[bar] = 2;
+    CHECK( map[wxAtom("foo")] == 1 );
+    CHECK( map[wxAtom("bar")] == 2 );
+    CHECK( map.size() == 2 );
+}